@@ -0,0 +1,94 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ASYNC_ASYNC_STEP_H_
+#define INCLUDE_ASYNC_ASYNC_STEP_H_
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+class StepExecutor;
+
+///
+/// @brief The StepStatus enumerates why an asynchronous step finished
+///
+enum class StepStatus {
+  /// @brief all requested generations are calculated
+  Completed,
+  /// @brief the game is over
+  GameOver,
+  /// @brief the step was cancelled with its token or its executor was
+  /// destroyed
+  Cancelled,
+  /// @brief the time budget is exhausted
+  BudgetExhausted,
+  /// @brief another asynchronous step of the game is running
+  Rejected
+};
+
+///
+/// @brief The StepResult is the value of the future of an asynchronous step
+///
+struct StepResult {
+  StepStatus status;
+  /// @brief count of generations calculated by the step
+  std::uint32_t generations;
+  /// @brief count of generations of the game after the step
+  std::uint32_t generations_count;
+};
+
+///
+/// @brief The StepProgress is passed to the progress callback
+///
+struct StepProgress {
+  /// @brief count of generations calculated by the step so far
+  std::uint32_t generations;
+  /// @brief count of generations of the game
+  std::uint32_t generations_count;
+  /// @brief count of alive cells of the current generation
+  std::uint64_t alive_cells_count;
+};
+
+///
+/// @brief The CancellationToken requests cooperative cancellation of
+/// asynchronous steps. Copies share the state, so the caller keeps one copy
+/// and passes another one to the step
+///
+class CancellationToken {
+public:
+  /// @brief create token which is not cancelled
+  CancellationToken();
+  /// @brief request cancellation, the step finishes before its next
+  /// generation
+  void Cancel();
+  /// @brief true if cancellation is requested
+  bool IsCancelled() const;
+
+private:
+  /// @brief flag shared by copies of the token
+  std::shared_ptr<std::atomic<bool>> is_cancelled;
+};
+
+///
+/// @brief The AsyncStepOptions describes how an asynchronous step is run
+///
+struct AsyncStepOptions {
+  AsyncStepOptions();
+  /// @brief called on the executor thread every progress_period generations
+  /// of the step, could be empty
+  std::function<void(const StepProgress &)> progress;
+  /// @brief count of generations between progress calls, 0 to never call
+  std::uint32_t progress_period;
+  /// @brief maximum time from the call until the step finishes, 0 for no
+  /// limit
+  std::chrono::milliseconds time_budget;
+  /// @brief token which cancels the step
+  CancellationToken cancellation;
+  /// @brief executor of the step, nullptr for StepExecutor::GetDefault()
+  StepExecutor *executor;
+};
+
+#endif // INCLUDE_ASYNC_ASYNC_STEP_H_
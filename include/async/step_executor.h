@@ -0,0 +1,66 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ASYNC_STEP_EXECUTOR_H_
+#define INCLUDE_ASYNC_STEP_EXECUTOR_H_
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// @brief The StepExecutor runs many games on a few threads. A task is a
+/// slice of work, which returns true if it has to be continued, then it is
+/// queued again after tasks of other games, so long simulations don't block
+/// short ones. Tasks which are queued when the executor is destroyed are
+/// cancelled
+///
+class StepExecutor {
+public:
+  /// @brief slice of work, returns true if there is more work
+  using Task = std::function<bool()>;
+  /// @brief called instead of the task if the executor is destroyed first
+  using CancelTask = std::function<void()>;
+
+  /// @brief StepExecutor is initialized with count of threads, 0 to use
+  /// hardware concurrency
+  explicit StepExecutor(const std::uint32_t threads_count = 0);
+  /// @brief running slices are finished, then queued tasks are cancelled
+  ~StepExecutor();
+  /// @brief queue task, cancel is called if the task is not finished when
+  /// the executor is destroyed
+  void Submit(const Task &task, const CancelTask &cancel = CancelTask());
+  /// @brief return count of threads
+  std::uint32_t GetThreadsCount() const;
+  /// @brief return executor shared by all games of the process
+  static StepExecutor &GetDefault();
+
+private:
+  ///
+  /// @brief The QueuedTask is a task with its cancellation
+  ///
+  struct QueuedTask {
+    Task task;
+    CancelTask cancel;
+  };
+
+  /// @brief run tasks until the executor is destroyed
+  void RunThread();
+
+  /// @brief tasks which wait for a thread
+  std::deque<QueuedTask> tasks;
+  /// @brief protects tasks and is_stopped
+  std::mutex tasks_mutex;
+  /// @brief notified when a task is queued or the executor stops
+  std::condition_variable tasks_available;
+  /// @brief if true, threads should be stopped
+  bool is_stopped;
+  /// @brief threads of the executor
+  std::vector<std::thread> threads;
+};
+
+#endif // INCLUDE_ASYNC_STEP_EXECUTOR_H_
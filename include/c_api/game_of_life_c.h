@@ -0,0 +1,116 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_C_API_GAME_OF_LIFE_C_H_
+#define INCLUDE_C_API_GAME_OF_LIFE_C_H_
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(GOL_BUILDING_SHARED_LIBRARY)
+#define GOL_API __attribute__((visibility("default")))
+#else
+#define GOL_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief version of the C API, changed only when the ABI changes
+#define GOL_API_VERSION 2
+
+/// @brief opaque handle of a game world
+typedef struct gol_world gol_world;
+
+/// @brief result of API calls
+typedef enum gol_status {
+  GOL_OK = 0,
+  GOL_ERROR_INVALID_ARGUMENT = 1,
+  GOL_ERROR_OUT_OF_MEMORY = 2,
+  GOL_ERROR_INTERNAL = 3
+} gol_status;
+
+/// @brief engine which calculates generations
+typedef enum gol_engine {
+  GOL_ENGINE_PER_CELL = 0,
+  GOL_ENGINE_TEMPORAL_BLOCKING = 1,
+  GOL_ENGINE_LOOKUP_TABLE = 2
+} gol_engine;
+
+/// @brief settings of a world, zero initialized settings are defaults
+typedef struct gol_settings {
+  /// @brief count of worker threads, 0 to use hardware concurrency
+  uint32_t threads_count;
+  /// @brief one of gol_engine values
+  uint32_t engine;
+  /// @brief not 0 to take engine and threads from the autotuner, which
+  /// measures them on the first loaded cells
+  uint32_t autotune;
+  /// @brief profile file of the autotuner, NULL to measure every time
+  const char *autotune_profile_path;
+} gol_settings;
+
+/// @brief layout of packed cells. Cell at row and column is bit column % 64
+/// of word row * words_per_row + column / 64, unused bits are 0
+typedef struct gol_grid_layout {
+  uint32_t rows;
+  uint32_t columns;
+  uint32_t words_per_row;
+} gol_grid_layout;
+
+/// @brief return GOL_API_VERSION of the library
+GOL_API uint32_t gol_api_version(void);
+
+/// @brief create world of dead cells
+///
+/// @param settings could be NULL for defaults
+///
+/// @return world or NULL if sizes are 0 or memory could not be allocated
+GOL_API gol_world *gol_world_create(uint32_t rows, uint32_t columns,
+                                    const gol_settings *settings);
+
+/// @brief destroy world, NULL is ignored
+GOL_API void gol_world_destroy(gol_world *world);
+
+/// @brief make cells alive
+///
+/// @param cells pairs of row and column, cells_count count of pairs
+GOL_API gol_status gol_world_load_cells(gol_world *world,
+                                        const uint32_t *cells,
+                                        size_t cells_count);
+
+/// @brief make cells of a pattern alive
+///
+/// @param pattern rows of cells separated by '/' or new line, 'o' or '*' is
+/// an alive cell, any other character is a dead cell; row and column of the
+/// top left corner, the pattern wraps around the world
+GOL_API gol_status gol_world_load_pattern(gol_world *world,
+                                          const char *pattern, uint32_t row,
+                                          uint32_t column);
+
+/// @brief calculate generations
+GOL_API gol_status gol_world_step(gol_world *world, uint32_t generations);
+
+/// @brief return 1 if the game is over, 0 otherwise
+GOL_API int gol_world_is_game_over(gol_world *world);
+
+/// @brief return count of calculated generations
+GOL_API uint32_t gol_world_get_generation(const gol_world *world);
+
+/// @brief return count of alive cells
+GOL_API uint64_t gol_world_get_alive_cells_count(const gol_world *world);
+
+/// @brief return cells of the current generation packed one bit per cell
+/// without copying. The pointer stays valid until the world is stepped,
+/// loaded or destroyed
+///
+/// @param layout output layout of the cells, could be NULL
+GOL_API const uint64_t *gol_world_get_cells(const gol_world *world,
+                                            gol_grid_layout *layout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INCLUDE_C_API_GAME_OF_LIFE_C_H_
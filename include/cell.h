@@ -36,6 +36,9 @@ public:
   void AddNeighbour();
   /// @brief remove neighbour from cell
   void RemoveNeighbour();
+  /// @brief set count of cell's neighbours, e.g. after cells were changed
+  /// by words of packed cells
+  void SetNeighboursCount(const std::uint8_t neighbours_count);
 
 private:
   /// @brief cell data
@@ -43,8 +46,8 @@ private:
   /// @brief mutex to make all operations with a cell thread-safe
   mutable std::mutex cell_mutex;
 
-  /// @brief the maximum number of neighbour cells
-  const std::uint8_t cMaxNeighboursCount = 8;
+  /// @brief the maximum number of neighbour cells, 12 of triangular cells
+  const std::uint8_t cMaxNeighboursCount = 12;
 };
 
 #endif // INCLUDE_CELL_H_
@@ -0,0 +1,142 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_CENSUS_OBJECT_CENSUS_H_
+#define INCLUDE_CENSUS_OBJECT_CENSUS_H_
+#include "packed_grid.h"
+#include "rules/rule_table.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///
+/// @brief The ObjectKind enumerates classes of separated objects
+///
+enum class ObjectKind { StillLife, Oscillator, Spaceship, Unknown };
+
+///
+/// @brief The ObjectInfo describes an object of the census table
+///
+struct ObjectInfo {
+  /// @brief common name for known objects, otherwise code like xp15_<hash>
+  /// (xs still life, xp oscillator, xq spaceship, xx unknown)
+  std::string name;
+  ObjectKind kind;
+  /// @brief count of generations until the object repeats, 0 if unknown
+  std::uint32_t period;
+};
+
+///
+/// @brief The CensusEntry stores count of equal objects in the world
+///
+struct CensusEntry {
+  ObjectInfo object;
+  std::uint64_t count;
+};
+
+///
+/// @brief The ObjectCensus splits settled world into objects and classifies
+/// them. Components of touching alive cells are found with flood fill over
+/// 64 bit words of a packed grid. Close components are stepped together and
+/// apart, components which change each other or which have a period only
+/// together are one object, so spaceships with separated cells like lwss
+/// stay in one piece while neighbouring still lifes are counted separately.
+/// Every object is brought to canonical form (smallest of its 8 rotations
+/// and reflections) and looked up in a hash table. The table is filled with
+/// all phases of common objects, objects which are not in the table are
+/// simulated in isolation to find their period and then added to the table,
+/// so every object shape is simulated only once per census instance
+///
+class ObjectCensus {
+public:
+  /// @brief ObjectCensus is initialized with rules of the game
+  explicit ObjectCensus(const TotalisticRuleTable &rule_table);
+  /// @brief return objects of the grid, most frequent first
+  std::vector<CensusEntry> Take(const PackedGrid &grid);
+  /// @brief return count of object shapes in the table
+  std::size_t GetKnownShapesCount() const;
+
+  /// @brief maximum period found by simulation of unknown objects
+  static constexpr std::uint32_t cMaxPeriod = 64;
+  /// @brief maximum distance in rows and columns between cells of a
+  /// component
+  static constexpr std::int32_t cJoinDistance = 1;
+  /// @brief maximum distance in rows and columns between cells of
+  /// components which are tested for interaction
+  static constexpr std::int32_t cInteractionDistance = 2;
+
+private:
+  /// @brief row and column of a cell, could be negative after transformation
+  using ObjectCell = std::pair<std::int32_t, std::int32_t>;
+
+  /// @brief remove one connected component from remaining cells
+  ///
+  /// @param row, word position of a word with alive cells in remaining
+  /// grid, cells output cells of the component
+  void ExtractObject(const std::uint32_t row, const std::uint32_t word,
+                     std::vector<ObjectCell> &cells);
+  /// @brief return word of row bits dilated by one column to both sides
+  std::uint64_t DilateWord(const std::uint64_t *row,
+                           const std::uint32_t word) const;
+  /// @brief write row dilated by cJoinDistance columns to both sides into
+  /// dilated_row. Only words of the object span and one word at its sides
+  /// are dilated, they are stored in dilated_begin and dilated_end
+  void DilateRow(const std::uint64_t *row);
+  /// @brief extend span of the object words by the word
+  void AddObjectWord(const std::uint32_t word);
+  /// @brief return objects of components, close components which interact
+  /// are merged into one object
+  std::vector<std::vector<ObjectCell>> MergeInteracting(
+      const std::vector<std::vector<ObjectCell>> &components);
+  /// @brief true if the objects evolve differently when they are stepped
+  /// together and in isolation during cMaxPeriod generations, or only
+  /// together they are an object of known period
+  bool Interact(const std::vector<ObjectCell> &first,
+                const std::vector<ObjectCell> &second);
+  /// @brief shift rows and columns of objects crossing ring borders, so the
+  /// object is continuous
+  void UnwrapObject(std::vector<ObjectCell> &cells) const;
+  /// @brief return information about object, simulate it if it is unknown
+  const ObjectInfo &Classify(const std::vector<ObjectCell> &cells);
+  /// @brief simulate object in isolation, register its phases and return
+  /// information about it
+  ObjectInfo Simulate(const std::vector<ObjectCell> &cells,
+                      const std::string &name);
+  /// @brief add common objects to the table
+  void AddKnownObjects();
+
+  /// @brief return cells moved to start at row 0 and column 0
+  static std::vector<ObjectCell> Normalize(std::vector<ObjectCell> cells);
+  /// @brief return key of cells, which is equal only for equal shapes at
+  /// equal orientation
+  static std::string Encode(const std::vector<ObjectCell> &cells);
+  /// @brief return key which is equal for all rotations and reflections
+  static std::string Canonicalize(const std::vector<ObjectCell> &cells);
+  /// @brief return alive cells of the grid
+  static std::vector<ObjectCell> GetCells(const PackedGrid &grid);
+
+  /// @brief rules which are used for simulation of objects
+  const TotalisticRuleTable cRuleTable;
+  /// @brief canonical keys of all phases of known objects
+  std::unordered_map<std::string, ObjectInfo> known_objects;
+  /// @brief cells which are not yet assigned to an object
+  PackedGrid remaining;
+  /// @brief cells of the object which is extracted, rows of the object are
+  /// stored in object_rows
+  PackedGrid object;
+  /// @brief dilated row of the object and intermediate dilation result
+  std::vector<std::uint64_t> dilated_row, dilation_scratch;
+  /// @brief first and past the last word of dilated_row which are dilated
+  std::uint32_t dilated_begin, dilated_end;
+  /// @brief first and last word of all rows which have cells of the object
+  std::uint32_t first_object_word, last_object_word;
+  /// @brief rows which are pending in flood fill and touched by the object
+  std::vector<std::uint32_t> pending_rows, object_rows;
+  /// @brief true for ring borders
+  bool ring_borders;
+};
+
+#endif // INCLUDE_CENSUS_OBJECT_CENSUS_H_
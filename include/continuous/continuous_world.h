@@ -0,0 +1,42 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_CONTINUOUS_CONTINUOUS_WORLD_H_
+#define INCLUDE_CONTINUOUS_CONTINUOUS_WORLD_H_
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The ContinuousWorld stores states of cells in [0, 1], row after
+/// row
+///
+class ContinuousWorld {
+public:
+  /// @brief ContinuousWorld is initialized with rows and columns count, all
+  /// cells are 0
+  ContinuousWorld(const std::uint32_t rows, const std::uint32_t columns);
+  /// @brief return state of the cell, 0 for incorrect row or column
+  double Get(const std::uint32_t row, const std::uint32_t column) const;
+  /// @brief set state of the cell, clamped to [0, 1]
+  void Set(const std::uint32_t row, const std::uint32_t column,
+           const double value);
+  /// @brief return states of all cells
+  const std::vector<double> &GetCells() const;
+  /// @brief return states of all cells to change them
+  std::vector<double> &GetCells();
+  /// @brief return sum of states of all cells
+  double GetMass() const;
+  /// @brief return rows of the world
+  std::uint32_t GetRowCount() const;
+  /// @brief return columns of the world
+  std::uint32_t GetColumnCount() const;
+
+private:
+  /// @brief constants for rows and columns count
+  const std::uint32_t cRowsCount, cColumnsCount;
+  /// @brief states of cells
+  std::vector<double> cells;
+};
+
+#endif // INCLUDE_CONTINUOUS_CONTINUOUS_WORLD_H_
@@ -0,0 +1,97 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_CONTINUOUS_FFT_H_
+#define INCLUDE_CONTINUOUS_FFT_H_
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+/// @brief complex value of spectra
+using Complex = std::complex<double>;
+
+///
+/// @brief The Fft calculates discrete Fourier transforms of one length.
+/// Powers of two use the iterative radix-2 algorithm, other lengths are
+/// turned into a convolution of a power of two length (Bluestein)
+///
+class Fft {
+public:
+  /// @brief Fft is initialized with length of transforms
+  explicit Fft(const std::uint32_t length);
+  /// @brief Transform data in place, the inverse transform is not divided
+  /// by the length
+  ///
+  /// @param data length values, inverse true for the inverse transform,
+  /// scratch buffer of the caller, reused between calls
+  void Transform(Complex *data, const bool inverse,
+                 std::vector<Complex> &scratch) const;
+  /// @brief return length of transforms
+  std::uint32_t GetLength() const;
+
+private:
+  /// @brief forward radix-2 transform of power of two length in place
+  void TransformPowerOfTwo(Complex *data, const std::uint32_t length,
+                           const std::vector<Complex> &twiddles,
+                           const std::vector<std::uint32_t> &reversed) const;
+  /// @brief forward transform of any length in place
+  void TransformForward(Complex *data, std::vector<Complex> &scratch) const;
+
+  /// @brief length of transforms
+  const std::uint32_t cLength;
+  /// @brief length of radix-2 transforms, equal to cLength for powers of
+  /// two
+  std::uint32_t radix_length;
+  /// @brief twiddle factors exp(-2 pi i k / radix_length)
+  std::vector<Complex> twiddles;
+  /// @brief bit reversed indexes of radix_length
+  std::vector<std::uint32_t> reversed;
+  /// @brief chirp exp(-pi i k^2 / length) of Bluestein algorithm
+  std::vector<Complex> chirp;
+  /// @brief spectrum of the conjugated chirp, padded to radix_length
+  std::vector<Complex> chirp_spectrum;
+};
+
+///
+/// @brief The RealFft2d calculates 2D transforms of real grids. Pairs of
+/// real rows are transformed as one complex row, so only columns / 2 + 1
+/// columns of the spectrum are stored and transformed. Rows and columns are
+/// split between threads
+///
+class RealFft2d {
+public:
+  /// @brief RealFft2d is initialized with grid size and count of threads
+  RealFft2d(const std::uint32_t rows, const std::uint32_t columns,
+            const std::uint32_t threads_count);
+  /// @brief transform real grid into its spectrum
+  ///
+  /// @param input rows * columns values, spectrum rows * GetSpectrumColumns
+  /// values
+  void Forward(const double *input, std::vector<Complex> &spectrum);
+  /// @brief transform spectrum into real grid, divided by the grid size.
+  /// The spectrum is overwritten
+  void Inverse(std::vector<Complex> &spectrum, double *output);
+  /// @brief return count of columns of spectra
+  std::uint32_t GetSpectrumColumns() const;
+
+private:
+  /// @brief call function for ranges of [0, count) in threads
+  ///
+  /// @param function called with begin, end and thread index
+  template <typename Function>
+  void ParallelFor(const std::uint32_t count, const Function &function);
+  /// @brief transform every spectrum column by rows
+  void TransformColumns(std::vector<Complex> &spectrum, const bool inverse);
+
+  /// @brief grid size and count of spectrum columns
+  const std::uint32_t cRowsCount, cColumnsCount, cSpectrumColumns;
+  /// @brief count of threads
+  const std::uint32_t cThreadsCount;
+  /// @brief transforms of rows and columns
+  const Fft row_fft, column_fft;
+  /// @brief buffers of threads
+  std::vector<std::vector<Complex>> lines, scratches;
+};
+
+#endif // INCLUDE_CONTINUOUS_FFT_H_
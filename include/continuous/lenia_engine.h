@@ -0,0 +1,88 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_CONTINUOUS_LENIA_ENGINE_H_
+#define INCLUDE_CONTINUOUS_LENIA_ENGINE_H_
+#include "continuous_world.h"
+#include "engine/generation_engine.h"
+#include "fft.h"
+
+#include <vector>
+
+///
+/// @brief The LeniaSettings describes the kernel and growth of continuous
+/// cells, defaults are the Orbium creature
+///
+struct LeniaSettings {
+  LeniaSettings();
+  /// @brief radius of the kernel in cells
+  std::uint32_t radius;
+  /// @brief heights of kernel rings from the centre outwards
+  std::vector<double> peaks;
+  /// @brief potential of the highest growth and width of growth
+  double growth_center, growth_width;
+  /// @brief part of growth added every generation
+  double time_step;
+  /// @brief cells with state at least alive_level are alive in the packed
+  /// cells of the game
+  double alive_level;
+};
+
+///
+/// @brief The LeniaEngine calculates continuous cells: the potential of a
+/// cell is the convolution of the world with a smooth ring kernel, the
+/// state grows by the growth of the potential. The convolution is the
+/// product of spectra, the spectrum of the kernel is calculated once. The
+/// world wraps around borders. As GenerationEngine it keeps the continuous
+/// world and writes cells at least alive_level as alive packed cells;
+/// packed cells which were changed by somebody else since the last Step
+/// set states of their cells to 0 or 1
+///
+class LeniaEngine : public GenerationEngine {
+public:
+  /// @brief LeniaEngine is initialized with world size
+  ///
+  /// @param threads_count count of threads of transforms, 0 for hardware
+  /// concurrency
+  LeniaEngine(const std::uint32_t rows, const std::uint32_t columns,
+              const LeniaSettings &settings,
+              const std::uint32_t threads_count = 1);
+  void Step(PackedGrid &grid, const std::uint32_t generations) override;
+  /// @brief calculate one generation of continuous cells
+  void StepWorld();
+  /// @brief return continuous cells
+  const ContinuousWorld &GetWorld() const;
+  /// @brief return continuous cells to change them
+  ContinuousWorld &GetWorld();
+  /// @brief return potentials of the last generation
+  const std::vector<double> &GetPotentials() const;
+  /// @brief return weight of the kernel at the distance
+  ///
+  /// @param distance distance from the centre divided by the radius
+  static double GetKernelWeight(const double distance,
+                                const std::vector<double> &peaks);
+
+private:
+  /// @brief calculate spectrum of the normalized kernel
+  void BuildKernelSpectrum();
+  /// @brief return growth of the potential in [-1, 1]
+  double GetGrowth(const double potential) const;
+
+  /// @brief settings of kernel and growth
+  const LeniaSettings settings;
+  /// @brief continuous cells
+  ContinuousWorld world;
+  /// @brief transforms of the world size
+  RealFft2d fft;
+  /// @brief spectrum of the kernel
+  std::vector<Complex> kernel_spectrum;
+  /// @brief spectrum of the world, reused between generations
+  std::vector<Complex> spectrum;
+  /// @brief potentials of cells
+  std::vector<double> potentials;
+  /// @brief packed cells written by the last Step
+  PackedGrid packed;
+};
+
+#endif // INCLUDE_CONTINUOUS_LENIA_ENGINE_H_
@@ -0,0 +1,74 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_BAND_PROCESS_H_
+#define INCLUDE_DISTRIBUTED_BAND_PROCESS_H_
+#include "generation_coordinator.h"
+#include "halo_transport.h"
+#include "partition/row_partitioner.h"
+#include "world.h"
+
+#include <memory>
+
+///
+/// @brief The BandProcess calculates a horizontal band of the world. The
+/// band is stored in a World with one extra halo row above and below, which
+/// are filled with border rows of neighbour bands every generation
+///
+class BandProcess {
+public:
+  /// @brief BandProcess is initialized with its rows of the world
+  ///
+  /// @param band_rows rows of the world owned by the band, columns columns
+  /// of the world, band_num number of the band, transport exchanges halo
+  /// rows, coordinator generation barrier
+  BandProcess(const RowRange &band_rows, const std::uint32_t columns,
+              const std::uint32_t band_num, HaloTransport &transport,
+              GenerationCoordinator &coordinator);
+  /// @brief Set initial cells, cells outside of the band are ignored
+  ///
+  /// @param alive_cells points in coordinates of the whole world
+  void SetInitialCells(const std::vector<Point> &alive_cells);
+  /// @brief Calculate generations until coordinator decides game is over
+  ///
+  /// @return false if neighbours or coordinator did not answer
+  bool Run();
+
+private:
+  /// @brief exchange halo rows with neighbour bands
+  bool ExchangeHalo();
+  /// @brief calculate next generation of the band rows
+  void ExecuteNextGeneration();
+  /// @brief report alive cells and hash of the band to the coordinator
+  void ReportGeneration();
+  /// @brief pack cells of the local row
+  void PackRow(const std::uint32_t local_row, PackedRow &row);
+  /// @brief make cells of the local row equal to packed row
+  void UnpackRow(const PackedRow &row, const std::uint32_t local_row);
+  /// @brief return count of alive cells in the local row
+  std::uint64_t GetRowAliveCellsCount(const std::uint32_t local_row);
+
+  /// @brief rows of the world owned by the band
+  const RowRange cBandRows;
+  /// @brief count of rows owned by the band
+  const std::uint32_t cBandRowsCount;
+  /// @brief count of columns in the world
+  const std::uint32_t cColumnsCount;
+  /// @brief number of the band
+  const std::uint32_t cBandNum;
+  /// @brief band rows with halo rows, local row 0 is the halo above
+  World world;
+  /// @brief rules of the game
+  std::unique_ptr<GameRules> rules;
+  /// @brief exchanges halo rows
+  HaloTransport &transport;
+  /// @brief generation barrier
+  GenerationCoordinator &coordinator;
+  /// @brief current generation
+  std::uint32_t generation;
+  /// @brief buffers for sent and received rows
+  PackedRow first_row, last_row, halo_above, halo_below;
+};
+
+#endif // INCLUDE_DISTRIBUTED_BAND_PROCESS_H_
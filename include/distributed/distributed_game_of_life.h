@@ -0,0 +1,67 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_DISTRIBUTED_GAME_OF_LIFE_H_
+#define INCLUDE_DISTRIBUTED_DISTRIBUTED_GAME_OF_LIFE_H_
+#include "initial_figures/initial_figure.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+///
+/// @brief The DistributedSettings describes world split between processes
+///
+struct DistributedSettings {
+  DistributedSettings();
+  /// @brief rows and columns of the whole world
+  std::uint32_t rows, columns;
+  /// @brief count of bands (processes), at most rows
+  std::uint32_t bands_count;
+  /// @brief name of the simulation, used for shared memory objects
+  std::string session;
+  /// @brief maximum wait for a band or the coordinator
+  std::chrono::milliseconds timeout;
+};
+
+///
+/// @brief The DistributedResult describes finished distributed game
+///
+struct DistributedResult {
+  /// @brief true if all bands finished without errors
+  bool completed;
+  /// @brief count of calculated generations
+  std::uint32_t generations_count;
+  /// @brief count of alive cells in the last generation
+  std::uint64_t alive_cells_count;
+};
+
+///
+/// @brief The DistributedGameOfLife runs the game in several processes on
+/// the same host. The world is split into horizontal bands, every band is
+/// calculated by its own process, halo rows are exchanged over shared memory
+/// rings and this process coordinates generations
+///
+class DistributedGameOfLife {
+public:
+  explicit DistributedGameOfLife(const DistributedSettings &settings);
+  /// @brief Start band processes and run the game until it is over
+  ///
+  /// @param initial_cells alive cells of the initial world
+  DistributedResult Run(const std::vector<Point> &initial_cells);
+
+  /// @brief Run one band in the calling process, the coordinator should be
+  /// already started by Run in another process
+  ///
+  /// @return true if band finished without errors
+  static bool RunBand(const DistributedSettings &settings,
+                      const std::uint32_t band_num,
+                      const std::vector<Point> &initial_cells);
+
+private:
+  /// @brief settings of the game
+  const DistributedSettings cSettings;
+};
+
+#endif // INCLUDE_DISTRIBUTED_DISTRIBUTED_GAME_OF_LIFE_H_
@@ -0,0 +1,107 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_GENERATION_COORDINATOR_H_
+#define INCLUDE_DISTRIBUTED_GENERATION_COORDINATOR_H_
+#include "termination/termination_policy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+///
+/// @brief The GenerationCoordinator is a generation barrier in POSIX shared
+/// memory. After every generation bands report their alive cells count and
+/// hash, the coordinator aggregates them into counters of a termination
+/// policy and publishes its decision, which lets bands continue
+///
+class GenerationCoordinator {
+public:
+  /// @brief Create (coordinator) or open (band) shared state
+  ///
+  /// @param session name of the simulation, bands_count count of bands,
+  /// create true for the coordinator, timeout maximum wait for other side
+  GenerationCoordinator(const std::string &session,
+                        const std::uint32_t bands_count, const bool create,
+                        const std::chrono::milliseconds timeout);
+  /// @brief Unmap state, coordinator also unlinks it
+  ~GenerationCoordinator();
+  GenerationCoordinator(const GenerationCoordinator &) = delete;
+  GenerationCoordinator &operator=(const GenerationCoordinator &) = delete;
+
+  /// @brief true if state is mapped
+  bool IsValid() const;
+  /// @brief Band reports that it has calculated the generation
+  void ReportGeneration(const std::uint32_t band_num,
+                        const std::uint32_t generation,
+                        const std::uint64_t alive_cells_count,
+                        const std::uint64_t band_hash);
+  /// @brief Band waits for the decision about the generation
+  ///
+  /// @param game_over set to true if bands should stop
+  ///
+  /// @return false if coordinator did not answer in time
+  bool WaitDecision(const std::uint32_t generation, bool &game_over);
+  /// @brief Coordinator waits for all bands, aggregates their reports and
+  /// publishes decision for the generation
+  ///
+  /// @param termination policy which is updated once per generation and
+  /// decides if game is over, game_over result
+  ///
+  /// @return false if some band did not report in time
+  bool Decide(const std::uint32_t generation, TerminationPolicy &termination,
+              bool &game_over);
+  /// @brief Coordinator requests bands to stop, e.g. if one of them failed
+  void Abort();
+  /// @brief return count of alive cells in the last decided generation
+  std::uint64_t GetAliveCellsCount() const;
+
+private:
+  ///
+  /// @brief The BandReport is written by a band after every generation
+  ///
+  struct BandReport {
+    /// @brief generation + 1, 0 if nothing is reported
+    std::atomic<std::uint32_t> reported;
+    std::uint64_t alive_cells_count;
+    std::uint64_t band_hash;
+  };
+
+  ///
+  /// @brief The State is placed in the shared segment
+  ///
+  struct State {
+    /// @brief generation + 1 of the last decision, 0 if nothing is decided
+    std::atomic<std::uint32_t> decided;
+    /// @brief true if bands should stop after decided generation
+    std::atomic<std::uint32_t> game_over;
+  };
+
+  /// @brief return report of the band
+  BandReport &GetReport(const std::uint32_t band_num);
+
+  /// @brief name of the shared memory object
+  const std::string cName;
+  /// @brief count of bands
+  const std::uint32_t cBandsCount;
+  /// @brief true if this object created the segment
+  const bool cOwner;
+  /// @brief maximum wait for other side
+  const std::chrono::milliseconds cTimeout;
+  /// @brief mapped segment
+  void *segment;
+  /// @brief size of mapped segment
+  std::size_t segment_size;
+  /// @brief hashes of all decided generations, one hash per band
+  std::set<std::vector<std::uint64_t>> hashes;
+  /// @brief count of generations which repeated a previous one
+  std::uint32_t equal_worlds_count;
+  /// @brief alive cells in the last decided generation
+  std::uint64_t alive_cells_count;
+};
+
+#endif // INCLUDE_DISTRIBUTED_GENERATION_COORDINATOR_H_
@@ -0,0 +1,41 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_HALO_TRANSPORT_H_
+#define INCLUDE_DISTRIBUTED_HALO_TRANSPORT_H_
+#include <cstdint>
+#include <vector>
+
+/// @brief packed row of cells, bit N of word N / 64 is the cell at column N
+using PackedRow = std::vector<std::uint64_t>;
+
+///
+/// @brief The HaloDirection describes neighbour band, Up is the band with
+/// smaller rows (ring borders, so band 0 has the last band above it)
+///
+enum class HaloDirection { Up, Down };
+
+///
+/// @brief The HaloTransport exchanges border rows between neighbour bands.
+/// Every generation band sends its first row up and its last row down, and
+/// receives halo rows from both neighbours
+///
+class HaloTransport {
+public:
+  virtual ~HaloTransport() = default;
+  /// @brief Send own border row to the neighbour band
+  ///
+  /// @param direction neighbour band, row packed cells
+  ///
+  /// @return false if row could not be sent
+  virtual bool SendRow(const HaloDirection direction, const PackedRow &row) = 0;
+  /// @brief Receive halo row from the neighbour band, blocks until it comes
+  ///
+  /// @param direction neighbour band, row received packed cells
+  ///
+  /// @return false if row could not be received
+  virtual bool ReceiveRow(const HaloDirection direction, PackedRow &row) = 0;
+};
+
+#endif // INCLUDE_DISTRIBUTED_HALO_TRANSPORT_H_
@@ -0,0 +1,89 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_SHARED_MEMORY_RING_H_
+#define INCLUDE_DISTRIBUTED_SHARED_MEMORY_RING_H_
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///
+/// @brief The SharedMemoryRing is a single producer, single consumer ring of
+/// fixed size messages in POSIX shared memory. The owner creates the segment
+/// and unlinks it when destroyed, other processes open it by name
+///
+class SharedMemoryRing {
+public:
+  /// @brief Create (owner) or open the ring
+  ///
+  /// @param name name of the shared memory object, e.g. "/gol_ring",
+  /// slot_words size of one message in 64 bit words, slots_count count of
+  /// messages in the ring, create true to create the object. Sizes are
+  /// ignored when existing ring is opened
+  SharedMemoryRing(const std::string &name, const std::uint32_t slot_words,
+                   const std::uint32_t slots_count, const bool create);
+  /// @brief Unmap the ring, owner also unlinks it
+  ~SharedMemoryRing();
+  SharedMemoryRing(const SharedMemoryRing &) = delete;
+  SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+
+  /// @brief true if ring is mapped
+  bool IsValid() const;
+  /// @brief Put message to the ring, waits while ring is full
+  ///
+  /// @return false if message is too long or timeout expired
+  bool Push(const std::vector<std::uint64_t> &message,
+            const std::chrono::milliseconds timeout);
+  /// @brief Take message from the ring, waits while ring is empty
+  ///
+  /// @return false if timeout expired
+  bool Pop(std::vector<std::uint64_t> &message,
+           const std::chrono::milliseconds timeout);
+
+private:
+  ///
+  /// @brief The Header is placed at the beginning of the shared segment
+  ///
+  struct Header {
+    std::atomic<std::uint64_t> head;
+    std::atomic<std::uint64_t> tail;
+    std::uint64_t slot_words;
+    std::uint64_t slots_count;
+  };
+
+  /// @brief return first word of the slot
+  std::uint64_t *GetSlot(const std::uint64_t position);
+
+  /// @brief name of the shared memory object
+  const std::string cName;
+  /// @brief true if this object created the segment
+  const bool cOwner;
+  /// @brief mapped segment
+  void *segment;
+  /// @brief size of the mapped segment
+  std::size_t segment_size;
+  /// @brief header in the segment
+  Header *header;
+};
+
+///
+/// @brief The SpinWait waits for a condition with growing pauses and a
+/// deadline, it is used for waiting on shared memory between processes
+///
+class SpinWait {
+public:
+  explicit SpinWait(const std::chrono::milliseconds timeout);
+  /// @brief pause before next check
+  ///
+  /// @return false if deadline is over
+  bool Pause();
+
+private:
+  std::chrono::steady_clock::time_point deadline;
+  std::uint32_t spins_count;
+};
+
+#endif // INCLUDE_DISTRIBUTED_SHARED_MEMORY_RING_H_
@@ -0,0 +1,56 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_DISTRIBUTED_SHARED_MEMORY_TRANSPORT_H_
+#define INCLUDE_DISTRIBUTED_SHARED_MEMORY_TRANSPORT_H_
+#include "halo_transport.h"
+#include "shared_memory_ring.h"
+
+#include <memory>
+#include <string>
+
+///
+/// @brief The SharedMemoryTransport exchanges halo rows between processes on
+/// the same host. Every band owns two rings: rows it sends up and rows it
+/// sends down. Rings are created by the coordinator before bands start
+///
+class SharedMemoryTransport : public HaloTransport {
+public:
+  /// @brief Open rings of the band
+  ///
+  /// @param session name of the simulation, band_num number of the band,
+  /// bands_count count of bands, timeout maximum wait for a neighbour
+  SharedMemoryTransport(const std::string &session,
+                        const std::uint32_t band_num,
+                        const std::uint32_t bands_count,
+                        const std::chrono::milliseconds timeout);
+  bool SendRow(const HaloDirection direction, const PackedRow &row) override;
+  bool ReceiveRow(const HaloDirection direction, PackedRow &row) override;
+  /// @brief true if all rings are opened
+  bool IsValid() const;
+
+  /// @brief return name of the ring with rows which band sends in direction
+  static std::string GetRingName(const std::string &session,
+                                 const HaloDirection direction,
+                                 const std::uint32_t band_num);
+  /// @brief create rings for all bands, should be kept while bands run
+  ///
+  /// @param row_words count of 64 bit words in one row
+  static std::vector<std::unique_ptr<SharedMemoryRing>>
+  CreateRings(const std::string &session, const std::uint32_t bands_count,
+              const std::uint32_t row_words);
+
+private:
+  /// @brief rings with rows which band sends up and down
+  std::unique_ptr<SharedMemoryRing> send_up, send_down;
+  /// @brief rings with rows which neighbours send to this band
+  std::unique_ptr<SharedMemoryRing> receive_up, receive_down;
+  /// @brief maximum wait for a neighbour
+  const std::chrono::milliseconds cTimeout;
+
+  /// @brief count of rows which could be sent before neighbour reads them
+  static constexpr std::uint32_t cRingSlotsCount = 4;
+};
+
+#endif // INCLUDE_DISTRIBUTED_SHARED_MEMORY_TRANSPORT_H_
@@ -12,7 +12,8 @@
 ///
 class WorldConsoleDrawer : public WorldDrawer {
 public:
-  void DrawCells(const WorldCells &cells) override;
+  void DrawCells(const WorldSnapshot &snapshot) override;
+  void DrawStatistics(const StatisticsSummary &summary) override;
 
 private:
   /// @brief Draws a heading line
@@ -4,7 +4,7 @@
 ///
 #ifndef INCLUDE_DRAWER_H_
 #define INCLUDE_DRAWER_H_
-#include "../world.h"
+#include "../snapshot/world_snapshot.h"
 
 ///
 /// @brief The WorldDrawer draws cells of the world generation
@@ -13,8 +13,12 @@ class WorldDrawer {
 public:
   /// @brief Draws world cells
   ///
-  /// @param cells are array of world cells
-  virtual void DrawCells(const WorldCells &cells) = 0;
+  /// @param snapshot is a consistent generation of the world
+  virtual void DrawCells(const WorldSnapshot &snapshot) = 0;
+  /// @brief Draws statistics of the world generation
+  ///
+  /// @param summary population, births, deaths, bounding box and centroid
+  virtual void DrawStatistics(const StatisticsSummary &summary) = 0;
 };
 
 #endif // INCLUDE_DRAWER_H_
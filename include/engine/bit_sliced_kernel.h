@@ -0,0 +1,75 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_BIT_SLICED_KERNEL_H_
+#define INCLUDE_ENGINE_BIT_SLICED_KERNEL_H_
+#include "packed_grid.h"
+#include "rules/rule_table.h"
+
+#include <vector>
+
+///
+/// @brief The BitSlicedKernel calculates 64 cells at once. Neighbour counts
+/// of all cells of a word are kept in four bit planes, which are summed with
+/// bitwise adders, then the rule is applied to the planes
+///
+class BitSlicedKernel {
+public:
+  /// @brief BitSlicedKernel is initialized with rules and row length
+  BitSlicedKernel(const TotalisticRuleTable &rule_table,
+                  const std::uint32_t columns);
+  /// @brief Calculate next generation of one row
+  ///
+  /// @param above, row, below current rows, nullptr for a row outside of the
+  /// world, next output row
+  void StepRow(const std::uint64_t *above, const std::uint64_t *row,
+               const std::uint64_t *below, std::uint64_t *next) const;
+  /// @brief Calculate next generation of the whole grid
+  void StepGrid(const PackedGrid &current, PackedGrid &next) const;
+  /// @brief return row above the row according to border rules, nullptr if
+  /// it is outside of the world
+  const std::uint64_t *GetRowAbove(const PackedGrid &grid,
+                                   const std::uint32_t row) const;
+  /// @brief return row below the row according to border rules, nullptr if
+  /// it is outside of the world
+  const std::uint64_t *GetRowBelow(const PackedGrid &grid,
+                                   const std::uint32_t row) const;
+
+private:
+  /// @brief return cells at column - 1 shifted to column
+  std::uint64_t GetWest(const std::uint64_t *row,
+                        const std::uint32_t word) const;
+  /// @brief return cells at column + 1 shifted to column
+  std::uint64_t GetEast(const std::uint64_t *row,
+                        const std::uint32_t word) const;
+  /// @brief apply rule to neighbour count planes
+  std::uint64_t Evaluate(const std::uint64_t alive, const std::uint64_t s0,
+                         const std::uint64_t s1, const std::uint64_t s2,
+                         const std::uint64_t s3) const;
+
+  ///
+  /// @brief The CountRule describes which cells with count of neighbours
+  /// are alive in next generation
+  ///
+  struct CountRule {
+    std::uint32_t neighbours_count;
+    /// @brief true if alive cell survives, true if dead cell is born
+    bool for_alive, for_dead;
+  };
+
+  /// @brief counts of neighbours which give alive cell
+  std::vector<CountRule> count_rules;
+  /// @brief true for ring borders
+  const bool cRingBorders;
+  /// @brief count of columns and words in a row
+  const std::uint32_t cColumnsCount, cWordsPerRow;
+  /// @brief bit of the last column in the last word
+  const std::uint32_t cLastBit;
+  /// @brief mask of used bits in the last word
+  const std::uint64_t cLastWordMask;
+  /// @brief row of dead cells used outside of the world
+  const std::vector<std::uint64_t> cDeadRow;
+};
+
+#endif // INCLUDE_ENGINE_BIT_SLICED_KERNEL_H_
@@ -0,0 +1,25 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_GENERATION_ENGINE_H_
+#define INCLUDE_ENGINE_GENERATION_ENGINE_H_
+#include "packed_grid.h"
+
+///
+/// @brief The GenerationEngine calculates next generations of a packed grid
+///
+class GenerationEngine {
+public:
+  virtual ~GenerationEngine() = default;
+  /// @brief Advance the grid by count of generations
+  ///
+  /// @param grid cells which are replaced by cells of the last generation,
+  /// generations count of generations to calculate
+  virtual void Step(PackedGrid &grid, const std::uint32_t generations) = 0;
+  /// @brief Set number of the generation which is calculated by the next
+  /// Step. Engines whose results depend only on cells ignore it
+  virtual void SetGeneration(const std::uint64_t /*generation*/) {}
+};
+
+#endif // INCLUDE_ENGINE_GENERATION_ENGINE_H_
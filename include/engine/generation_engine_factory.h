@@ -0,0 +1,48 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_GENERATION_ENGINE_FACTORY_H_
+#define INCLUDE_ENGINE_GENERATION_ENGINE_FACTORY_H_
+#include "generation_engine.h"
+#include "rules/neighbourhood_table.h"
+#include "rules/rule_table.h"
+
+#include <memory>
+
+///
+/// @brief The GenerationEngineType enumerates ways to calculate generations.
+/// PerCell is calculated by GameOfLife on cells of the world, other types
+/// are engines working on packed cells. Continuous cells of Continuous are
+/// kept by the engine, packed cells are their alive projection
+///
+enum class GenerationEngineType {
+  PerCell,
+  TemporalBlocking,
+  LookupTable,
+  Continuous
+};
+
+///
+/// @brief The GenerationEngineFactory returns unique_ptr to engine of the type
+///
+class GenerationEngineFactory {
+public:
+  /// @brief return engine of the type, temporal blocking engine for PerCell,
+  /// lattice engine for any type if the topology of rules is not square
+  ///
+  /// @param type engine type, rule_table rules, columns count of columns in
+  /// the world, tile_rows and depth tile sizes of temporal blocking
+  static std::unique_ptr<GenerationEngine>
+  MakeGenerationEngine(const GenerationEngineType type,
+                       const TotalisticRuleTable &rule_table,
+                       const std::uint32_t columns,
+                       const std::uint32_t tile_rows,
+                       const std::uint32_t depth);
+  /// @brief return engine of rules which depend on the arrangement of
+  /// neighbours, it calculates 2x2 blocks with the lookup table
+  static std::unique_ptr<GenerationEngine>
+  MakeGenerationEngine(const NeighbourhoodRuleTable &rule_table);
+};
+
+#endif // INCLUDE_ENGINE_GENERATION_ENGINE_FACTORY_H_
@@ -0,0 +1,81 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_LATTICE_ENGINE_H_
+#define INCLUDE_ENGINE_LATTICE_ENGINE_H_
+#include "generation_engine.h"
+#include "rules/rule_table.h"
+
+#include <vector>
+
+///
+/// @brief The LatticeEngine calculates 64 cells of hexagonal or triangular
+/// worlds at once. Cells of a row have the same neighbour offsets except of
+/// triangular cells, whose orientation alternates along the row, so
+/// neighbours are gathered as shifted words of the padded rows around, the
+/// orientation selects its words with a checkerboard mask, and the words
+/// are summed into four bit planes like in BitSlicedKernel
+///
+class LatticeEngine : public GenerationEngine {
+public:
+  /// @brief LatticeEngine is initialized with rules and row length, the
+  /// topology of the rule table selects neighbours
+  LatticeEngine(const TotalisticRuleTable &rule_table,
+                const std::uint32_t columns);
+  void Step(PackedGrid &grid, const std::uint32_t generations) override;
+
+private:
+  /// @brief copy rows of the grid with one word before and after them, the
+  /// two columns around the row are wrapped or dead according to border
+  /// rules
+  void FillPadded(const PackedGrid &grid);
+  /// @brief return padded row, dead row if it is outside of limited borders
+  const std::uint64_t *GetPaddedRow(const std::int64_t row,
+                                    const std::int64_t rows) const;
+  /// @brief return cells at column + offset shifted to column
+  ///
+  /// @param row padded row, word word of the world row, offset in [-2, 2]
+  std::uint64_t GetShifted(const std::uint64_t *row, const std::uint32_t word,
+                           const std::int32_t offset) const;
+  /// @brief calculate one row of hexagonal cells
+  void StepHexagonalRow(const std::uint32_t row, const std::uint64_t *above,
+                        const std::uint64_t *middle,
+                        const std::uint64_t *below, std::uint64_t *next) const;
+  /// @brief calculate one row of triangular cells
+  void StepTriangularRow(const std::uint32_t row, const std::uint64_t *above,
+                         const std::uint64_t *middle,
+                         const std::uint64_t *below,
+                         std::uint64_t *next) const;
+  /// @brief apply rule to neighbour count planes
+  std::uint64_t Evaluate(const std::uint64_t alive,
+                         const std::uint64_t planes[4]) const;
+
+  ///
+  /// @brief The CountRule describes which cells with count of neighbours
+  /// are alive in next generation
+  ///
+  struct CountRule {
+    std::uint32_t neighbours_count;
+    /// @brief true if alive cell survives, true if dead cell is born
+    bool for_alive, for_dead;
+  };
+
+  /// @brief counts of neighbours which give alive cell
+  std::vector<CountRule> count_rules;
+  /// @brief shape of cells
+  const GridTopology cTopology;
+  /// @brief true for ring borders
+  const bool cRingBorders;
+  /// @brief count of columns and words in a row, padded row has 2 words more
+  const std::uint32_t cColumnsCount, cWordsPerRow, cPaddedWordsPerRow;
+  /// @brief mask of used bits in the last word
+  const std::uint64_t cLastWordMask;
+  /// @brief padded rows of the current generation, reused between
+  /// generations
+  std::vector<std::uint64_t> padded;
+  /// @brief padded row of dead cells used outside of the world
+  const std::vector<std::uint64_t> cDeadRow;
+};
+
+#endif // INCLUDE_ENGINE_LATTICE_ENGINE_H_
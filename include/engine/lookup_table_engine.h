@@ -0,0 +1,55 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_LOOKUP_TABLE_ENGINE_H_
+#define INCLUDE_ENGINE_LOOKUP_TABLE_ENGINE_H_
+#include "generation_engine.h"
+#include "rules/neighbourhood_table.h"
+#include "rules/rule_table.h"
+
+#include <vector>
+
+///
+/// @brief The LookupTableEngine calculates 2x2 blocks of cells at once. The
+/// 4x4 neighbourhood of a block is packed into a 16 bit index of a table,
+/// which stores the next state of the 4 inner cells. The table is generated
+/// from the rules, so any totalistic rules and rules which depend on the
+/// arrangement of neighbours are calculated at the same speed
+///
+class LookupTableEngine : public GenerationEngine {
+public:
+  /// @brief LookupTableEngine is initialized with rules
+  explicit LookupTableEngine(const TotalisticRuleTable &rule_table);
+  /// @brief LookupTableEngine is initialized with states of 3x3 blocks
+  explicit LookupTableEngine(const NeighbourhoodRuleTable &rule_table);
+  void Step(PackedGrid &grid, const std::uint32_t generations) override;
+  /// @brief return next states of inner 2x2 cells of the 4x4 neighbourhood
+  ///
+  /// @param neighbourhood bit row * 4 + column is the cell of the 4x4 block
+  ///
+  /// @return bit row * 2 + column is the inner cell at row + 1, column + 1
+  std::uint8_t GetBlockState(const std::uint16_t neighbourhood) const;
+
+  /// @brief count of entries in the table
+  static constexpr std::uint32_t cTableSize = 1 << 16;
+
+private:
+  /// @brief copy grid with one column and row before and two after, which
+  /// are wrapped or dead according to border rules
+  void FillPadded(const PackedGrid &grid);
+  /// @brief return 4 cells of the padded row starting at padded column
+  std::uint32_t GetNibble(const std::uint64_t *row,
+                          const std::uint32_t column) const;
+  /// @brief calculate one generation from padded into grid
+  void StepGeneration(PackedGrid &grid);
+
+  /// @brief next states of 2x2 blocks for every 4x4 neighbourhood
+  std::vector<std::uint8_t> table;
+  /// @brief true for ring borders
+  const bool cRingBorders;
+  /// @brief grid with padding, reused between generations
+  PackedGrid padded;
+};
+
+#endif // INCLUDE_ENGINE_LOOKUP_TABLE_ENGINE_H_
@@ -0,0 +1,47 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_STOCHASTIC_ENGINE_H_
+#define INCLUDE_ENGINE_STOCHASTIC_ENGINE_H_
+#include "generation_engine.h"
+
+#include <memory>
+
+///
+/// @brief The StochasticEngine makes births and survivals of another engine
+/// happen with probabilities. Random bits of a cell are keyed on seed,
+/// generation and position of the cell, so results don't depend on threads,
+/// tiles or the engine which calculates the rules
+///
+class StochasticEngine : public GenerationEngine {
+public:
+  /// @brief StochasticEngine is initialized with engine of the rules
+  ///
+  /// @param engine engine which calculates births and survivals,
+  /// birth_probability probability that a birth of the rules happens,
+  /// survival_probability probability that a survival of the rules
+  /// happens, otherwise the cell dies, seed key of random bits
+  StochasticEngine(std::unique_ptr<GenerationEngine> engine,
+                   const double birth_probability,
+                   const double survival_probability,
+                   const std::uint64_t seed);
+  void Step(PackedGrid &grid, const std::uint32_t generations) override;
+  /// @brief set number of the generation which is calculated by the next
+  /// Step
+  void SetGeneration(const std::uint64_t generation) override;
+
+private:
+  /// @brief engine of the rules
+  std::unique_ptr<GenerationEngine> engine;
+  /// @brief thresholds of CounterRandom for births and survivals
+  const std::uint64_t cBirthThreshold, cSurvivalThreshold;
+  /// @brief key of random bits
+  const std::uint64_t cSeed;
+  /// @brief number of the next generation
+  std::uint64_t generation;
+  /// @brief cells of the previous generation, reused between generations
+  PackedGrid previous;
+};
+
+#endif // INCLUDE_ENGINE_STOCHASTIC_ENGINE_H_
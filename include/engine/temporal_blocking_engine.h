@@ -0,0 +1,54 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_ENGINE_TEMPORAL_BLOCKING_ENGINE_H_
+#define INCLUDE_ENGINE_TEMPORAL_BLOCKING_ENGINE_H_
+#include "bit_sliced_kernel.h"
+#include "generation_engine.h"
+
+///
+/// @brief The TemporalBlockingEngine advances several generations per pass
+/// over the world. The world is cut into tiles of full rows. A tile is copied
+/// together with a halo of depth rows above and below and advanced depth
+/// generations while it stays in cache. Every generation the valid part of
+/// the copy shrinks by one row at each side, after depth generations exactly
+/// the tile rows are valid. Tiles span full rows, so ring borders between
+/// columns are handled by the row kernel and only rows need a halo
+///
+class TemporalBlockingEngine : public GenerationEngine {
+public:
+  /// @brief TemporalBlockingEngine is initialized with rules and tile sizes
+  ///
+  /// @param rule_table rules, columns count of columns in the world,
+  /// tile_rows count of rows in one tile, depth count of generations
+  /// calculated per tile pass
+  TemporalBlockingEngine(const TotalisticRuleTable &rule_table,
+                         const std::uint32_t columns,
+                         const std::uint32_t tile_rows,
+                         const std::uint32_t depth);
+  void Step(PackedGrid &grid, const std::uint32_t generations) override;
+
+private:
+  /// @brief advance all tiles by count of generations (at most depth)
+  void StepBlock(const PackedGrid &current, PackedGrid &next,
+                 const std::uint32_t generations);
+  /// @brief copy tile with halo into local buffer
+  void LoadTile(const PackedGrid &grid, const std::int64_t first_row,
+                const std::uint32_t rows_count);
+
+  /// @brief calculates rows
+  BitSlicedKernel kernel;
+  /// @brief true for ring borders
+  const bool cRingBorders;
+  /// @brief count of rows in one tile
+  const std::uint32_t cTileRows;
+  /// @brief count of generations per tile pass
+  const std::uint32_t cDepth;
+  /// @brief local copies of the tile with halo, current and next generation
+  PackedGrid tile, next_tile;
+  /// @brief output grid, reused between calls
+  PackedGrid output;
+};
+
+#endif // INCLUDE_ENGINE_TEMPORAL_BLOCKING_ENGINE_H_
@@ -5,15 +5,33 @@
 ///
 #ifndef INCLUDE_GAME_OF_LIFE_H_
 #define INCLUDE_GAME_OF_LIFE_H_
+#include "async/async_step.h"
+#include "async/step_executor.h"
+#include "continuous/lenia_engine.h"
+#include "census/object_census.h"
 #include "drawer/world_drawer.h"
+#include "engine/generation_engine_factory.h"
+#include "history/rewind_buffer.h"
 #include "initial_figures/initial_figure.h"
+#include "initial_figures/pattern_library.h"
+#include "memory/cache_aligned_allocator.h"
+#include "metrics/metrics_exporter.h"
+#include "partition/row_partitioner.h"
+#include "region/region_operations.h"
+#include "region/region_query.h"
 #include "rules/rules_factory.h"
+#include "snapshot/world_snapshot.h"
+#include "statistics/population_pyramid.h"
+#include "streaming/frame_server.h"
+#include "termination/termination_policy.h"
 #include "world.h"
 
 #include <boost/thread.hpp>
 #include <condition_variable>
+#include <future>
 #include <mutex>
 #include <semaphore.h>
+#include <string>
 
 ///
 /// @brief The GameOfLifeInitialState enumerates initial states which we can
@@ -28,6 +46,54 @@ enum class GameOfLifeInitialState {
   Glider
 };
 
+///
+/// @brief The GameOfLifeSettings describes how generations are executed
+///
+struct GameOfLifeSettings {
+  GameOfLifeSettings();
+  /// @brief count of worker threads, 0 to use hardware concurrency, 1 to
+  /// calculate generations in the calling thread
+  std::uint32_t threads_count;
+  /// @brief if true, rows are redistributed between threads every generation
+  /// according to the time threads spent on their rows
+  bool adaptive_load_balancing;
+  /// @brief if true, threads are pinned to cores and every thread allocates
+  /// its own rows of the world, so they are placed on its NUMA node. Row
+  /// ranges stay stable across generations, adaptive_load_balancing is
+  /// ignored
+  bool numa_placement;
+  /// @brief engine of ExecuteNextGeneration and StepGenerations. PerCell
+  /// calculates ExecuteNextGeneration on cells of the world in worker
+  /// threads and StepGenerations with temporal blocking
+  GenerationEngineType engine;
+  /// @brief count of rows in one tile of StepGenerations
+  std::uint32_t temporal_tile_rows;
+  /// @brief count of generations calculated per tile pass of StepGenerations
+  std::uint32_t temporal_depth;
+  /// @brief shape of cells. Hexagonal and Triangular worlds are calculated
+  /// by the lattice engine for every engine except PerCell, census counts
+  /// objects of square worlds only
+  GridTopology topology;
+  /// @brief rule in B/S notation, e.g. "B2/S34", or in Hensel notation for
+  /// square cells, e.g. "B2n3/S23-q", empty for the default rule of the
+  /// topology. Hensel rules are calculated by the lookup table engine
+  std::string rule;
+  /// @brief probabilities that a birth or a survival of the rule happens,
+  /// otherwise the cell stays dead or dies. Below 1, generations are
+  /// calculated by the engine even for PerCell
+  double birth_probability, survival_probability;
+  /// @brief key of random bits of births and survivals, the same seed gives
+  /// the same generations with any threads and engine
+  std::uint64_t random_seed;
+  /// @brief kernel and growth of continuous cells of the Continuous engine
+  LeniaSettings lenia;
+  /// @brief if true, games of GameOfLifeFactory take engine, tiles and
+  /// threads from the Autotuner instead of settings
+  bool autotune;
+  /// @brief profile file of the Autotuner, empty to measure on every start
+  std::string autotune_profile_path;
+};
+
 /// @brief row, column and is_alive for cell
 using CellData = std::tuple<std::uint32_t, std::uint32_t, bool>;
 
@@ -39,31 +105,268 @@ class GameOfLife {
 public:
   /// @brief The GameOfLife is initialized with rows and columns count. Infinity
   /// of boards could be achieved by border rules
-  GameOfLife(const std::uint32_t rows, const std::uint32_t columns);
+  GameOfLife(const std::uint32_t rows, const std::uint32_t columns,
+             const GameOfLifeSettings &settings = GameOfLifeSettings());
   /// @brief when game is finished, all threads are stopped
   ~GameOfLife();
-  /// @brief Draw with default drawer
+  /// @brief Draw cells and statistics of the last finished generation with
+  /// default drawer, could be called from another thread while the game is
+  /// stepped. Without snapshots it waits for the world update of the step
   void Draw();
   /// @brief Calculate next generation
   void ExecuteNextGeneration();
+  /// @brief Calculate several generations at once with the engine of
+  /// settings (temporal blocking for PerCell).
+  /// The result and the termination reason are the same as of
+  /// ExecuteNextGeneration called generations times: generations are
+  /// calculated at once only within the stride of the termination policy,
+  /// e.g. up to the generation limit, and one by one while extinction or
+  /// repetition could end the game. Skipped generations are not hashed
+  ///
+  /// @param generations count of generations to calculate
+  void StepGenerations(const std::uint32_t generations);
+  /// @brief Calculate generations on the executor of options without
+  /// blocking the caller. Only one asynchronous step of a game runs at once,
+  /// other calls of the game must wait for its future, except ReadSnapshot,
+  /// QueryRegion and Draw. The step is Cancelled if its executor is
+  /// destroyed first.
+  /// The game must not be destroyed before the future is ready
+  ///
+  /// @param generations count of generations to calculate
+  ///
+  /// @return future of the result, Rejected if another step is running
+  std::future<StepResult> StepAsync(
+      const std::uint32_t generations,
+      const AsyncStepOptions &options = AsyncStepOptions());
+  /// @brief Calculate generations asynchronously until the game is over,
+  /// same as StepAsync
+  std::future<StepResult>
+  RunUntilGameOver(const AsyncStepOptions &options = AsyncStepOptions());
   /// @brief Set initial state to world
   void FillInitialPicture(const GameOfLifeInitialState &state);
-  /// @brief Check if game is over
+  /// @brief Set initial state to world from alive cells
+  void FillInitialPicture(const std::vector<Point> &alive_cells);
+  /// @brief Add pattern of the library to the world, cells are set by words
+  /// of packed cells and the pattern wraps around the world. Like
+  /// PasteRegion, it edits the current generation
+  ///
+  /// @param row row of the top left corner of the transformed pattern
+  /// @param column column of the top left corner of the transformed pattern
+  void
+  StampPattern(const Pattern &pattern, const std::uint32_t row,
+               const std::uint32_t column,
+               const PatternTransform transform = PatternTransform::Identity);
+  /// @brief Combine cells with the rectangle of the world which has the same
+  /// size and corner at top row and left column, e.g. cells of a region of
+  /// another game. Cells are changed by words of packed cells, hash and
+  /// neighbours are updated once for the operation. The edit is not a
+  /// generation: the edited cells replace the current generation in the
+  /// history, older generations and the termination policy are kept, and
+  /// IsGameOver is false until the next generation is checked
+  void
+  PasteRegion(const PackedGrid &cells, const std::int64_t top_row,
+              const std::int64_t left_column,
+              const RegionOperation operation = RegionOperation::Replace);
+  /// @brief Make cells of the region dead, same as PasteRegion
+  void ClearRegion(const Region &region);
+  /// @brief Copy cells of the region to the rectangle with corner at top row
+  /// and left column, same as PasteRegion
+  void CopyRegion(const Region &region, const std::int64_t top_row,
+                  const std::int64_t left_column);
+  /// @brief Move cells of the region to the rectangle with corner at top row
+  /// and left column, same as PasteRegion
+  void MoveRegion(const Region &region, const std::int64_t top_row,
+                  const std::int64_t left_column);
+  /// @brief Rotate or reflect cells of the region around its corner, same as
+  /// PasteRegion
+  void TransformRegion(const Region &region, const PatternTransform transform);
+  /// @brief return cells packed one bit per cell. The reference must not be
+  /// used while another thread steps the game, use ReadSnapshot instead
+  const PackedGrid &GetPackedCells() const;
+  /// @brief return cells and statistics of the last finished generation.
+  /// Could be called from another thread while the game is stepped, it never
+  /// waits for the step and copies nothing. The snapshot is not changed by
+  /// later generations, holding the guard only delays freeing of replaced
+  /// snapshots. Guards must be released before the game is destroyed
+  ///
+  /// @return guard without a snapshot if snapshots are not enabled
+  SnapshotGuard ReadSnapshot() const;
+  /// @brief return cells of a rectangle of the last finished generation, the
+  /// region wraps around ring borders. Only rows and words of the region are
+  /// read from the snapshot if snapshots are enabled, otherwise from the
+  /// world under a lock which waits for the world update of a step
+  ///
+  /// @return cells packed one bit per cell, row 0 and column 0 is the corner
+  /// of the region
+  PackedGrid QueryRegion(const Region &region) const;
+  /// @brief return runs of alive cells of a rectangle of the current
+  /// generation, same as QueryRegion but run-length encoded
+  std::vector<CellSpan> QueryRegionSpans(const Region &region) const;
+  /// @brief return statistics of the world. Births and deaths are counted
+  /// since the last generation started, for StepGenerations they are the net
+  /// changes of all its generations
+  const WorldStatistics &GetStatistics() const;
+  /// @brief Check if game is over. The termination policy is evaluated once
+  /// per finished generation, so the call is O(1)
   bool IsGameOver();
+  /// @brief return why the game is over, None if it goes on
+  TerminationReason GetTerminationReason() const;
+  /// @brief Replace termination policy, by default the game is over when no
+  /// cells are alive, a world is repeated or after 20 generations. The policy
+  /// is reset and evaluated for the current generation
+  void SetTerminationPolicy(std::unique_ptr<TerminationPolicy> policy);
+  /// @brief return count of calculated generations
+  std::uint32_t GetGenerationsCount() const;
+  /// @brief Split the world into objects and classify them, usually called
+  /// when the game is over. The table of objects is kept between calls, so
+  /// repeated censuses of similar worlds only look objects up. Objects are
+  /// classified only for deterministic totalistic rules of square cells
+  ///
+  /// @return objects and their counts, most frequent first, empty for
+  /// other games
+  std::vector<CensusEntry> TakeCensus();
+  /// @brief return population of blocks of the world at all zoom levels.
+  /// The pyramid is built on first use, later calls update only tiles
+  /// changed since the previous call. The reference must not be used while
+  /// another thread steps the game
+  const PopulationPyramid &GetPopulationPyramid();
+  /// @brief Record every finished generation in a rewind buffer, starting
+  /// with the current one
+  ///
+  /// @param memory_budget bytes of compressed history, older generations
+  /// are dropped, keyframe_interval count of generations between whole
+  /// grids, more generations need less memory but slower access
+  void EnableHistory(const std::size_t memory_budget,
+                     const std::uint32_t keyframe_interval =
+                         RewindBuffer::cDefaultKeyframeInterval);
+  /// @brief Return the world to the generation which is generations before
+  /// the current one. Newer generations are dropped from the history, and
+  /// hashes of previous worlds are forgotten, so stepping forward again does
+  /// not look like a repeated world
+  ///
+  /// @return false if the history is not enabled or the generation is not
+  /// stored anymore
+  bool Rewind(const std::uint32_t generations);
+  /// @brief restore cells of a generation stored in the history
+  ///
+  /// @return false if the generation is not stored
+  bool GetHistoryCells(const std::uint32_t generation,
+                       PackedGrid &cells) const;
+  /// @brief Publish snapshots of every finished generation, starting with
+  /// the current one, for ReadSnapshot, QueryRegion and Draw of other
+  /// threads. Only tiles of cells with births or deaths are copied. Must be
+  /// called before other threads read the game
+  void EnableSnapshots();
+  /// @brief Stream every finished generation to subscribers of a Unix
+  /// domain socket. Publishing copies cells only if there are subscribers
+  /// and never waits for them
+  ///
+  /// @return false if the socket could not be created
+  bool EnableStreaming(const std::string &socket_path,
+                       const FrameServerSettings &server_settings =
+                           FrameServerSettings());
+  /// @brief Periodically dump metrics to the file. Metrics are collected
+  /// only if the game is built with GAME_OF_LIFE_METRICS option
+  ///
+  /// @param file_path output file, format json or prometheus text,
+  /// period_generations count of generations between two dumps
+  void EnableMetricsExport(const std::string &file_path,
+                           const MetricsFormat format,
+                           const std::uint32_t period_generations);
+  /// @brief return collected metrics
+  const GameMetrics &GetMetrics() const;
+  /// @brief return continuous cells of the Continuous engine, they could be
+  /// changed between generations. Drawing, region queries, history and
+  /// streaming see cells which are at least alive_level as alive
+  ///
+  /// @return nullptr for other engines
+  ContinuousWorld *GetContinuousWorld();
+  /// @brief return continuous cells, nullptr for other engines
+  const ContinuousWorld *GetContinuousWorld() const;
 
 private:
   /// @brief In case of multithread run, update cell state in one of (several)
   /// threads
   void ProcessCellsThread(std::uint32_t thread_num);
+  /// @brief Pin worker thread to its core and allocate rows of the thread
+  void PlaceThread(std::uint32_t thread_num);
   /// @brief Run the generation multithreaded
   void ExecuteNextGenerationMultithreaded();
   /// @brief Run the generation in single thread
   void ExecuteNextGenerationSinglehread();
+  /// @brief Step packed cells with the engine, apply them to the world and
+  /// count generations
+  void ExecuteGenerationsWithEngine(const std::uint32_t generations);
+  /// @brief Hash the world, check termination and update metrics of
+  /// counted generations
+  void FinishGenerations();
+  ///
+  /// @brief The AsyncStepJob stores state of an asynchronous step between
+  /// its slices
+  ///
+  struct AsyncStepJob {
+    /// @brief count of generations to calculate, ignored if until_game_over
+    std::uint32_t generations;
+    bool until_game_over;
+    AsyncStepOptions options;
+    /// @brief time when the budget is exhausted
+    std::chrono::steady_clock::time_point deadline;
+    /// @brief count of calculated generations
+    std::uint32_t done;
+    std::promise<StepResult> promise;
+  };
+
+  /// @brief queue job on its executor
+  std::future<StepResult> StartAsyncStep(std::shared_ptr<AsyncStepJob> job);
+  /// @brief calculate up to cAsyncSliceGenerations generations of the job
+  ///
+  /// @return true if the job is not finished
+  bool ExecuteAsyncSlice(AsyncStepJob &job);
+  /// @brief set result of the job and allow next asynchronous steps
+  void FinishAsyncStep(AsyncStepJob &job, const StepStatus status);
+  /// @brief Pass counters of the current generation to the termination
+  /// policy
+  void UpdateTermination();
+  /// @brief Restart hashes, termination, history and streaming after the
+  /// initial cells are set
+  void StartInitialPicture();
+  /// @brief Store the edited current generation in the history and publish
+  /// it without restarting the game
+  void FinishEdit();
+  /// @brief Publish snapshot and stream frame of the current generation
+  void PublishGeneration();
+  /// @brief return copy of the world rows which a region operation of rows
+  /// from top row could change, rows outside of limited borders are left
+  /// out
+  ///
+  /// @param window_top world row of the first copied row, so the region
+  /// starts at row top_row - window_top of the copy
+  PackedGrid ReadRegionRows(const std::int64_t top_row,
+                            const std::uint32_t rows,
+                            const CellBordersRule borders_rule,
+                            std::int64_t &window_top) const;
+  /// @brief Replace cells of the world rows by rows of ReadRegionRows
+  void ReplaceRegionRows(const PackedGrid &rows,
+                         const std::int64_t window_top);
+  /// @brief Combine cells with the rectangle of the world, only rows of the
+  /// rectangle are copied and replaced
+  void WriteRegionRows(const PackedGrid &cells, const std::int64_t top_row,
+                       const std::int64_t left_column,
+                       const RegionOperation operation);
   /// @brief Call updates of the world with new cell states (add alive, delete
   /// alive)
   void
   UpdateWorldWithNewCellStates(const std::vector<CellData> &new_cell_states);
 
+  ///
+  /// @brief The CellStatesScratch stores new cell states of one thread. It is
+  /// cleared, but not freed between generations, so after first generations
+  /// no allocations are done
+  ///
+  struct alignas(cCacheLineSize) CellStatesScratch {
+    std::vector<CellData> new_cell_states;
+  };
+
   /// @brief world for the game
   World world;
   /// @brief helper to create initial world
@@ -72,10 +375,54 @@ private:
   std::unique_ptr<WorldDrawer> drawer;
   /// @brief default rules
   std::unique_ptr<GameRules> rules;
+  /// @brief decides when the game is over
+  std::unique_ptr<TerminationPolicy> termination;
+  /// @brief result of the termination policy for the current generation
+  TerminationReason termination_reason;
+  /// @brief per-phase timers and counters
+  std::unique_ptr<GameMetrics> metrics;
+  /// @brief periodic metrics dump, empty if export is not enabled
+  std::unique_ptr<MetricsExporter> metrics_exporter;
   /// @brief current count of generations
   std::uint32_t generations_count;
+  /// @brief settings of the game execution
+  const GameOfLifeSettings settings;
+  /// @brief true if ExecuteNextGeneration calculates cells of the world,
+  /// false if it uses the engine, e.g. for rules which counts of
+  /// neighbours don't define
+  bool is_per_cell;
   /// @brief If true run generation of new world in several threads
   bool multithread;
+  /// @brief new cell states of every thread, last one is used by the control
+  /// thread in single thread run
+  std::vector<CellStatesScratch, CacheAlignedAllocator<CellStatesScratch>>
+      scratch;
+  /// @brief census of objects, created on first use
+  std::unique_ptr<ObjectCensus> census;
+  /// @brief population of blocks for zoomed out views, created on first use
+  std::unique_ptr<PopulationPyramid> population_pyramid;
+  /// @brief snapshots of finished generations for readers of other threads,
+  /// empty if snapshots are not enabled
+  std::unique_ptr<SnapshotPublisher> snapshots;
+  /// @brief cells, statistics and count of generations are written under
+  /// exclusive lock and read by Draw and QueryRegion without snapshots under
+  /// shared lock
+  mutable boost::shared_mutex world_cells_mutex;
+  /// @brief server of generation frames, empty if streaming is not enabled
+  std::unique_ptr<FrameServer> frame_server;
+  /// @brief history of generations, empty if it is not enabled
+  std::unique_ptr<RewindBuffer> history;
+  /// @brief true while an asynchronous step of the game runs
+  std::atomic<bool> is_async_step_running;
+  /// @brief engine of packed generations
+  std::unique_ptr<GenerationEngine> engine;
+  /// @brief engine of continuous cells, owned by engine, nullptr for other
+  /// engines
+  LeniaEngine *continuous_engine;
+  /// @brief cells stepped by the engine, reused between calls
+  PackedGrid engine_cells;
+  /// @brief splits world rows between threads
+  std::unique_ptr<RowPartitioner> partitioner;
   /// @brief thread group
   boost::thread_group thread_group;
   /// @brief semaphores which are sent to each thread to srart processing
@@ -86,6 +433,8 @@ private:
   std::uint32_t thread_finished_count;
   /// @brief count of threads which have already prepared data for calculations
   std::uint32_t threads_preparation_finished_count;
+  /// @brief count of threads which have already allocated their rows
+  std::uint32_t threads_allocation_finished_count;
   /// @brief count of threads which we execute
   std::uint32_t threads_count;
   /// @brief conditional wait while cell states are processed
@@ -101,6 +450,9 @@ private:
   const std::uint32_t cMaxThreadCount = 100;
   /// @brief minimum points in game, when we start multithreading
   const std::uint32_t cMinPointsForMultithreading = 40;
+  /// @brief count of generations of an asynchronous step before other games
+  /// of the executor get their turn
+  const std::uint32_t cAsyncSliceGenerations = 16;
 };
 
 #endif // INCLUDE_GAME_OF_LIFE_H_
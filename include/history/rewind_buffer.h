@@ -0,0 +1,92 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_HISTORY_REWIND_BUFFER_H_
+#define INCLUDE_HISTORY_REWIND_BUFFER_H_
+#include "packed_grid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+///
+/// @brief The RewindBuffer stores history of generations in a fixed memory
+/// budget. Every keyframe_interval frames a whole grid is stored, other
+/// frames are XOR deltas to the previous frame; both are compressed with
+/// ZeroRunCodec. A generation is restored from the keyframe before it and
+/// at most keyframe_interval - 1 deltas. When the budget is exceeded, the
+/// oldest keyframe with its deltas is dropped
+///
+class RewindBuffer {
+public:
+  /// @brief RewindBuffer is initialized with memory budget of compressed
+  /// frames and count of frames between keyframes
+  RewindBuffer(
+      const std::size_t memory_budget,
+      const std::uint32_t keyframe_interval = cDefaultKeyframeInterval);
+  /// @brief store grid of generation, which must not be smaller than the
+  /// newest stored generation. A grid of the newest generation replaces it,
+  /// e.g. after cells are edited. A grid of another size clears the history
+  void Push(const std::uint32_t generation, const PackedGrid &grid);
+  /// @brief restore grid of a stored generation
+  ///
+  /// @return false if the generation is not stored
+  bool Get(const std::uint32_t generation, PackedGrid &grid) const;
+  /// @brief drop generations newer than generation, e.g. after rewind
+  void Truncate(const std::uint32_t generation);
+  /// @brief drop all generations
+  void Clear();
+  /// @brief true if no generation is stored
+  bool IsEmpty() const;
+  /// @brief return the oldest and the newest stored generations, 0 if empty
+  std::uint32_t GetOldestGeneration() const;
+  std::uint32_t GetNewestGeneration() const;
+  /// @brief return count of stored generations
+  std::size_t GetFramesCount() const;
+  /// @brief return bytes of compressed frames
+  std::size_t GetMemoryUsage() const;
+
+  /// @brief frames between keyframes if not specified
+  static constexpr std::uint32_t cDefaultKeyframeInterval = 32;
+
+private:
+  ///
+  /// @brief The Frame is one compressed generation
+  ///
+  struct Frame {
+    std::uint32_t generation;
+    /// @brief true for whole grid, false for XOR delta to previous frame
+    bool is_keyframe;
+    std::vector<std::uint8_t> data;
+  };
+
+  /// @brief replace grid of the newest frame, a delta stays a delta to the
+  /// frame before it
+  void ReplaceNewest(const PackedGrid &grid);
+  /// @brief return index of the frame of generation or frames.size()
+  std::size_t FindFrame(const std::uint32_t generation) const;
+  /// @brief return bytes used by frame
+  static std::size_t GetFrameSize(const Frame &frame);
+  /// @brief drop the oldest keyframe and its deltas while the budget is
+  /// exceeded, the newest keyframe is always kept
+  void EnforceBudget();
+
+  /// @brief maximum bytes of frames
+  const std::size_t cMemoryBudget;
+  /// @brief count of frames from one keyframe to the next
+  const std::uint32_t cKeyframeInterval;
+  /// @brief frames ordered by generation, the first one is a keyframe
+  std::deque<Frame> frames;
+  /// @brief count of frames since the newest keyframe
+  std::uint32_t frames_since_keyframe;
+  /// @brief bytes of frames
+  std::size_t memory_usage;
+  /// @brief grid of the newest frame, deltas are taken to it
+  PackedGrid newest;
+  /// @brief XOR of the newest grid and a new grid, reused between pushes
+  std::vector<std::uint64_t> delta;
+};
+
+#endif // INCLUDE_HISTORY_REWIND_BUFFER_H_
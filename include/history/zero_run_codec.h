@@ -0,0 +1,38 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_HISTORY_ZERO_RUN_CODEC_H_
+#define INCLUDE_HISTORY_ZERO_RUN_CODEC_H_
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The ZeroRunCodec compresses 64 bit words which are mostly zero,
+/// like XOR deltas of two generations or sparse worlds. Data is a sequence
+/// of pairs: varint count of zero words, varint count of literal words
+/// followed by the literal words. Encoding and decoding is one pass without
+/// tables, a dead word costs less than a bit
+///
+class ZeroRunCodec {
+public:
+  /// @brief append encoded words to data
+  static void Encode(const std::uint64_t *words, const std::size_t count,
+                     std::vector<std::uint8_t> &data);
+  /// @brief XOR decoded words into words, so a delta is applied directly
+  /// and a keyframe is decoded into zero words
+  ///
+  /// @return false if data is corrupted or has another count of words
+  static bool DecodeXor(const std::vector<std::uint8_t> &data,
+                        std::uint64_t *words, const std::size_t count);
+
+private:
+  /// @brief append value with 7 bits per byte
+  static void WriteVarint(std::uint64_t value, std::vector<std::uint8_t> &data);
+  /// @brief read value at position and move position behind it
+  static bool ReadVarint(const std::vector<std::uint8_t> &data,
+                         std::size_t &position, std::uint64_t &value);
+};
+
+#endif // INCLUDE_HISTORY_ZERO_RUN_CODEC_H_
@@ -0,0 +1,207 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_INITIAL_FIGURES_PATTERN_LIBRARY_H_
+#define INCLUDE_INITIAL_FIGURES_PATTERN_LIBRARY_H_
+#include "packed_grid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///
+/// @brief The Pattern is a bitmap of a known figure, bit N of row word is
+/// the cell at column N. Patterns are at most 64x64 cells
+///
+struct Pattern {
+  /// @brief name of the pattern in the library
+  const char *name;
+  /// @brief rows and columns count of the bounding box
+  std::uint32_t rows, columns;
+  /// @brief one word per row
+  const std::uint64_t *cells;
+};
+
+///
+/// @brief The PatternTransform enumerates rotations and reflections of a
+/// pattern, rotations are clockwise
+///
+enum class PatternTransform {
+  Identity,
+  Rotate90,
+  Rotate180,
+  Rotate270,
+  FlipHorizontal,
+  FlipVertical,
+  Transpose,
+  AntiTranspose
+};
+
+namespace pattern_bitmap {
+/// @brief return bits of a row written as text, 'O' is alive cell and '.'
+/// is dead cell
+constexpr std::uint64_t Row(const char *row, const std::uint32_t column = 0) {
+  return row[column] == '\0'
+             ? 0
+             : column >= 64
+                   ? throw std::length_error("Pattern row is too long")
+                   : (static_cast<std::uint64_t>(row[column] == 'O')
+                      << column) |
+                         Row(row, column + 1);
+}
+
+/// @brief return count of used bits of the word
+constexpr std::uint32_t GetBitWidth(const std::uint64_t word) {
+  return word == 0 ? 0 : 1 + GetBitWidth(word >> 1);
+}
+
+/// @brief return count of columns of rows
+constexpr std::uint32_t GetWidth(const std::uint64_t *cells,
+                                 const std::size_t rows) {
+  return rows == 0 ? 0
+                   : GetBitWidth(cells[rows - 1]) > GetWidth(cells, rows - 1)
+                         ? GetBitWidth(cells[rows - 1])
+                         : GetWidth(cells, rows - 1);
+}
+
+/// @brief return pattern of rows, columns are the bounding box of cells
+template <std::size_t rows>
+constexpr Pattern Make(const char *name, const std::uint64_t (&cells)[rows]) {
+  static_assert(rows <= 64, "Pattern has more than 64 rows");
+  return Pattern{name, static_cast<std::uint32_t>(rows),
+                 GetWidth(cells, rows), cells};
+}
+
+///
+/// @brief The Cells are bitmaps of the patterns of the library
+///
+struct Cells {
+  static constexpr std::uint64_t cBlock[] = {Row("OO"), Row("OO")};
+  static constexpr std::uint64_t cBeehive[] = {Row(".OO."), Row("O..O"),
+                                               Row(".OO.")};
+  static constexpr std::uint64_t cLoaf[] = {Row(".OO."), Row("O..O"),
+                                            Row(".O.O"), Row("..O.")};
+  static constexpr std::uint64_t cBoat[] = {Row("OO."), Row("O.O"), Row(".O.")};
+  static constexpr std::uint64_t cBlinker[] = {Row("OOO")};
+  static constexpr std::uint64_t cToad[] = {Row(".OOO"), Row("OOO.")};
+  static constexpr std::uint64_t cBeacon[] = {Row("OO.."), Row("O..."),
+                                              Row("...O"), Row("..OO")};
+  static constexpr std::uint64_t cPulsar[] = {
+      Row("..OOO...OOO.."), Row("............."), Row("O....O.O....O"),
+      Row("O....O.O....O"), Row("O....O.O....O"), Row("..OOO...OOO.."),
+      Row("............."), Row("..OOO...OOO.."), Row("O....O.O....O"),
+      Row("O....O.O....O"), Row("O....O.O....O"), Row("............."),
+      Row("..OOO...OOO..")};
+  static constexpr std::uint64_t cPentadecathlon[] = {
+      Row("..O....O.."), Row("OO.OOOO.OO"), Row("..O....O..")};
+  static constexpr std::uint64_t cGlider[] = {Row(".O."), Row("..O"),
+                                              Row("OOO")};
+  static constexpr std::uint64_t cLightweightSpaceship[] = {
+      Row(".O..O"), Row("O...."), Row("O...O"), Row("OOOO.")};
+  static constexpr std::uint64_t cRPentomino[] = {Row(".OO"), Row("OO."),
+                                                  Row(".O.")};
+  static constexpr std::uint64_t cAcorn[] = {Row(".O....."), Row("...O..."),
+                                             Row("OO..OOO")};
+  static constexpr std::uint64_t cDiehard[] = {
+      Row("......O."), Row("OO......"), Row(".O...OOO")};
+  static constexpr std::uint64_t cGosperGliderGun[] = {
+      Row("........................O..........."),
+      Row("......................O.O..........."),
+      Row("............OO......OO............OO"),
+      Row("...........O...O....OO............OO"),
+      Row("OO........O.....O...OO.............."),
+      Row("OO........O...O.OO....O.O..........."),
+      Row("..........O.....O.......O..........."),
+      Row("...........O...O...................."),
+      Row("............OO......................")};
+  static constexpr std::uint64_t cBlockLayingSwitchEngine[] = {
+      Row("OOO.O"), Row("O...."), Row("...OO"), Row(".OO.O"), Row("O.O.O")};
+};
+} // namespace pattern_bitmap
+
+///
+/// @brief The PatternLibrary contains standard patterns which are built at
+/// compile time, and stamps them into packed cells
+///
+class PatternLibrary {
+public:
+  /// @brief still life of 4 cells
+  static constexpr Pattern cBlock =
+      pattern_bitmap::Make("block", pattern_bitmap::Cells::cBlock);
+  /// @brief still life of 6 cells
+  static constexpr Pattern cBeehive =
+      pattern_bitmap::Make("beehive", pattern_bitmap::Cells::cBeehive);
+  /// @brief still life of 7 cells
+  static constexpr Pattern cLoaf =
+      pattern_bitmap::Make("loaf", pattern_bitmap::Cells::cLoaf);
+  /// @brief still life of 5 cells
+  static constexpr Pattern cBoat =
+      pattern_bitmap::Make("boat", pattern_bitmap::Cells::cBoat);
+  /// @brief oscillator of period 2
+  static constexpr Pattern cBlinker =
+      pattern_bitmap::Make("blinker", pattern_bitmap::Cells::cBlinker);
+  /// @brief oscillator of period 2
+  static constexpr Pattern cToad =
+      pattern_bitmap::Make("toad", pattern_bitmap::Cells::cToad);
+  /// @brief oscillator of period 2
+  static constexpr Pattern cBeacon =
+      pattern_bitmap::Make("beacon", pattern_bitmap::Cells::cBeacon);
+  /// @brief oscillator of period 3
+  static constexpr Pattern cPulsar =
+      pattern_bitmap::Make("pulsar", pattern_bitmap::Cells::cPulsar);
+  /// @brief oscillator of period 15
+  static constexpr Pattern cPentadecathlon = pattern_bitmap::Make(
+      "pentadecathlon", pattern_bitmap::Cells::cPentadecathlon);
+  /// @brief spaceship moving down and right by 1 cell in 4 generations
+  static constexpr Pattern cGlider =
+      pattern_bitmap::Make("glider", pattern_bitmap::Cells::cGlider);
+  /// @brief spaceship moving left by 2 cells in 4 generations
+  static constexpr Pattern cLightweightSpaceship = pattern_bitmap::Make(
+      "lightweight_spaceship", pattern_bitmap::Cells::cLightweightSpaceship);
+  /// @brief methuselah which stabilizes after 1103 generations
+  static constexpr Pattern cRPentomino = pattern_bitmap::Make(
+      "r_pentomino", pattern_bitmap::Cells::cRPentomino);
+  /// @brief methuselah which stabilizes after 5206 generations
+  static constexpr Pattern cAcorn =
+      pattern_bitmap::Make("acorn", pattern_bitmap::Cells::cAcorn);
+  /// @brief methuselah which dies after 130 generations
+  static constexpr Pattern cDiehard =
+      pattern_bitmap::Make("diehard", pattern_bitmap::Cells::cDiehard);
+  /// @brief gun emitting a glider every 30 generations
+  static constexpr Pattern cGosperGliderGun = pattern_bitmap::Make(
+      "gosper_glider_gun", pattern_bitmap::Cells::cGosperGliderGun);
+  /// @brief puffer leaving a trail of blocks, it grows forever
+  static constexpr Pattern cBlockLayingSwitchEngine =
+      pattern_bitmap::Make("block_laying_switch_engine",
+                           pattern_bitmap::Cells::cBlockLayingSwitchEngine);
+
+  /// @brief return all patterns of the library
+  static const std::vector<Pattern> &GetPatterns();
+  /// @brief return pattern by name
+  ///
+  /// @return nullptr if there is no such pattern
+  static const Pattern *FindPattern(const std::string &name);
+  /// @brief return cells of the pattern
+  static PackedGrid GetCells(const Pattern &pattern);
+  /// @brief return rows of the transformed pattern, one word per row
+  ///
+  /// @param rows rows count of the transformed pattern
+  /// @param columns columns count of the transformed pattern
+  static std::vector<std::uint64_t>
+  GetTransformedCells(const Pattern &pattern, const PatternTransform transform,
+                      std::uint32_t &rows, std::uint32_t &columns);
+  /// @brief make cells of the transformed pattern alive, other cells are not
+  /// changed. Rows are ORed up to 64 cells at once, the pattern wraps around
+  /// the grid like ring borders
+  ///
+  /// @param row row of the top left corner of the transformed pattern
+  /// @param column column of the top left corner of the transformed pattern
+  static void Stamp(PackedGrid &grid, const Pattern &pattern,
+                    const PatternTransform transform, const std::uint32_t row,
+                    const std::uint32_t column);
+};
+
+#endif // INCLUDE_INITIAL_FIGURES_PATTERN_LIBRARY_H_
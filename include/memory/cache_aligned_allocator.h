@@ -0,0 +1,50 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_MEMORY_CACHE_ALIGNED_ALLOCATOR_H_
+#define INCLUDE_MEMORY_CACHE_ALIGNED_ALLOCATOR_H_
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/// @brief size of cache line, per-thread data is aligned to it
+constexpr std::size_t cCacheLineSize = 64;
+
+///
+/// @brief The CacheAlignedAllocator allocates storage aligned to cache line,
+/// so per-thread elements of a vector do not share cache lines. It is needed
+/// because standard allocator ignores over-alignment before C++17
+///
+template <typename T> class CacheAlignedAllocator {
+public:
+  using value_type = T;
+
+  CacheAlignedAllocator() = default;
+  template <typename U>
+  CacheAlignedAllocator(const CacheAlignedAllocator<U> &) {}
+
+  T *allocate(const std::size_t count) {
+    void *data = nullptr;
+    if (posix_memalign(&data, cCacheLineSize, count * sizeof(T))) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(data);
+  }
+
+  void deallocate(T *data, const std::size_t) { std::free(data); }
+};
+
+template <typename T, typename U>
+bool operator==(const CacheAlignedAllocator<T> &,
+                const CacheAlignedAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const CacheAlignedAllocator<T> &,
+                const CacheAlignedAllocator<U> &) {
+  return false;
+}
+
+#endif // INCLUDE_MEMORY_CACHE_ALIGNED_ALLOCATOR_H_
@@ -0,0 +1,52 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_MEMORY_HUGE_PAGE_BUFFER_H_
+#define INCLUDE_MEMORY_HUGE_PAGE_BUFFER_H_
+#include <cstddef>
+
+///
+/// @brief The HugePageMode describes which pages back the buffer
+/// Explicit pages are taken from the reserved huge page pool, Transparent
+/// pages are requested from the kernel with madvise, Disabled means regular
+/// pages
+///
+enum class HugePageMode { Explicit, Transparent, Disabled };
+
+///
+/// @brief The HugePageBuffer owns a memory region mapped with huge pages if
+/// it is possible, falling back to transparent huge pages and then to
+/// regular pages. Memory is not touched by the buffer, so pages are placed
+/// on the NUMA node of the thread which writes them first
+///
+class HugePageBuffer {
+public:
+  /// @brief Map region of at least size bytes
+  explicit HugePageBuffer(const std::size_t size);
+  /// @brief Unmap region
+  ~HugePageBuffer();
+  HugePageBuffer(const HugePageBuffer &) = delete;
+  HugePageBuffer &operator=(const HugePageBuffer &) = delete;
+
+  /// @brief return pointer to the beginning of the region, nullptr if
+  /// mapping failed
+  void *GetData() const;
+  /// @brief return size of the mapped region
+  std::size_t GetSize() const;
+  /// @brief return type of pages which back the region
+  HugePageMode GetMode() const;
+
+private:
+  /// @brief beginning of the region
+  void *data;
+  /// @brief size of the region
+  std::size_t size;
+  /// @brief type of pages
+  HugePageMode mode;
+
+  /// @brief size of one huge page
+  static constexpr std::size_t cHugePageSize = 2 * 1024 * 1024;
+};
+
+#endif // INCLUDE_MEMORY_HUGE_PAGE_BUFFER_H_
@@ -0,0 +1,131 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_MEMORY_MAPPED_WORLD_H_
+#define INCLUDE_MEMORY_MAPPED_WORLD_H_
+#include "rules/rule_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+///
+/// @brief The MappedWorld stores packed cells of a world in a memory mapped
+/// file, so the world could be bigger than memory. The file is a header and
+/// rows one after another, every row starts with a new 64 bit word like rows
+/// of PackedGrid. Generations are calculated in place by one sequential
+/// sweep over rows: only a window of old rows and the first row for ring
+/// borders are kept in memory, rows ahead of the sweep are read ahead and
+/// written rows behind it are handed to the page cache for writeback. The
+/// header is marked while rows are overwritten, so a file left by a crash in
+/// the middle of a sweep, which has rows of two generations, is not opened
+///
+class MappedWorld {
+public:
+  /// @brief create file of a world of dead cells, an existing file is
+  /// replaced
+  ///
+  /// @param readahead_rows count of rows read ahead of the sweep, 0 to read
+  /// ahead cReadaheadBytes
+  ///
+  /// @return nullptr if the file can't be created or mapped
+  static std::unique_ptr<MappedWorld>
+  Create(const std::string &path, const std::uint32_t rows,
+         const std::uint32_t columns, const std::uint32_t readahead_rows = 0);
+  /// @brief open file of a world created by Create
+  ///
+  /// @return nullptr if the file can't be opened, it is not a world or its
+  /// last sweep was not finished
+  static std::unique_ptr<MappedWorld>
+  Open(const std::string &path, const std::uint32_t readahead_rows = 0);
+  /// @brief flush and unmap the file
+  ~MappedWorld();
+  MappedWorld(const MappedWorld &) = delete;
+  MappedWorld &operator=(const MappedWorld &) = delete;
+
+  /// @brief return count of rows
+  std::uint32_t GetRowCount() const;
+  /// @brief return count of columns
+  std::uint32_t GetColumnCount() const;
+  /// @brief return count of words in one row
+  std::uint32_t GetWordsPerRow() const;
+  /// @brief return count of calculated generations, stored in the file
+  std::uint64_t GetGenerationsCount() const;
+  /// @brief true if cell is alive
+  bool Get(const std::uint32_t row, const std::uint32_t column) const;
+  /// @brief set cell state
+  void Set(const std::uint32_t row, const std::uint32_t column,
+           const bool is_alive);
+  /// @brief return first word of the row
+  std::uint64_t *GetRow(const std::uint32_t row);
+  /// @brief return first word of the constant row
+  const std::uint64_t *GetRow(const std::uint32_t row) const;
+  /// @brief return count of alive cells, reads the file sequentially
+  std::uint64_t CountAlive() const;
+  /// @brief calculate generations by sequential sweeps over the file
+  ///
+  /// @return false if rules are not of square cells or the file can't be
+  /// written
+  bool Step(const TotalisticRuleTable &rule_table,
+            const std::uint32_t generations);
+  /// @brief write changed pages to the file and wait for it
+  bool Flush();
+
+  /// @brief default size of rows read ahead of the sweep
+  static constexpr std::size_t cReadaheadBytes = 8 * 1024 * 1024;
+
+private:
+  ///
+  /// @brief The FileHeader is stored at the beginning of the file
+  ///
+  struct FileHeader {
+    char magic[8];
+    std::uint32_t rows;
+    std::uint32_t columns;
+    std::uint64_t generations_count;
+    /// @brief not 0 while a sweep overwrites rows
+    std::uint32_t is_stepping;
+  };
+
+  /// @brief MappedWorld owns the descriptor and the mapping of the file
+  MappedWorld(const int descriptor, void *data, const std::size_t size,
+              const std::uint32_t readahead_rows);
+  /// @brief map file of the descriptor, size is the size of the file
+  static std::unique_ptr<MappedWorld> Map(const int descriptor,
+                                          const std::size_t size,
+                                          const std::uint32_t readahead_rows);
+  /// @brief write the page of the header to the file and wait for it
+  bool FlushHeader();
+  /// @brief give advice about rows [begin_row, end_row) to the kernel,
+  /// pages are rounded to contain the rows
+  void Advise(const std::uint32_t begin_row, const std::uint32_t end_row,
+              const int advice) const;
+  /// @brief start writeback of rows [begin_row, end_row) and drop them from
+  /// the mapping, the page cache keeps them until they are written
+  void Release(const std::uint32_t begin_row, const std::uint32_t end_row);
+
+  /// @brief file descriptor
+  int descriptor;
+  /// @brief mapped file
+  void *data;
+  /// @brief size of the mapped file
+  std::size_t size;
+  /// @brief header at the beginning of the mapping
+  FileHeader *header;
+  /// @brief first word of the first row
+  std::uint64_t *cells;
+  /// @brief count of words in one row
+  std::uint32_t words_per_row;
+  /// @brief count of rows read ahead and released behind the sweep
+  std::uint32_t readahead_rows;
+
+  /// @brief magic of the file header
+  static constexpr char cMagic[8] = {'G', 'O', 'L', 'W', 'O', 'R', 'L', 'D'};
+  /// @brief offset of the first row, rows are aligned to cache lines
+  static constexpr std::size_t cCellsOffset = 64;
+};
+
+#endif // INCLUDE_MEMORY_MAPPED_WORLD_H_
@@ -0,0 +1,141 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_METRICS_GAME_METRICS_H_
+#define INCLUDE_METRICS_GAME_METRICS_H_
+#include "memory/cache_aligned_allocator.h"
+#include "statistics/world_statistics.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#ifndef GAME_OF_LIFE_METRICS_ENABLED
+#define GAME_OF_LIFE_METRICS_ENABLED 0
+#endif
+
+/// @brief true if instrumentation is compiled in (cmake -DGAME_OF_LIFE_METRICS=ON)
+constexpr bool cMetricsEnabled = GAME_OF_LIFE_METRICS_ENABLED;
+
+///
+/// @brief The GenerationPhase enumerates measured phases of one generation
+///
+enum class GenerationPhase {
+  Evaluation,
+  BarrierWait,
+  UpdateWorld,
+  UpdateHash,
+  Count
+};
+
+///
+/// @brief The GameMetrics accumulates per-phase timers, per-thread busy/idle
+/// time, changed cells and hash table size. Every thread writes only to its
+/// own slot, the last slot belongs to the thread which controls the game
+///
+class GameMetrics {
+public:
+  /// @brief GameMetrics is initialized with count of worker threads
+  explicit GameMetrics(const std::uint32_t threads_count);
+  /// @brief add time spent in phase by thread
+  void AddPhaseTime(const GenerationPhase phase, const std::uint32_t thread_num,
+                    const std::chrono::nanoseconds time);
+  /// @brief add time during which thread did useful work
+  void AddBusyTime(const std::uint32_t thread_num,
+                   const std::chrono::nanoseconds time);
+  /// @brief add time during which thread waited for other threads
+  void AddIdleTime(const std::uint32_t thread_num,
+                   const std::chrono::nanoseconds time);
+  /// @brief add count of cells changed in current generation
+  void AddChangedCells(const std::uint64_t changed_cells_count);
+  /// @brief mark generation as finished
+  ///
+  /// @param generations_count count of generations, hash_table_size count of
+  /// stored world hashes
+  void FinishGeneration(const std::uint32_t generations_count,
+                        const std::uint64_t hash_table_size);
+  /// @brief store statistics of the world after last generation
+  void SetWorldStatistics(const StatisticsSummary &summary);
+  /// @brief return slot of the thread which controls the game
+  std::uint32_t GetControlThreadNum() const;
+  /// @brief return count of finished generations
+  std::uint32_t GetGenerationsCount() const;
+  /// @brief return total time spent in phase by all threads
+  std::chrono::nanoseconds GetPhaseTime(const GenerationPhase phase) const;
+  /// @brief write metrics as json object
+  void WriteJson(std::ostream &stream) const;
+  /// @brief write metrics in prometheus text exposition format
+  void WritePrometheus(std::ostream &stream) const;
+
+private:
+  ///
+  /// @brief The ThreadMetrics stores counters of one thread, aligned to cache
+  /// line to avoid false sharing
+  ///
+  struct alignas(cCacheLineSize) ThreadMetrics {
+    ThreadMetrics();
+    std::atomic<std::uint64_t>
+        phase_nanos[static_cast<std::size_t>(GenerationPhase::Count)];
+    std::atomic<std::uint64_t> busy_nanos;
+    std::atomic<std::uint64_t> idle_nanos;
+  };
+
+  /// @brief counters of threads, last one belongs to the control thread
+  std::vector<ThreadMetrics, CacheAlignedAllocator<ThreadMetrics>>
+      threads_metrics;
+  /// @brief count of changed cells in all generations
+  std::atomic<std::uint64_t> changed_cells_count;
+  /// @brief count of changed cells in last finished generation
+  std::atomic<std::uint64_t> last_changed_cells_count;
+  /// @brief count of changed cells in current generation
+  std::atomic<std::uint64_t> current_changed_cells_count;
+  /// @brief statistics of the world after last generation
+  StatisticsSummary world_statistics;
+  /// @brief size of hash table after last generation
+  std::uint64_t hash_table_size;
+  /// @brief count of finished generations
+  std::uint32_t generations_count;
+};
+
+///
+/// @brief The ScopedPhaseTimer adds time between its construction and
+/// destruction to the phase. It does nothing if metrics are not compiled in
+///
+class ScopedPhaseTimer {
+public:
+  ScopedPhaseTimer(GameMetrics &metrics, const GenerationPhase phase,
+                   const std::uint32_t thread_num);
+  ~ScopedPhaseTimer();
+
+private:
+  GameMetrics &metrics;
+  const GenerationPhase phase;
+  const std::uint32_t thread_num;
+  std::chrono::steady_clock::time_point start;
+};
+
+inline ScopedPhaseTimer::ScopedPhaseTimer(GameMetrics &metrics,
+                                          const GenerationPhase phase,
+                                          const std::uint32_t thread_num)
+    : metrics(metrics), phase(phase), thread_num(thread_num) {
+  if (cMetricsEnabled) {
+    start = std::chrono::steady_clock::now();
+  }
+}
+
+inline ScopedPhaseTimer::~ScopedPhaseTimer() {
+  if (cMetricsEnabled) {
+    const auto time = std::chrono::steady_clock::now() - start;
+    metrics.AddPhaseTime(phase, thread_num, time);
+    if (phase == GenerationPhase::BarrierWait) {
+      metrics.AddIdleTime(thread_num, time);
+    } else {
+      metrics.AddBusyTime(thread_num, time);
+    }
+  }
+}
+
+#endif // INCLUDE_METRICS_GAME_METRICS_H_
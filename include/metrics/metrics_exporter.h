@@ -0,0 +1,48 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_METRICS_METRICS_EXPORTER_H_
+#define INCLUDE_METRICS_METRICS_EXPORTER_H_
+#include "game_metrics.h"
+
+#include <string>
+
+///
+/// @brief The MetricsFormat enumerates formats of the metrics dump
+///
+enum class MetricsFormat { Json, Prometheus };
+
+///
+/// @brief The MetricsExporter periodically dumps metrics to a file. The file
+/// is replaced atomically, so readers never see a partially written dump
+///
+class MetricsExporter {
+public:
+  /// @brief MetricsExporter is initialized with output file, format and
+  /// period in generations
+  MetricsExporter(const std::string &file_path, const MetricsFormat format,
+                  const std::uint32_t period_generations);
+  /// @brief Dump metrics if period is over
+  ///
+  /// @param metrics metrics to dump
+  ///
+  /// @return true if metrics were written
+  bool OnGeneration(const GameMetrics &metrics);
+  /// @brief Dump metrics unconditionally
+  ///
+  /// @return true if metrics were written
+  bool Export(const GameMetrics &metrics);
+
+private:
+  /// @brief file to write metrics to
+  const std::string cFilePath;
+  /// @brief format of the dump
+  const MetricsFormat cFormat;
+  /// @brief count of generations between two dumps
+  const std::uint32_t cPeriodGenerations;
+  /// @brief count of generations at the moment of last dump
+  std::uint32_t last_exported_generation;
+};
+
+#endif // INCLUDE_METRICS_METRICS_EXPORTER_H_
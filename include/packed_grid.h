@@ -0,0 +1,57 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_PACKED_GRID_H_
+#define INCLUDE_PACKED_GRID_H_
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The PackedGrid stores one bit per cell. Every row starts with a new
+/// 64 bit word, bit N % 64 of word N / 64 is the cell at column N. Unused
+/// bits of the last word of a row are always 0
+///
+class PackedGrid {
+public:
+  /// @brief create empty grid
+  PackedGrid();
+  /// @brief create grid of dead cells
+  PackedGrid(const std::uint32_t rows, const std::uint32_t columns);
+  /// @brief return count of rows
+  std::uint32_t GetRowCount() const;
+  /// @brief return count of columns
+  std::uint32_t GetColumnCount() const;
+  /// @brief return count of words in one row
+  std::uint32_t GetWordsPerRow() const;
+  /// @brief return mask of used bits in the last word of a row
+  std::uint64_t GetLastWordMask() const;
+  /// @brief true if cell is alive
+  bool Get(const std::uint32_t row, const std::uint32_t column) const;
+  /// @brief set cell state
+  void Set(const std::uint32_t row, const std::uint32_t column,
+           const bool is_alive);
+  /// @brief return first word of the row
+  std::uint64_t *GetRow(const std::uint32_t row);
+  /// @brief return first word of the constant row
+  const std::uint64_t *GetRow(const std::uint32_t row) const;
+  /// @brief return all words, rows one after another
+  const std::uint64_t *GetData() const;
+  /// @brief make all cells dead
+  void Clear();
+  /// @brief return count of alive cells
+  std::uint64_t CountAlive() const;
+  /// @brief true if sizes and cells are equal
+  bool operator==(const PackedGrid &other) const;
+  bool operator!=(const PackedGrid &other) const;
+
+private:
+  /// @brief rows and columns count
+  std::uint32_t rows, columns;
+  /// @brief count of words in one row
+  std::uint32_t words_per_row;
+  /// @brief cells
+  std::vector<std::uint64_t> words;
+};
+
+#endif // INCLUDE_PACKED_GRID_H_
@@ -0,0 +1,55 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_PARTITION_ROW_PARTITIONER_H_
+#define INCLUDE_PARTITION_ROW_PARTITIONER_H_
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The RowRange describes rows [begin_row, end_row) of the world
+///
+struct RowRange {
+  std::uint32_t begin_row;
+  std::uint32_t end_row;
+};
+
+///
+/// @brief The RowPartitioner splits world rows into contiguous ranges, one
+/// range per thread. Every row belongs to exactly one range. Ranges could be
+/// rebalanced according to the cost measured for each range
+///
+class RowPartitioner {
+public:
+  /// @brief RowPartitioner splits rows into parts_count ranges of equal size
+  RowPartitioner(const std::uint32_t rows, const std::uint32_t parts_count);
+  /// @brief return range of rows for the part
+  RowRange GetRange(const std::uint32_t part) const;
+  /// @brief return count of parts
+  std::uint32_t GetPartsCount() const;
+  /// @brief store cost measured for the part in the last generation. Each
+  /// thread sets cost only for its own part
+  void SetMeasuredCost(const std::uint32_t part, const double cost);
+  /// @brief move range borders to give all parts equal estimated cost. Rows
+  /// cost is estimated from measured cost of the part which owned the row
+  void Rebalance();
+
+private:
+  /// @brief split rows to ranges of equal size
+  void SplitEqually();
+
+  /// @brief ranges of rows, one per part
+  std::vector<RowRange> ranges;
+  /// @brief cost measured for each part in the last generation
+  std::vector<double> measured_costs;
+  /// @brief smoothed cost estimation for each row
+  std::vector<double> row_costs;
+
+  /// @brief count of rows in the world
+  const std::uint32_t cRowsCount;
+  /// @brief weight of the newest measurement in smoothed row cost
+  const double cCostSmoothing = 0.5;
+};
+
+#endif // INCLUDE_PARTITION_ROW_PARTITIONER_H_
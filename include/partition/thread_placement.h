@@ -0,0 +1,32 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_PARTITION_THREAD_PLACEMENT_H_
+#define INCLUDE_PARTITION_THREAD_PLACEMENT_H_
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The ThreadPlacement pins threads to cores. Cores are ordered by
+/// NUMA node, so threads with neighbour numbers (and neighbour row ranges)
+/// are placed on the same socket
+///
+class ThreadPlacement {
+public:
+  /// @brief return cores available for the process, ordered by NUMA node
+  static std::vector<std::uint32_t> GetCoresOrderedByNode();
+  /// @brief pin calling thread to one of the available cores
+  ///
+  /// @param thread_num number of the thread, threads are distributed over
+  /// cores round robin
+  ///
+  /// @return true if thread is pinned
+  static bool PinCurrentThread(const std::uint32_t thread_num);
+
+private:
+  /// @brief return NUMA node of the core, 0 if it is unknown
+  static std::uint32_t GetNodeOfCore(const std::uint32_t core);
+};
+
+#endif // INCLUDE_PARTITION_THREAD_PLACEMENT_H_
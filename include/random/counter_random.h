@@ -0,0 +1,45 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RANDOM_COUNTER_RANDOM_H_
+#define INCLUDE_RANDOM_COUNTER_RANDOM_H_
+#include <cstdint>
+
+///
+/// @brief The CounterRandom returns random words which are a hash of seed,
+/// generation and counter instead of a state of a generator, so the same
+/// cell gets the same random bits in any order of calculation, in any
+/// thread and tile
+///
+class CounterRandom {
+public:
+  /// @brief return 64 random bits of the counter
+  static std::uint64_t GetWord(const std::uint64_t seed,
+                               const std::uint64_t generation,
+                               const std::uint64_t counter);
+  /// @brief return threshold of GetBernoulliWord for the probability,
+  /// clamped to [0, 1]
+  static std::uint64_t GetThreshold(const double probability);
+  /// @brief return word whose bits are set with probability of the
+  /// threshold. Bit-sliced comparison of 64 random numbers with the
+  /// threshold: every random word gives one bit of all numbers, most
+  /// significant first, and random words are generated only until all lanes
+  /// are decided
+  ///
+  /// @param counter counter of the word, it uses counters counter *
+  /// cCountersPerWord and after, threshold probability * 2^32, lanes bits
+  /// which are needed, other bits are 0
+  static std::uint64_t GetBernoulliWord(const std::uint64_t seed,
+                                        const std::uint64_t generation,
+                                        const std::uint64_t counter,
+                                        const std::uint64_t threshold,
+                                        const std::uint64_t lanes);
+
+  /// @brief bits of precision of probabilities
+  static constexpr std::uint32_t cThresholdBits = 32;
+  /// @brief count of counters which one Bernoulli word may use
+  static constexpr std::uint64_t cCountersPerWord = cThresholdBits;
+};
+
+#endif // INCLUDE_RANDOM_COUNTER_RANDOM_H_
@@ -0,0 +1,67 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_REGION_REGION_OPERATIONS_H_
+#define INCLUDE_REGION_REGION_OPERATIONS_H_
+#include "initial_figures/pattern_library.h"
+#include "packed_grid.h"
+#include "region/region_query.h"
+#include "rules/rules.h"
+
+#include <cstdint>
+
+///
+/// @brief The RegionOperation enumerates how written cells are combined with
+/// cells of the grid
+///
+enum class RegionOperation { Replace, Or, And, Xor };
+
+///
+/// @brief The RegionOperations change rectangles of a packed grid. Rows are
+/// processed up to 64 cells at once, unaligned columns are shifted between
+/// neighbour words. Regions wrap around ring borders, cells outside of
+/// limited borders are skipped
+///
+class RegionOperations {
+public:
+  /// @brief combine cells with the rectangle of the grid which has the same
+  /// size and corner at top row and left column
+  static void Write(PackedGrid &grid, const PackedGrid &cells,
+                    const std::int64_t top_row, const std::int64_t left_column,
+                    const RegionOperation operation,
+                    const CellBordersRule borders_rule);
+  /// @brief make cells of the region dead
+  static void Clear(PackedGrid &grid, const Region &region,
+                    const CellBordersRule borders_rule);
+  /// @brief copy cells of the region of source to the rectangle of
+  /// destination with corner at top row and left column
+  static void Copy(const PackedGrid &source, const Region &region,
+                   PackedGrid &destination, const std::int64_t top_row,
+                   const std::int64_t left_column,
+                   const CellBordersRule borders_rule);
+  /// @brief move cells of the region to the rectangle with corner at top
+  /// row and left column, the rest of the region becomes dead
+  static void Move(PackedGrid &grid, const Region &region,
+                   const std::int64_t top_row, const std::int64_t left_column,
+                   const CellBordersRule borders_rule);
+  /// @brief rotate or reflect cells of the region, the corner of the region
+  /// stays in place, rows and columns are swapped by rotations by 90
+  static void TransformRegion(PackedGrid &grid, const Region &region,
+                              const PatternTransform transform,
+                              const CellBordersRule borders_rule);
+  /// @brief return rotated or reflected cells. Transposes are done by
+  /// blocks of 64x64 cells, horizontal flips by reversing bits of words
+  static PackedGrid Transform(const PackedGrid &cells,
+                              const PatternTransform transform);
+
+private:
+  /// @brief return cells with rows and columns swapped
+  static PackedGrid Transpose(const PackedGrid &cells);
+  /// @brief reverse order of rows
+  static void FlipRows(PackedGrid &cells);
+  /// @brief reverse order of cells in every row
+  static void FlipColumns(PackedGrid &cells);
+};
+
+#endif // INCLUDE_REGION_REGION_OPERATIONS_H_
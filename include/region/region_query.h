@@ -0,0 +1,75 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_REGION_REGION_QUERY_H_
+#define INCLUDE_REGION_REGION_QUERY_H_
+#include "packed_grid.h"
+#include "rules/rules.h"
+#include "snapshot/world_snapshot.h"
+
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The Region describes a rectangle of cells. The corner could be
+/// negative or outside of the world and the rectangle could be bigger than
+/// the world, such cells are wrapped by ring borders or dead for limited
+/// borders
+///
+struct Region {
+  std::int64_t top_row;
+  std::int64_t left_column;
+  std::uint32_t rows;
+  std::uint32_t columns;
+};
+
+///
+/// @brief The CellSpan is a run of alive cells in one row of a region, row
+/// and column are relative to the corner of the region
+///
+struct CellSpan {
+  std::uint32_t row;
+  std::uint32_t column;
+  std::uint32_t length;
+};
+
+///
+/// @brief The RegionQuery copies a rectangle of a packed grid. Only words of
+/// the rows and columns of the region are read, bits are copied up to 64 at
+/// once
+///
+class RegionQuery {
+public:
+  /// @brief return cells of the region, row 0 and column 0 of the result is
+  /// the corner of the region
+  static PackedGrid ReadCells(const PackedGrid &grid, const Region &region,
+                              const CellBordersRule borders_rule);
+  /// @brief return cells of the region of the snapshot, same as ReadCells
+  static PackedGrid ReadCells(const WorldSnapshot &snapshot,
+                              const Region &region,
+                              const CellBordersRule borders_rule);
+  /// @brief return runs of alive cells of the region ordered by rows and
+  /// columns
+  static std::vector<CellSpan> ReadSpans(const PackedGrid &grid,
+                                         const Region &region,
+                                         const CellBordersRule borders_rule);
+  /// @brief return runs of alive cells of packed cells
+  static std::vector<CellSpan> GetSpans(const PackedGrid &cells);
+  /// @brief return count bits (at most 64) of row starting at bit
+  static std::uint64_t ReadBits(const std::uint64_t *row,
+                                const std::uint64_t bit,
+                                const std::uint32_t count);
+  /// @brief set count bits (at most 64) of row starting at bit
+  static void WriteBits(std::uint64_t *row, const std::uint64_t bit,
+                        const std::uint64_t value, const std::uint32_t count);
+  /// @brief copy count bits of source row starting at source bit to
+  /// destination row starting at destination bit
+  static void CopyBits(const std::uint64_t *source,
+                       const std::uint64_t source_bit,
+                       std::uint64_t *destination,
+                       const std::uint64_t destination_bit,
+                       const std::uint64_t count);
+};
+
+#endif // INCLUDE_REGION_REGION_QUERY_H_
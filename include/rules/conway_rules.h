@@ -23,6 +23,25 @@ public:
   ///
   /// @return returns true if cell would be alive, otherwise false
   bool GetNewCellState(const Cell &cell) const override;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param is_alive current cell state, alive_neighbours_count count of alive
+  /// neighbours
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const bool is_alive,
+                       const std::uint32_t alive_neighbours_count) const override;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param neighbourhood 3x3 block of square cells around the cell, bit
+  /// row * 3 + column is set for alive cell, bit 4 is the cell itself
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const std::uint32_t neighbourhood) const override;
+  /// @brief Get rule for cells at world borders
+  CellBordersRule GetBordersRule() const override;
+  /// @brief Get shape of cells, Conway rules are defined on square cells
+  GridTopology GetTopology() const override;
   /// @brief Get index of cell in the world
   ///
   /// @param current_index index which we are interested in, max_index border
@@ -31,28 +50,12 @@ public:
   /// @return set index according to border rules
   void GetCellIndex(std::int32_t &current_index,
                     const std::uint32_t &max_index) const override;
-  /// @brief Get the status of game (is it over)
-  ///
-  /// @param alive_cells_count count of alive cells in generation,
-  /// equal_worlds_count count of generations which are equal to current,
-  /// generations_count current generations count
-  ///
-  /// @return true if game is over, false otherwise
-  bool IsGameOver(const std::uint64_t &alive_cells_count,
-                  const std::uint32_t &equal_worlds_count,
-                  const std::uint32_t &generations_count) const override;
 
 private:
   /// @brief Count of neighbours for cell surviving
   const std::set<std::uint32_t> cSurvivalCount = {2, 3};
   /// @brief Count of neighbours for cell rebirth
   const std::set<std::uint32_t> cRebirthCount = {3};
-  /// @brief Minimum amount of cells to not stop the game
-  const std::uint64_t cMinAliveCellsCount = 1;
-  /// @brief Maximum number of equal worlds to not stop the game
-  const std::uint32_t cMaxEqualWorldsCount = 0;
-  /// @brief Maximum number of generations, after this game stops
-  const std::uint32_t cMaxGenerations = 20;
   /// @brief Borders rule
   const CellBordersRule borders_rule = CellBordersRule::RingBorders;
 };
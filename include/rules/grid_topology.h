@@ -0,0 +1,48 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RULES_GRID_TOPOLOGY_H_
+#define INCLUDE_RULES_GRID_TOPOLOGY_H_
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The GridTopology describes the shape of cells and which cells are
+/// neighbours. All topologies are stored as rows and columns of the world:
+/// Square has the 8 cells of the Moore neighbourhood. Hexagonal uses odd-r
+/// offset coordinates, odd rows are shifted right by half of a cell, and has
+/// 6 neighbours. Triangular cells point up if row + column is even and down
+/// otherwise, and have 12 neighbours which share an edge or a vertex.
+/// Ring borders need an even count of rows for Hexagonal and even counts of
+/// rows and columns for Triangular, otherwise wrapped rows do not fit
+///
+enum class GridTopology { Square, Hexagonal, Triangular };
+
+///
+/// @brief The NeighbourOffset is a position of a neighbour relative to the
+/// cell
+///
+struct NeighbourOffset {
+  std::int32_t row, column;
+};
+
+///
+/// @brief The GridNeighbourhood returns neighbours of cells of a topology
+///
+class GridNeighbourhood {
+public:
+  /// @brief return offsets of all neighbours of the cell
+  ///
+  /// @param topology shape of cells, row and column position of the cell,
+  /// which selects the offsets of its parity
+  static const std::vector<NeighbourOffset> &
+  GetOffsets(const GridTopology topology, const std::uint32_t row,
+             const std::uint32_t column);
+  /// @brief return count of neighbours of every cell of the topology
+  static std::uint32_t GetNeighboursCount(const GridTopology topology);
+  /// @brief return name of the topology
+  static const char *GetTopologyName(const GridTopology topology);
+};
+
+#endif // INCLUDE_RULES_GRID_TOPOLOGY_H_
@@ -0,0 +1,78 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RULES_ISOTROPIC_RULES_H_
+#define INCLUDE_RULES_ISOTROPIC_RULES_H_
+#include "neighbourhood_table.h"
+#include "rules.h"
+
+#include <string>
+
+///
+/// @brief The IsotropicRules describes isotropic non-totalistic rules of
+/// square cells in Hensel notation, e.g. "B2n3/S23-q". Letters after a count
+/// of neighbours select arrangements of the neighbours, which are the same
+/// after rotations and reflections, letters after '-' are excluded, a count
+/// without letters includes all arrangements. Rules are compiled to the
+/// table of all 3x3 blocks. Game is over if there are no alive cells or the
+/// world repeated
+///
+class IsotropicRules : public GameRules {
+public:
+  /// @brief IsotropicRules is initialized with states of all blocks
+  explicit IsotropicRules(const std::bitset<512> &states,
+                          const CellBordersRule borders_rule =
+                              CellBordersRule::RingBorders);
+  /// @brief Parse rule in Hensel notation
+  ///
+  /// @param rule text of the rule, states next states of all 3x3 blocks
+  ///
+  /// @return false if the rule is not in Hensel notation
+  static bool ParseRule(const std::string &rule, std::bitset<512> &states);
+  /// @brief Get cell state in next generation. Count of neighbours doesn't
+  /// define it, so only cells of counts whose every arrangement gives alive
+  /// cell are alive
+  ///
+  /// @param input cell
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const Cell &cell) const override;
+  /// @brief Get cell state in next generation, true only if every
+  /// arrangement of the alive neighbours gives alive cell
+  ///
+  /// @param is_alive current cell state, alive_neighbours_count count of alive
+  /// neighbours
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool
+  GetNewCellState(const bool is_alive,
+                  const std::uint32_t alive_neighbours_count) const override;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param neighbourhood 3x3 block of square cells around the cell, bit
+  /// row * 3 + column is set for alive cell, bit 4 is the cell itself
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const std::uint32_t neighbourhood) const override;
+  /// @brief Get rule for cells at world borders
+  CellBordersRule GetBordersRule() const override;
+  /// @brief Get shape of cells, isotropic rules are defined on square cells
+  GridTopology GetTopology() const override;
+  /// @brief Get index of cell in the world
+  ///
+  /// @param current_index index which we are interested in, max_index border
+  /// value(maximum of rows/columns)
+  ///
+  /// @return set index according to border rules
+  void GetCellIndex(std::int32_t &current_index,
+                    const std::uint32_t &max_index) const override;
+
+private:
+  /// @brief next states of all blocks
+  const NeighbourhoodRuleTable table;
+  /// @brief Borders rule
+  const CellBordersRule borders_rule;
+};
+
+#endif // INCLUDE_RULES_ISOTROPIC_RULES_H_
@@ -0,0 +1,77 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RULES_LATTICE_RULES_H_
+#define INCLUDE_RULES_LATTICE_RULES_H_
+#include "rules.h"
+
+#include <string>
+
+///
+/// @brief The LatticeRules describes totalistic rules of any topology in
+/// B/S notation, e.g. "B2/S34": dead cell with 2 alive neighbours is born,
+/// alive cell with 3 or 4 alive neighbours survives. Neighbour counts above
+/// 9 are written as letters, 'a' is 10, 'b' is 11 and 'c' is 12. Game is
+/// over if there are no alive cells or the world repeated
+///
+class LatticeRules : public GameRules {
+public:
+  /// @brief LatticeRules is initialized with topology and masks of
+  /// neighbour counts, bit N is set for count N
+  LatticeRules(const GridTopology topology, const std::uint32_t birth_mask,
+               const std::uint32_t survival_mask,
+               const CellBordersRule borders_rule =
+                   CellBordersRule::RingBorders);
+  /// @brief Parse rule in B/S notation
+  ///
+  /// @param rule text of the rule, birth_mask and survival_mask parsed masks
+  ///
+  /// @return false if the rule is not in B/S notation
+  static bool ParseRule(const std::string &rule, std::uint32_t &birth_mask,
+                        std::uint32_t &survival_mask);
+  /// @brief Get cell state in next generation
+  ///
+  /// @param input cell
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const Cell &cell) const override;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param is_alive current cell state, alive_neighbours_count count of alive
+  /// neighbours
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool
+  GetNewCellState(const bool is_alive,
+                  const std::uint32_t alive_neighbours_count) const override;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param neighbourhood 3x3 block of square cells around the cell, bit
+  /// row * 3 + column is set for alive cell, bit 4 is the cell itself
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  bool GetNewCellState(const std::uint32_t neighbourhood) const override;
+  /// @brief Get rule for cells at world borders
+  CellBordersRule GetBordersRule() const override;
+  /// @brief Get shape of cells, which defines neighbours of a cell
+  GridTopology GetTopology() const override;
+  /// @brief Get index of cell in the world
+  ///
+  /// @param current_index index which we are interested in, max_index border
+  /// value(maximum of rows/columns)
+  ///
+  /// @return set index according to border rules
+  void GetCellIndex(std::int32_t &current_index,
+                    const std::uint32_t &max_index) const override;
+
+private:
+  /// @brief shape of cells
+  const GridTopology topology;
+  /// @brief masks of neighbour counts for cell rebirth and surviving
+  const std::uint32_t birth_mask, survival_mask;
+  /// @brief Borders rule
+  const CellBordersRule borders_rule;
+};
+
+#endif // INCLUDE_RULES_LATTICE_RULES_H_
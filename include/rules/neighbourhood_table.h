@@ -0,0 +1,49 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RULES_NEIGHBOURHOOD_TABLE_H_
+#define INCLUDE_RULES_NEIGHBOURHOOD_TABLE_H_
+#include "rule_table.h"
+#include "rules.h"
+
+#include <bitset>
+#include <cstdint>
+
+///
+/// @brief The NeighbourhoodRuleTable stores the next state of a cell for
+/// every 3x3 block of square cells around it. Bit row * 3 + column of the
+/// index is the cell at row and column of the block, so bit 4 is the cell
+/// itself. Rules which depend on the arrangement of neighbours, not only on
+/// their count, are stored this way
+///
+class NeighbourhoodRuleTable {
+public:
+  /// @brief build table by asking rules about every block
+  explicit NeighbourhoodRuleTable(const GameRules &rules);
+  /// @brief build table from counts of neighbours
+  explicit NeighbourhoodRuleTable(const TotalisticRuleTable &rule_table);
+  /// @brief build table from states of blocks
+  NeighbourhoodRuleTable(const std::bitset<512> &states,
+                         const CellBordersRule borders_rule);
+  /// @brief return cell state in next generation
+  ///
+  /// @param neighbourhood index of the 3x3 block
+  bool GetNewCellState(const std::uint32_t neighbourhood) const;
+  /// @brief return rule for cells at world borders
+  CellBordersRule GetBordersRule() const;
+  /// @brief return true if every state depends only on the cell and count
+  /// of its alive neighbours
+  bool IsTotalistic() const;
+
+  /// @brief count of entries in the table
+  static constexpr std::uint32_t cTableSize = 512;
+  /// @brief bit of the cell itself in the index
+  static constexpr std::uint32_t cCellBit = 4;
+
+private:
+  std::bitset<cTableSize> states;
+  CellBordersRule borders_rule;
+};
+
+#endif // INCLUDE_RULES_NEIGHBOURHOOD_TABLE_H_
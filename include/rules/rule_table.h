@@ -0,0 +1,49 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_RULES_RULE_TABLE_H_
+#define INCLUDE_RULES_RULE_TABLE_H_
+#include "rules.h"
+
+#include <cstdint>
+
+///
+/// @brief The TotalisticRuleTable stores rules as bit masks over count of
+/// alive neighbours: bit N of birth mask is set if dead cell with N alive
+/// neighbours becomes alive, bit N of survival mask is set if alive cell
+/// with N alive neighbours stays alive. Packed engines use it instead of
+/// calling GameRules for every cell
+///
+class TotalisticRuleTable {
+public:
+  /// @brief build table by asking rules about every count of neighbours
+  explicit TotalisticRuleTable(const GameRules &rules);
+  /// @brief build table from masks
+  TotalisticRuleTable(
+      const std::uint32_t birth_mask, const std::uint32_t survival_mask,
+      const CellBordersRule borders_rule,
+      const GridTopology topology = GridTopology::Square);
+  /// @brief return mask of neighbour counts which make dead cell alive
+  std::uint32_t GetBirthMask() const;
+  /// @brief return mask of neighbour counts which keep alive cell alive
+  std::uint32_t GetSurvivalMask() const;
+  /// @brief return rule for cells at world borders
+  CellBordersRule GetBordersRule() const;
+  /// @brief return shape of cells which are counted as neighbours
+  GridTopology GetTopology() const;
+  /// @brief return cell state in next generation
+  bool GetNewCellState(const bool is_alive,
+                       const std::uint32_t alive_neighbours_count) const;
+
+  /// @brief maximum count of neighbours in the table
+  static constexpr std::uint32_t cMaxNeighboursCount = 15;
+
+private:
+  std::uint32_t birth_mask;
+  std::uint32_t survival_mask;
+  CellBordersRule borders_rule;
+  GridTopology topology;
+};
+
+#endif // INCLUDE_RULES_RULE_TABLE_H_
@@ -6,6 +6,7 @@
 #ifndef INCLUDE_RULES_H_
 #define INCLUDE_RULES_H_
 #include "cell.h"
+#include "grid_topology.h"
 
 #include <cstdint>
 
@@ -28,6 +29,26 @@ public:
   ///
   /// @return returns true if cell would be alive, otherwise false
   virtual bool GetNewCellState(const Cell &cell) const = 0;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param is_alive current cell state, alive_neighbours_count count of alive
+  /// neighbours
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  virtual bool
+  GetNewCellState(const bool is_alive,
+                  const std::uint32_t alive_neighbours_count) const = 0;
+  /// @brief Get cell state in next generation
+  ///
+  /// @param neighbourhood 3x3 block of square cells around the cell, bit
+  /// row * 3 + column is set for alive cell, bit 4 is the cell itself
+  ///
+  /// @return returns true if cell would be alive, otherwise false
+  virtual bool GetNewCellState(const std::uint32_t neighbourhood) const = 0;
+  /// @brief Get rule for cells at world borders
+  virtual CellBordersRule GetBordersRule() const = 0;
+  /// @brief Get shape of cells, which defines neighbours of a cell
+  virtual GridTopology GetTopology() const = 0;
   /// @brief Get index of cell in the world
   ///
   /// @param current_index index which we are interested in, max_index border
@@ -36,16 +57,6 @@ public:
   /// @return set index according to border rules
   virtual void GetCellIndex(std::int32_t &current_index,
                             const std::uint32_t &max_index) const = 0;
-  /// @brief Get the status of game (is it over)
-  ///
-  /// @param alive_cells_count count of alive cells in generation,
-  /// equal_worlds_count count of generations which are equal to current,
-  /// generations_count current generations count
-  ///
-  /// @return true if game is over, false otherwise
-  virtual bool IsGameOver(const std::uint64_t &alive_cells_count,
-                          const std::uint32_t &equal_worlds_count,
-                          const std::uint32_t &generations_count) const = 0;
 };
 
 #endif // INCLUDE_RULES_H_
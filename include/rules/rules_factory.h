@@ -8,6 +8,7 @@
 #include "rules.h"
 
 #include <memory>
+#include <string>
 
 ///
 /// @brief The GameRulesFactory returns unique_ptr to default game rules
@@ -15,6 +16,14 @@
 class GameRulesFactory {
 public:
   static std::unique_ptr<GameRules> MakeGameRules();
+  /// @brief return rules of the topology: Conway rules for Square, B2/S34
+  /// for Hexagonal and B4/S345 for Triangular if rule is empty
+  ///
+  /// @param topology shape of cells, rule rule in B/S notation or, for
+  /// Square, in Hensel notation, default rule of the topology is used if it
+  /// is empty or can't be parsed
+  static std::unique_ptr<GameRules> MakeGameRules(const GridTopology topology,
+                                                  const std::string &rule = "");
 };
 
 #endif // INCLUDE_RULES_FACTORY_H_
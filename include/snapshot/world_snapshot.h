@@ -0,0 +1,179 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_SNAPSHOT_WORLD_SNAPSHOT_H_
+#define INCLUDE_SNAPSHOT_WORLD_SNAPSHOT_H_
+#include "memory/cache_aligned_allocator.h"
+#include "packed_grid.h"
+#include "statistics/world_statistics.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///
+/// @brief The WorldSnapshot is an immutable copy of packed cells and
+/// statistics of one generation. Cells are stored in tiles of cTileRows rows
+/// and cTileWords words, tiles without births or deaths since the previous
+/// snapshot are shared with it
+///
+class WorldSnapshot {
+public:
+  /// @brief copy all cells of the generation
+  WorldSnapshot(const std::uint32_t generation,
+                const StatisticsSummary &summary, const PackedGrid &cells);
+  /// @brief return generation of the snapshot
+  std::uint32_t GetGeneration() const;
+  /// @brief return statistics of the generation
+  const StatisticsSummary &GetSummary() const;
+  /// @brief return count of rows
+  std::uint32_t GetRowCount() const;
+  /// @brief return count of columns
+  std::uint32_t GetColumnCount() const;
+  /// @brief true if cell is alive
+  bool Get(const std::uint32_t row, const std::uint32_t column) const;
+  /// @brief copy count cells of the row starting at column to destination
+  /// row starting at destination bit, cells must be inside the world
+  void CopyBits(const std::uint32_t row, const std::uint32_t column,
+                std::uint64_t *destination,
+                const std::uint64_t destination_bit,
+                const std::uint32_t count) const;
+  /// @brief return count of rows of tiles
+  std::uint32_t GetTileRowsCount() const;
+  /// @brief return count of columns of tiles
+  std::uint32_t GetTileColumnsCount() const;
+  /// @brief return first word of the tile, the same pointer in two
+  /// snapshots means the tile is shared
+  const std::uint64_t *GetTile(const std::uint32_t tile_row,
+                               const std::uint32_t tile_column) const;
+  /// @brief return copy of all cells
+  PackedGrid ToPackedGrid() const;
+
+  /// @brief count of rows in one tile
+  static constexpr std::uint32_t cTileRows = 32;
+  /// @brief count of words of a row in one tile
+  static constexpr std::uint32_t cTileWords = 4;
+
+private:
+  friend class SnapshotPublisher;
+  using Tile = std::shared_ptr<const std::vector<std::uint64_t>>;
+
+  /// @brief WorldSnapshot is created by SnapshotPublisher, tiles which are
+  /// not changed are shared with the previous snapshot of the same size
+  WorldSnapshot(const std::uint32_t generation,
+                const StatisticsSummary &summary, const PackedGrid &cells,
+                const WorldSnapshot *previous,
+                const std::vector<bool> &changed_tiles);
+  /// @brief return count of words of a tile row in the tile column
+  std::uint32_t GetTileWords(const std::uint32_t tile_column) const;
+  /// @brief return first word of the row in the tile
+  const std::uint64_t *GetTileRow(const std::uint32_t row,
+                                  const std::uint32_t tile_column) const;
+
+  /// @brief generation of the snapshot
+  const std::uint32_t generation;
+  /// @brief statistics of the generation
+  const StatisticsSummary summary;
+  /// @brief count of rows and columns
+  const std::uint32_t rows, columns;
+  /// @brief count of words in one row
+  const std::uint32_t words_per_row;
+  /// @brief count of rows and columns of tiles
+  const std::uint32_t tile_rows, tile_columns;
+  /// @brief tiles by rows, rows of a tile are continuous
+  std::vector<Tile> tiles;
+};
+
+///
+/// @brief The SnapshotGuard keeps a snapshot alive while it is read. The
+/// guard must be released before the publisher is destroyed
+///
+class SnapshotGuard {
+public:
+  /// @brief guard without a snapshot
+  SnapshotGuard();
+  SnapshotGuard(SnapshotGuard &&other);
+  SnapshotGuard(const SnapshotGuard &) = delete;
+  SnapshotGuard &operator=(const SnapshotGuard &) = delete;
+  /// @brief allow the publisher to free the snapshot
+  ~SnapshotGuard();
+  /// @brief return snapshot, nullptr if nothing is published
+  const WorldSnapshot *Get() const;
+  const WorldSnapshot &operator*() const;
+  const WorldSnapshot *operator->() const;
+
+private:
+  friend class SnapshotPublisher;
+  /// @brief SnapshotGuard is created by SnapshotPublisher
+  SnapshotGuard(std::atomic<std::uint64_t> *reader_epoch,
+                const WorldSnapshot *snapshot);
+
+  /// @brief epoch slot of the reader, nullptr if it is released
+  std::atomic<std::uint64_t> *reader_epoch;
+  /// @brief snapshot which is read
+  const WorldSnapshot *snapshot;
+};
+
+///
+/// @brief The SnapshotPublisher publishes snapshots of generations for
+/// readers of other threads in RCU style. Readers take the current snapshot
+/// without locks, its epoch slot tells the publisher which snapshots could
+/// still be read. Replaced snapshots are freed by later publications when
+/// no reader of their epoch is left. Only one thread publishes
+///
+class SnapshotPublisher {
+public:
+  /// @brief publisher takes changed tiles of the statistics
+  explicit SnapshotPublisher(WorldStatistics &statistics);
+  /// @brief free all snapshots, no guards must be left
+  ~SnapshotPublisher();
+  SnapshotPublisher(const SnapshotPublisher &) = delete;
+  SnapshotPublisher &operator=(const SnapshotPublisher &) = delete;
+  /// @brief Make snapshot of the generation current. Only tiles which cover
+  /// changed tiles of the statistics are copied, other tiles are shared with
+  /// the current snapshot
+  void Publish(const std::uint32_t generation, const PackedGrid &cells,
+               WorldStatistics &statistics);
+  /// @brief return guard of the current snapshot, could be called from any
+  /// thread. It waits only if cReaderSlotsCount guards are held at once
+  SnapshotGuard Read() const;
+  /// @brief return count of replaced snapshots which are not freed yet
+  std::size_t GetRetiredCount() const;
+
+  /// @brief count of guards which could be held at once
+  static constexpr std::uint32_t cReaderSlotsCount = 64;
+
+private:
+  ///
+  /// @brief The ReaderSlot stores epoch of a reader, 0 if the slot is free
+  ///
+  struct alignas(cCacheLineSize) ReaderSlot {
+    std::atomic<std::uint64_t> epoch;
+  };
+  ///
+  /// @brief The RetiredSnapshot is a replaced snapshot which readers of its
+  /// epoch or older could still read
+  ///
+  struct RetiredSnapshot {
+    std::unique_ptr<const WorldSnapshot> snapshot;
+    std::uint64_t epoch;
+  };
+
+  /// @brief free retired snapshots older than epochs of all readers
+  void FreeRetired();
+
+  /// @brief current snapshot, owned by the publisher
+  std::atomic<const WorldSnapshot *> current;
+  /// @brief epoch is incremented when a snapshot is replaced
+  std::atomic<std::uint64_t> epoch;
+  /// @brief epochs of readers
+  mutable std::vector<ReaderSlot, CacheAlignedAllocator<ReaderSlot>> slots;
+  /// @brief replaced snapshots, oldest first
+  std::vector<RetiredSnapshot> retired;
+  /// @brief reader of changed tiles of the statistics
+  const std::uint32_t changes_reader;
+};
+
+#endif // INCLUDE_SNAPSHOT_WORLD_SNAPSHOT_H_
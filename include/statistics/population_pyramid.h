@@ -0,0 +1,70 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_STATISTICS_POPULATION_PYRAMID_H_
+#define INCLUDE_STATISTICS_POPULATION_PYRAMID_H_
+#include "statistics/world_statistics.h"
+
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The PopulationPyramid stores population of square blocks of the
+/// world at several levels. Level 0 blocks are tiles of the statistics, a
+/// block of the next level is the sum of 2x2 blocks of the level below, the
+/// last level is one block of the whole world. Only changed tiles and their
+/// parents are updated, so a zoomed out view reads only blocks of its
+/// resolution
+///
+class PopulationPyramid {
+public:
+  /// @brief PopulationPyramid is built from all tiles of the statistics
+  explicit PopulationPyramid(WorldStatistics &statistics);
+  /// @brief add population changes of tiles changed since the previous
+  /// update to all levels, takes O(changed tiles * levels)
+  void Update(WorldStatistics &statistics);
+  /// @brief return count of levels
+  std::uint32_t GetLevelsCount() const;
+  /// @brief return side of a block of the level in cells
+  std::uint32_t GetBlockSize(const std::uint32_t level) const;
+  /// @brief return count of block rows of the level
+  std::uint32_t GetRowCount(const std::uint32_t level) const;
+  /// @brief return count of block columns of the level
+  std::uint32_t GetColumnCount(const std::uint32_t level) const;
+  /// @brief return population of the block, 0 outside of the level
+  std::uint64_t Get(const std::uint32_t level, const std::uint32_t row,
+                    const std::uint32_t column) const;
+  /// @brief return populations of a rectangle of blocks, rows one after
+  /// another. Blocks outside of the level have 0 population
+  std::vector<std::uint64_t> ReadBlocks(const std::uint32_t level,
+                                        const std::uint32_t top_row,
+                                        const std::uint32_t left_column,
+                                        const std::uint32_t rows,
+                                        const std::uint32_t columns) const;
+
+private:
+  ///
+  /// @brief The Level stores populations of blocks of one size
+  ///
+  struct Level {
+    std::uint32_t rows;
+    std::uint32_t columns;
+    std::vector<std::uint64_t> populations;
+  };
+
+  /// @brief set population of the tile and add the difference to blocks
+  /// which contain the tile
+  void SetTilePopulation(const std::uint32_t tile_row,
+                         const std::uint32_t tile_column,
+                         const std::uint64_t population);
+
+  /// @brief levels from tiles to the whole world
+  std::vector<Level> levels;
+  /// @brief reader of changed tiles of the statistics
+  std::uint32_t changes_reader;
+  /// @brief side of a tile in cells
+  const std::uint32_t cTileSize;
+};
+
+#endif // INCLUDE_STATISTICS_POPULATION_PYRAMID_H_
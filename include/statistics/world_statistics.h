@@ -0,0 +1,149 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_STATISTICS_WORLD_STATISTICS_H_
+#define INCLUDE_STATISTICS_WORLD_STATISTICS_H_
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+///
+/// @brief The BoundingBox stores first and last rows and columns with alive
+/// cells, bounds are inclusive
+///
+struct BoundingBox {
+  std::uint32_t top_row;
+  std::uint32_t left_column;
+  std::uint32_t bottom_row;
+  std::uint32_t right_column;
+};
+
+///
+/// @brief The TileStatistics stores population of one tile and count of
+/// cells born and died in it since the generation started
+///
+struct TileStatistics {
+  std::uint64_t population;
+  std::uint64_t births;
+  std::uint64_t deaths;
+};
+
+///
+/// @brief The StatisticsSummary describes the whole world. Bounding box and
+/// centroid are valid only if population is not 0
+///
+struct StatisticsSummary {
+  std::uint64_t population;
+  std::uint64_t births;
+  std::uint64_t deaths;
+  BoundingBox bounding_box;
+  double centroid_row;
+  double centroid_column;
+};
+
+///
+/// @brief The WorldStatistics is updated on every cell change, so statistics
+/// never need a pass over the world. Cells are grouped into square tiles,
+/// every tile counts its population, births, deaths and sums of rows and
+/// columns of alive cells, world counters and centroid are summed from tiles.
+/// Alive cells per row and per column of every tile row give exact bounding
+/// box. There are no world counters, so threads which change cells of
+/// different rows simultaneously don't share counters
+///
+class WorldStatistics {
+public:
+  /// @brief WorldStatistics is initialized with world size and tile side
+  WorldStatistics(const std::uint32_t rows, const std::uint32_t columns,
+                  const std::uint32_t tile_size = cDefaultTileSize);
+  /// @brief count cell at row and column which became alive
+  void AddBirth(const std::uint32_t row, const std::uint32_t column);
+  /// @brief count cell at row and column which died
+  void AddDeath(const std::uint32_t row, const std::uint32_t column);
+  /// @brief reset births and deaths before next generation
+  void StartGeneration();
+  /// @brief return statistics of the world, takes O(tiles)
+  StatisticsSummary GetSummary() const;
+  /// @brief return statistics of the tile
+  TileStatistics GetTile(const std::uint32_t tile_row,
+                         const std::uint32_t tile_column) const;
+  /// @brief return count of tiles in a column of tiles
+  std::uint32_t GetTileRowsCount() const;
+  /// @brief return count of tiles in a row of tiles
+  std::uint32_t GetTileColumnsCount() const;
+  /// @brief return side of a tile in cells
+  std::uint32_t GetTileSize() const;
+  /// @brief write summary and population of every tile as json object
+  void WriteJson(std::ostream &stream) const;
+  /// @brief add a reader of changed tiles, every reader takes changes
+  /// independently of others. Changes before the call are not reported
+  ///
+  /// @return number of the reader for TakeChangedTiles
+  std::uint32_t AddChangedTilesReader();
+  /// @brief return tiles which had births or deaths since the previous
+  /// call of the reader and forget them for the reader, a tile is tile row *
+  /// tile columns count + tile column. Takes O(tiles / 64 * readers) plus
+  /// count of changed tiles, must not be called by two threads at once
+  std::vector<std::uint32_t> TakeChangedTiles(const std::uint32_t reader);
+
+  /// @brief default side of a tile in cells
+  static constexpr std::uint32_t cDefaultTileSize = 32;
+
+private:
+  ///
+  /// @brief The TileCounters stores counters of one tile
+  ///
+  struct TileCounters {
+    TileCounters();
+    std::atomic<std::uint64_t> population;
+    std::atomic<std::uint64_t> births;
+    std::atomic<std::uint64_t> deaths;
+    /// @brief sums of rows and columns of alive cells
+    std::atomic<std::uint64_t> row_sum, column_sum;
+  };
+
+  /// @brief return counters of the tile with cell at row and column
+  TileCounters &GetTileCounters(const std::uint32_t row,
+                                const std::uint32_t column);
+  /// @brief remember that cells of the tile with cell at row and column
+  /// changed
+  void MarkTileChanged(const std::uint32_t row, const std::uint32_t column);
+  /// @brief return first and last tiles with alive cells along one axis
+  ///
+  /// @param by_rows true to search tile rows, otherwise tile columns
+  ///
+  /// @return false if there are no alive cells
+  bool FindOccupiedTiles(const bool by_rows, std::uint32_t &first_tile,
+                         std::uint32_t &last_tile) const;
+  /// @brief true if the row or the column has alive cells
+  bool IsLineOccupied(const bool by_rows, const std::uint32_t line) const;
+  /// @brief return first and last rows or columns with alive cells inside
+  /// tiles
+  void FindOccupiedLines(const bool by_rows, const std::uint32_t first_tile,
+                         const std::uint32_t last_tile,
+                         std::uint32_t &first_line,
+                         std::uint32_t &last_line) const;
+
+  /// @brief constants for world and tile sizes
+  const std::uint32_t cRowsCount, cColumnsCount, cTileSize;
+  /// @brief count of tiles along rows and columns
+  const std::uint32_t cTileRowsCount, cTileColumnsCount;
+  /// @brief counters of tiles, tile rows one after another
+  std::vector<TileCounters> tiles;
+  /// @brief move changed tiles to bits of every reader
+  void CollectChangedTiles();
+
+  /// @brief one bit per tile, set if the tile changed since the last
+  /// TakeChangedTiles of any reader
+  std::vector<std::atomic<std::uint64_t>> changed_tiles;
+  /// @brief changed tiles which every reader did not take yet
+  std::vector<std::vector<std::uint64_t>> reader_changed_tiles;
+  /// @brief count of alive cells in every row
+  std::vector<std::atomic<std::uint32_t>> row_population;
+  /// @brief count of alive cells in every column of every tile row, tile
+  /// rows one after another
+  std::vector<std::atomic<std::uint32_t>> column_population;
+};
+
+#endif // INCLUDE_STATISTICS_WORLD_STATISTICS_H_
@@ -0,0 +1,91 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_STREAMING_FRAME_PROTOCOL_H_
+#define INCLUDE_STREAMING_FRAME_PROTOCOL_H_
+#include "packed_grid.h"
+
+#include <cstdint>
+#include <vector>
+
+/// @brief first word of a subscription request
+constexpr std::uint32_t cSubscribeMagic = 0x53474F4C;
+/// @brief first word of a frame
+constexpr std::uint32_t cFrameMagic = 0x46474F4C;
+
+///
+/// @brief The FrameType tells if tiles of a frame are whole cells or XOR
+/// deltas to the previous frame of the subscriber
+///
+enum class FrameType : std::uint32_t { Keyframe = 0, Delta = 1 };
+
+///
+/// @brief The SubscribeRequest is sent by a subscriber once after connect.
+/// Rows or columns 0 mean up to the end of the world
+///
+struct SubscribeRequest {
+  std::uint32_t magic;
+  std::uint32_t top_row;
+  std::uint32_t left_column;
+  std::uint32_t rows;
+  std::uint32_t columns;
+  /// @brief maximum frames per second, 0 for every generation
+  std::uint32_t max_fps;
+};
+
+///
+/// @brief The FrameHeader starts every frame, tiles_count tiles follow it.
+/// Tiles which are dead (keyframe) or unchanged (delta) are not sent
+///
+struct FrameHeader {
+  std::uint32_t magic;
+  std::uint32_t type;
+  std::uint32_t generation;
+  std::uint32_t world_rows;
+  std::uint32_t world_columns;
+  std::uint32_t tiles_count;
+};
+
+///
+/// @brief The TileHeader is followed by bytes of ZeroRunCodec data of the
+/// tile words, row by row
+///
+struct TileHeader {
+  std::uint32_t tile_row;
+  std::uint32_t tile_column;
+  std::uint32_t bytes;
+};
+
+///
+/// @brief The FrameCodec splits packed cells into tiles of cTileRows rows
+/// and cTileWords words, so a frame is encoded once and every subscriber
+/// gets only tiles of its viewport
+///
+class FrameCodec {
+public:
+  /// @brief return count of tile rows and columns of the grid
+  static std::uint32_t GetTileRowsCount(const PackedGrid &cells);
+  static std::uint32_t GetTileColumnsCount(const PackedGrid &cells);
+  /// @brief encode tile of cells, XOR to the previous cells if they are not
+  /// nullptr
+  ///
+  /// @return false if the tile is dead or unchanged, data is empty then
+  static bool EncodeTile(const PackedGrid &cells, const PackedGrid *previous,
+                         const std::uint32_t tile_row,
+                         const std::uint32_t tile_column,
+                         std::vector<std::uint8_t> &data);
+  /// @brief XOR decoded tile into cells
+  ///
+  /// @return false if data is corrupted
+  static bool DecodeTile(const std::vector<std::uint8_t> &data,
+                         const std::uint32_t tile_row,
+                         const std::uint32_t tile_column, PackedGrid &cells);
+
+  /// @brief rows of a tile
+  static constexpr std::uint32_t cTileRows = 32;
+  /// @brief 64 bit words of a tile row
+  static constexpr std::uint32_t cTileWords = 2;
+};
+
+#endif // INCLUDE_STREAMING_FRAME_PROTOCOL_H_
@@ -0,0 +1,149 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_STREAMING_FRAME_SERVER_H_
+#define INCLUDE_STREAMING_FRAME_SERVER_H_
+#include "streaming/frame_protocol.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+///
+/// @brief The FrameServerSettings describes how slow subscribers are handled
+///
+struct FrameServerSettings {
+  FrameServerSettings();
+  /// @brief subscriber is dropped if it could not receive a frame for this
+  /// time
+  std::chrono::milliseconds slow_subscriber_timeout;
+};
+
+///
+/// @brief The FrameServer streams generations to subscribers over a Unix
+/// domain socket. Publish only copies cells into a mailbox and wakes the
+/// server thread, so stepping is never blocked; generations published
+/// faster than the server thread takes them are skipped. The server thread
+/// encodes every taken generation once: tiles of XOR deltas to the previous
+/// taken generation and, only when a subscriber needs them, tiles of the
+/// whole cells. Every subscriber gets tiles of its viewport. A subscriber
+/// gets a delta if it has the previous generation, otherwise a keyframe, so
+/// subscribers which are capped by frame rate or still sending the previous
+/// frame are downsampled. One frame at most is queued per subscriber, a
+/// subscriber which could not take it in time is dropped
+///
+class FrameServer {
+public:
+  /// @brief FrameServer is initialized with path of the socket
+  explicit FrameServer(const std::string &socket_path,
+                       const FrameServerSettings &settings =
+                           FrameServerSettings());
+  /// @brief server is stopped
+  ~FrameServer();
+  /// @brief create the socket, replace a file at its path, and start the
+  /// server thread
+  ///
+  /// @return false if the socket could not be created
+  bool Start();
+  /// @brief disconnect subscribers, stop the server thread and remove the
+  /// socket file
+  void Stop();
+  /// @brief publish cells of generation to subscribers, does nothing
+  /// without subscribers
+  void Publish(const std::uint32_t generation, const PackedGrid &cells);
+  /// @brief return count of connected subscribers
+  std::size_t GetSubscribersCount() const;
+
+private:
+  ///
+  /// @brief The EncodedFrame is a generation taken by the server thread
+  /// with its tiles encoded once for all subscribers
+  ///
+  struct EncodedFrame {
+    /// @brief number of the taken frame, increased by one per frame
+    std::uint64_t sequence;
+    std::uint32_t generation;
+    std::shared_ptr<const PackedGrid> cells;
+    /// @brief true if delta_tiles are XOR to the frame sequence - 1
+    bool has_delta;
+    /// @brief delta tiles, empty for unchanged tiles
+    std::vector<std::vector<std::uint8_t>> delta_tiles;
+    /// @brief whole tiles, encoded when needed, empty for dead tiles
+    std::vector<std::vector<std::uint8_t>> keyframe_tiles;
+    std::vector<bool> is_keyframe_tile_encoded;
+  };
+
+  ///
+  /// @brief The Subscriber is a connection and its stream state
+  ///
+  struct Subscriber {
+    int socket;
+    /// @brief bytes of the request which are received
+    std::vector<std::uint8_t> request_bytes;
+    SubscribeRequest request;
+    bool is_subscribed;
+    /// @brief queued frame and count of its sent bytes
+    std::vector<std::uint8_t> output;
+    std::size_t output_sent;
+    /// @brief time when the queued frame was created
+    std::chrono::steady_clock::time_point output_time;
+    /// @brief sequence of the last frame and time it was created
+    bool has_frame;
+    std::uint64_t frame_sequence;
+    std::chrono::steady_clock::time_point frame_time;
+    /// @brief false if the subscriber should be disconnected
+    bool is_connected;
+  };
+
+  /// @brief poll sockets and send frames until the server is stopped
+  void RunThread();
+  /// @brief accept all pending connections
+  void AcceptSubscribers();
+  /// @brief receive request bytes or detect disconnect
+  void ReadSubscriber(Subscriber &subscriber);
+  /// @brief encode the published generation if there is a new one
+  void TakePublished();
+  /// @brief queue frames for subscribers which could receive them, send
+  /// queued bytes and drop slow subscribers
+  void SendFrames(const std::chrono::steady_clock::time_point now);
+  /// @brief queue current frame for subscriber
+  void QueueFrame(Subscriber &subscriber, const bool is_delta);
+  /// @brief send queued bytes without blocking
+  void Flush(Subscriber &subscriber);
+  /// @brief return poll timeout until a subscriber could get a frame or
+  /// has to be dropped, -1 to wait for events
+  int GetPollTimeout(const std::chrono::steady_clock::time_point now) const;
+  /// @brief return minimum time between frames of subscriber
+  static std::chrono::steady_clock::duration
+  GetFrameInterval(const Subscriber &subscriber);
+  /// @brief wake the server thread
+  void Wake();
+
+  /// @brief path of the socket file
+  const std::string cSocketPath;
+  /// @brief settings of the server
+  const FrameServerSettings settings;
+  /// @brief listening socket and pipe which wakes the server thread
+  int listen_socket;
+  int wake_pipe[2];
+  /// @brief true while the server thread runs
+  std::atomic<bool> is_running;
+  std::thread thread;
+  /// @brief mailbox of the last published generation
+  std::mutex published_mutex;
+  std::shared_ptr<const PackedGrid> published;
+  std::uint32_t published_generation;
+  /// @brief count of subscribers, read by Publish
+  std::atomic<std::size_t> subscribers_count;
+  /// @brief subscribers, used only by the server thread
+  std::vector<Subscriber> subscribers;
+  /// @brief the last taken frame
+  EncodedFrame current;
+};
+
+#endif // INCLUDE_STREAMING_FRAME_SERVER_H_
@@ -0,0 +1,60 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_STREAMING_FRAME_SUBSCRIBER_H_
+#define INCLUDE_STREAMING_FRAME_SUBSCRIBER_H_
+#include "streaming/frame_protocol.h"
+
+#include <chrono>
+#include <string>
+
+///
+/// @brief The StreamFrame is a generation received by a subscriber
+///
+struct StreamFrame {
+  std::uint32_t generation;
+  /// @brief true if the frame was a keyframe, false for a delta
+  bool is_keyframe;
+  /// @brief cells of the viewport, row 0 and column 0 is its corner
+  PackedGrid cells;
+};
+
+///
+/// @brief The FrameSubscriber connects to a FrameServer and applies its
+/// frames to a local copy of the viewport tiles
+///
+class FrameSubscriber {
+public:
+  FrameSubscriber();
+  /// @brief connection is closed
+  ~FrameSubscriber();
+  /// @brief connect and send the viewport
+  ///
+  /// @param request viewport and frame rate, magic is set by the call
+  ///
+  /// @return false if the server is not available
+  bool Connect(const std::string &socket_path, SubscribeRequest request);
+  /// @brief wait for the next frame
+  ///
+  /// @return false on timeout, disconnect or corrupted frame. After a
+  /// timeout inside of a frame the connection should be opened again
+  bool ReceiveFrame(const std::chrono::milliseconds timeout,
+                    StreamFrame &frame);
+
+private:
+  /// @brief read exactly size bytes until deadline
+  bool Read(void *buffer, const std::size_t size,
+            const std::chrono::steady_clock::time_point deadline);
+
+  /// @brief connected socket, -1 if not connected
+  int socket_fd;
+  /// @brief viewport of the subscription
+  SubscribeRequest request;
+  /// @brief local copy of the world, only viewport tiles are up to date
+  PackedGrid world;
+  /// @brief buffer of tile data
+  std::vector<std::uint8_t> tile_data;
+};
+
+#endif // INCLUDE_STREAMING_FRAME_SUBSCRIBER_H_
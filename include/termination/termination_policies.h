@@ -0,0 +1,192 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_TERMINATION_TERMINATION_POLICIES_H_
+#define INCLUDE_TERMINATION_TERMINATION_POLICIES_H_
+#include "termination/termination_policy.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+///
+/// @brief The ExtinctionPolicy stops the game when fewer than min alive
+/// cells are left
+///
+class ExtinctionPolicy : public TerminationPolicy {
+public:
+  /// @brief ExtinctionPolicy is initialized with minimum count of cells
+  explicit ExtinctionPolicy(const std::uint64_t min_alive_cells_count = 1);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return Extinct if the world has fewer alive cells
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief minimum amount of cells to not stop the game
+  const std::uint64_t cMinAliveCellsCount;
+};
+
+///
+/// @brief The RepetitionPolicy stops the game when more than max generations
+/// are equal to previous ones
+///
+class RepetitionPolicy : public TerminationPolicy {
+public:
+  /// @brief RepetitionPolicy is initialized with allowed count of repeats
+  explicit RepetitionPolicy(const std::uint32_t max_equal_worlds_count = 0);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return Repeated if too many worlds are repeated
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief maximum number of equal worlds to not stop the game
+  const std::uint32_t cMaxEqualWorldsCount;
+};
+
+///
+/// @brief The GenerationLimitPolicy stops the game after max generations
+///
+class GenerationLimitPolicy : public TerminationPolicy {
+public:
+  /// @brief GenerationLimitPolicy is initialized with maximum generations
+  explicit GenerationLimitPolicy(const std::uint32_t max_generations);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return GenerationLimit if the limit is exceeded
+  TerminationReason Update(const TerminationCounters &counters) override;
+  /// @brief return count of generations up to the first one over the limit
+  std::uint32_t GetStride(const std::uint32_t generations_count) const override;
+
+private:
+  /// @brief maximum number of generations, after this game stops
+  const std::uint32_t cMaxGenerations;
+};
+
+///
+/// @brief The TimeBudgetPolicy stops the game when the budget elapsed since
+/// the world was filled
+///
+class TimeBudgetPolicy : public TerminationPolicy {
+public:
+  /// @brief TimeBudgetPolicy is initialized with wall clock budget
+  explicit TimeBudgetPolicy(const std::chrono::milliseconds budget);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return TimeBudget if the budget is exhausted
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief wall clock time of the game
+  const std::chrono::milliseconds cBudget;
+  /// @brief time of the last Reset
+  std::chrono::steady_clock::time_point start;
+};
+
+///
+/// @brief The PopulationPlateauPolicy stops the game when the population
+/// stays within tolerance cells for generations. The range of the current
+/// run is kept, a population outside of it starts a new run
+///
+class PopulationPlateauPolicy : public TerminationPolicy {
+public:
+  /// @brief PopulationPlateauPolicy is initialized with length of the
+  /// plateau and maximum difference of populations on it
+  PopulationPlateauPolicy(const std::uint32_t generations,
+                          const std::uint64_t tolerance);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return PopulationPlateau if the run is long enough
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief length of the plateau in generations
+  const std::uint32_t cGenerations;
+  /// @brief maximum difference of populations on the plateau
+  const std::uint64_t cTolerance;
+  /// @brief first generation and population range of the current run
+  std::uint32_t run_start;
+  std::uint64_t run_min, run_max;
+  /// @brief false until the first Update after Reset
+  bool is_started;
+};
+
+///
+/// @brief The UnboundedGrowthPolicy stops the game when the population has
+/// grown in growing_windows consecutive windows of window generations, e.g.
+/// a glider gun. Oscillations inside a window are ignored
+///
+class UnboundedGrowthPolicy : public TerminationPolicy {
+public:
+  /// @brief UnboundedGrowthPolicy is initialized with window length and
+  /// count of windows
+  UnboundedGrowthPolicy(const std::uint32_t window,
+                        const std::uint32_t growing_windows);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return UnboundedGrowth if enough windows grew
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief length of a window in generations
+  const std::uint32_t cWindow;
+  /// @brief count of consecutive growing windows to stop the game
+  const std::uint32_t cGrowingWindows;
+  /// @brief generation and population at the start of the current window
+  std::uint32_t window_start;
+  std::uint64_t window_population;
+  /// @brief count of consecutive windows with growth
+  std::uint32_t growing_count;
+  /// @brief false until the first Update after Reset
+  bool is_started;
+};
+
+///
+/// @brief The BoundingBoxStablePolicy stops the game when the bounding box
+/// of alive cells has not changed for generations. Still lifes and
+/// oscillators keep their box, spaceships move it
+///
+class BoundingBoxStablePolicy : public TerminationPolicy {
+public:
+  /// @brief BoundingBoxStablePolicy is initialized with count of
+  /// generations the box has to keep
+  explicit BoundingBoxStablePolicy(const std::uint32_t generations);
+  /// @brief forget previous generations
+  void Reset() override;
+  /// @brief return BoundingBoxStable if the box is stable long enough
+  TerminationReason Update(const TerminationCounters &counters) override;
+
+private:
+  /// @brief count of generations the box has to keep
+  const std::uint32_t cGenerations;
+  /// @brief box and the first generation it was seen
+  BoundingBox box;
+  std::uint32_t box_since;
+  /// @brief false until the first Update after Reset
+  bool is_started;
+};
+
+///
+/// @brief The AnyTerminationPolicy stops the game when any of its policies
+/// does, the reason of the first such policy is returned. All policies are
+/// updated every generation, so their state stays complete
+///
+class AnyTerminationPolicy : public TerminationPolicy {
+public:
+  /// @brief add policy, policies added first have priority
+  void Add(std::unique_ptr<TerminationPolicy> policy);
+  /// @brief reset all policies
+  void Reset() override;
+  /// @brief update all policies and return the first reason
+  TerminationReason Update(const TerminationCounters &counters) override;
+  /// @brief return the smallest stride of policies
+  std::uint32_t GetStride(const std::uint32_t generations_count) const override;
+
+private:
+  /// @brief policies in order of priority
+  std::vector<std::unique_ptr<TerminationPolicy>> policies;
+};
+
+#endif // INCLUDE_TERMINATION_TERMINATION_POLICIES_H_
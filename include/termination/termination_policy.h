@@ -0,0 +1,70 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_TERMINATION_TERMINATION_POLICY_H_
+#define INCLUDE_TERMINATION_TERMINATION_POLICY_H_
+#include "statistics/world_statistics.h"
+
+#include <cstdint>
+
+///
+/// @brief The TerminationReason enumerates why the game is over
+///
+enum class TerminationReason {
+  /// @brief the game goes on
+  None,
+  /// @brief too few alive cells
+  Extinct,
+  /// @brief the world repeats a previous generation
+  Repeated,
+  /// @brief maximum count of generations is reached
+  GenerationLimit,
+  /// @brief wall clock budget is exhausted
+  TimeBudget,
+  /// @brief population stays in a narrow range
+  PopulationPlateau,
+  /// @brief population keeps growing
+  UnboundedGrowth,
+  /// @brief bounding box of alive cells does not change
+  BoundingBoxStable
+};
+
+/// @brief return name of the reason, e.g. "population_plateau"
+const char *GetTerminationReasonName(const TerminationReason reason);
+
+///
+/// @brief The TerminationCounters are counters of the game which are
+/// maintained incrementally while cells change, so policies never need a
+/// pass over the world
+///
+struct TerminationCounters {
+  std::uint32_t generations_count;
+  /// @brief count of generations which are equal to a previous one
+  std::uint32_t equal_worlds_count;
+  /// @brief population, births, deaths and bounding box of the generation
+  StatisticsSummary summary;
+};
+
+///
+/// @brief The TerminationPolicy decides if the game is over. Policies are
+/// stateful, Update is called once for every finished generation, so every
+/// policy is O(1) per generation. StepGenerations skips Update only for
+/// generations within the stride of the policy
+///
+class TerminationPolicy {
+public:
+  virtual ~TerminationPolicy() = default;
+  /// @brief forget previous generations, called when the world is filled
+  virtual void Reset() = 0;
+  /// @brief add generation
+  ///
+  /// @return reason if the game is over, None otherwise
+  virtual TerminationReason Update(const TerminationCounters &counters) = 0;
+  /// @brief return count of generations after generations_count which could
+  /// be calculated at once, before the next Update, without changing any
+  /// decision. By default every generation is needed
+  virtual std::uint32_t GetStride(const std::uint32_t generations_count) const;
+};
+
+#endif // INCLUDE_TERMINATION_TERMINATION_POLICY_H_
@@ -0,0 +1,31 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_TERMINATION_TERMINATION_POLICY_FACTORY_H_
+#define INCLUDE_TERMINATION_TERMINATION_POLICY_FACTORY_H_
+#include "termination/termination_policy.h"
+
+#include <chrono>
+#include <memory>
+
+///
+/// @brief The TerminationPolicyFactory returns common combinations of
+/// termination policies
+///
+class TerminationPolicyFactory {
+public:
+  /// @brief policy of the game by default: no alive cells, a repeated world
+  /// or more than 20 generations
+  static std::unique_ptr<TerminationPolicy> MakeDefaultPolicy();
+  /// @brief policy of batch runs, which stop as soon as the outcome is
+  /// known: extinction, repetition, population plateau, unbounded growth or
+  /// stable bounding box, and otherwise the generation and time limits
+  ///
+  /// @param max_generations generation cap, time_budget 0 for no limit
+  static std::unique_ptr<TerminationPolicy>
+  MakeBatchPolicy(const std::uint32_t max_generations,
+                  const std::chrono::milliseconds time_budget);
+};
+
+#endif // INCLUDE_TERMINATION_TERMINATION_POLICY_FACTORY_H_
@@ -0,0 +1,95 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_TUNING_AUTOTUNER_H_
+#define INCLUDE_TUNING_AUTOTUNER_H_
+#include "game_of_life.h"
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+///
+/// @brief The AutotuneSettings describes how long and where the autotuner
+/// measures
+///
+struct AutotuneSettings {
+  AutotuneSettings();
+  /// @brief total time of measurements
+  std::chrono::milliseconds budget;
+  /// @brief file with profiles of previous runs on this host, empty to
+  /// always measure
+  std::string profile_path;
+  /// @brief stream for the choice and measured rates, nullptr to be silent
+  std::ostream *log;
+  /// @brief settings of the game which are not tuned, e.g. topology, rule
+  /// and probabilities. Candidates start from them and they are a part of
+  /// the profile key
+  GameOfLifeSettings game;
+};
+
+///
+/// @brief The TuningResult stores settings of one measured variant and its
+/// speed
+///
+struct TuningResult {
+  GameOfLifeSettings settings;
+  /// @brief calculated cells per second
+  double cells_per_second;
+};
+
+///
+/// @brief The Autotuner runs short benchmarks of engines, tile sizes and
+/// thread counts on the world size and cells which will be calculated, and
+/// returns settings of the fastest variant. Variants are measured one
+/// generation per call, as the game loop and asynchronous steps run them.
+/// Results are cached in a profile file per host, world size, density and
+/// rule, so next starts only read the file
+///
+class Autotuner {
+public:
+  /// @brief Autotuner is initialized with world size
+  Autotuner(const std::uint32_t rows, const std::uint32_t columns,
+            const AutotuneSettings &settings = AutotuneSettings());
+  /// @brief return settings of the fastest variant for the cells
+  ///
+  /// @param alive_cells initial cells of the game
+  GameOfLifeSettings Tune(const std::vector<Point> &alive_cells);
+  /// @brief return measured variants of last Tune, empty if the profile was
+  /// used
+  const std::vector<TuningResult> &GetResults() const;
+  /// @brief return variants which are measured
+  std::vector<GameOfLifeSettings> GetCandidates() const;
+
+private:
+  /// @brief measure speed of variant
+  ///
+  /// @param budget time for the variant
+  double Measure(const GameOfLifeSettings &candidate,
+                 const std::vector<Point> &alive_cells,
+                 const std::chrono::nanoseconds budget) const;
+  /// @brief return key of the profile line for the cells
+  std::string GetProfileKey(const std::vector<Point> &alive_cells) const;
+  /// @brief find settings of the key in the profile file
+  bool ReadProfile(const std::string &key, TuningResult &result) const;
+  /// @brief add or replace line of the key in the profile file
+  bool WriteProfile(const std::string &key, const TuningResult &result) const;
+  /// @brief write settings to the log
+  void Log(const char *prefix, const TuningResult &result) const;
+
+  /// @brief constants for rows and columns count
+  const std::uint32_t cRowsCount, cColumnsCount;
+  /// @brief settings of the autotuner
+  const AutotuneSettings settings;
+  /// @brief measured variants
+  std::vector<TuningResult> results;
+
+  /// @brief minimum count of generations measured per variant
+  const std::uint32_t cMinGenerations = 2;
+  /// @brief tile rows of temporal blocking which are measured
+  const std::vector<std::uint32_t> cTileRows = {16, 64, 256};
+};
+
+#endif // INCLUDE_TUNING_AUTOTUNER_H_
@@ -0,0 +1,37 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_TUNING_GAME_OF_LIFE_FACTORY_H_
+#define INCLUDE_TUNING_GAME_OF_LIFE_FACTORY_H_
+#include "game_of_life.h"
+
+#include <memory>
+#include <iostream>
+#include <vector>
+
+///
+/// @brief The GameOfLifeFactory creates games of entry points. Games with
+/// autotune settings take engine, tiles and threads from the Autotuner
+///
+class GameOfLifeFactory {
+public:
+  /// @brief create game with initial cells, settings are tuned on the cells
+  /// if autotune is set
+  ///
+  /// @param log stream for the choice of the autotuner, nullptr to be silent
+  static std::unique_ptr<GameOfLife>
+  MakeGameOfLife(const std::uint32_t rows, const std::uint32_t columns,
+                 const GameOfLifeSettings &settings,
+                 const std::vector<Point> &alive_cells,
+                 std::ostream *log = &std::clog);
+  /// @brief return settings of the game, tuned on the cells if autotune is
+  /// set
+  static GameOfLifeSettings
+  MakeSettings(const std::uint32_t rows, const std::uint32_t columns,
+               const GameOfLifeSettings &settings,
+               const std::vector<Point> &alive_cells,
+               std::ostream *log = &std::clog);
+};
+
+#endif // INCLUDE_TUNING_GAME_OF_LIFE_FACTORY_H_
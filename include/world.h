@@ -6,15 +6,16 @@
 #define INCLUDE_WORLD_H_
 #include "cell.h"
 #include "initial_figures/initial_figure.h"
+#include "packed_grid.h"
 #include "rules/rules.h"
+#include "statistics/world_statistics.h"
+#include "world_cells.h"
 #include "world_hasher.h"
 
 #include <atomic>
 #include <memory>
 #include <vector>
 
-using WorldCells = std::vector<std::vector<Cell>>;
-
 ///
 /// @brief The World store all world's cells and has methods to
 /// change cells state
@@ -23,7 +24,16 @@ class World {
 public:
   /// @brief World is initialized with rows and columns count.
   /// The infinity of the world could be achieved by boundary rules
-  World(const std::uint32_t rows, const std::uint32_t columns);
+  ///
+  /// @param allocate_cells if false, rows are left empty and should be
+  /// allocated with AllocateRows, e.g. by the threads which process them
+  World(const std::uint32_t rows, const std::uint32_t columns,
+        const bool allocate_cells = true);
+  /// @brief allocate cells of rows [begin_row, end_row) which are not
+  /// allocated yet. Memory is first touched by the calling thread, so it is
+  /// placed on the NUMA node of this thread. Different threads could allocate
+  /// different rows simultaneously
+  void AllocateRows(const std::uint32_t begin_row, const std::uint32_t end_row);
   /// @brief cell at row and column is marked as alive, cell neighbours are
   /// updated to increase number of alive cells
   void MakeCellAlive(const std::uint32_t row, const std::uint32_t column,
@@ -50,15 +60,53 @@ public:
   void UpdateHash();
   /// @brief return number of worlds with the same hashes
   std::uint32_t GetEqualWorldsCount();
+  /// @brief return number of stored world hashes
+  std::uint64_t GetHashesCount();
+  /// @brief forget hashes of previous generations
+  void ResetHashes();
+  /// @brief return cells packed one bit per cell. The packed copy is kept in
+  /// sync by MakeCellAlive and MakeCellDied
+  const PackedGrid &GetPackedCells() const;
+  /// @brief change state of every cell which differs from new cells. Cells
+  /// are changed by MakeCellAlive and MakeCellDied, so neighbours and hash
+  /// stay consistent
+  ///
+  /// @param new_cells cells of the same size as the world
+  void ApplyPackedCells(const PackedGrid &new_cells, const GameRules &rules);
+  /// @brief replace cells of rows by new rows at once. Changed cells are
+  /// found by words, then hash of the rows and neighbours of cells around
+  /// changed cells are calculated once from packed cells. Only the rows and
+  /// the rows around them are visited
+  ///
+  /// @param new_rows at most rows count rows of the world width, row i
+  /// replaces world row (first_row + i) modulo rows count
+  void ReplaceRows(const PackedGrid &new_rows, const std::uint32_t first_row,
+                   const GameRules &rules);
+  /// @brief return statistics which are updated on every cell change
+  const WorldStatistics &GetStatistics() const;
+  /// @brief return statistics, e.g. to take changed tiles
+  WorldStatistics &GetStatistics();
+  /// @brief reset births and deaths before cells of the next generation are
+  /// changed
+  void StartGeneration();
 
 private:
   /// @brief update neighbours of current cell in case state of the cell was
   /// changed
   void SetCellNeighbours(const std::uint32_t row, const std::uint32_t column,
                          const GameRules &rules);
+  /// @brief count alive neighbours of cell from packed cells
+  std::uint8_t CountNeighbours(const std::uint32_t row,
+                               const std::uint32_t column,
+                               const GameRules &rules) const;
 
   /// @brief cells of the world
   WorldCells cells;
+  /// @brief alive state of cells, one bit per cell. Every row starts with a
+  /// new word, so threads which own different rows never write the same word
+  PackedGrid packed_cells;
+  /// @brief population, births, deaths, bounding box and centroid
+  WorldStatistics statistics;
   /// @brief hasher calculate current hash and stores previous hashes
   WorldHasher hasher;
   /// @brief stores count of alive cells
@@ -0,0 +1,77 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef INCLUDE_WORLD_CELLS_H_
+#define INCLUDE_WORLD_CELLS_H_
+#include "cell.h"
+#include "memory/huge_page_buffer.h"
+
+#include <cstdint>
+#include <vector>
+
+///
+/// @brief The CellRowView gives access to cells of one row
+///
+template <typename CellType> class CellRowView {
+public:
+  CellRowView(CellType *cells, const std::uint32_t size)
+      : cells(cells), row_size(size) {}
+  /// @brief return cell at column
+  CellType &operator[](const std::uint32_t column) const {
+    return cells[column];
+  }
+  /// @brief return count of cells in the row, 0 if row is not allocated
+  std::uint32_t size() const { return row_size; }
+  /// @brief true if row is not allocated
+  bool empty() const { return row_size == 0; }
+
+private:
+  CellType *cells;
+  std::uint32_t row_size;
+};
+
+using CellRow = CellRowView<Cell>;
+using ConstCellRow = CellRowView<const Cell>;
+
+///
+/// @brief The WorldCells stores all cells of the world in one buffer backed
+/// by huge pages if possible. Cells of a row are constructed when the row is
+/// allocated, so memory is first touched by the thread which allocates it
+///
+class WorldCells {
+public:
+  /// @brief WorldCells is initialized with rows and columns count, rows are
+  /// not allocated
+  WorldCells(const std::uint32_t rows, const std::uint32_t columns);
+  /// @brief destroy cells of allocated rows
+  ~WorldCells();
+  WorldCells(const WorldCells &) = delete;
+  WorldCells &operator=(const WorldCells &) = delete;
+
+  /// @brief construct cells of rows [begin_row, end_row) which are not
+  /// allocated yet. Different threads could allocate different rows
+  void AllocateRows(const std::uint32_t begin_row, const std::uint32_t end_row);
+  /// @brief return count of rows
+  std::uint32_t size() const;
+  /// @brief return row of cells
+  CellRow operator[](const std::uint32_t row);
+  /// @brief return constant row of cells
+  ConstCellRow operator[](const std::uint32_t row) const;
+  /// @brief return type of pages backing the cells
+  HugePageMode GetHugePageMode() const;
+
+private:
+  /// @brief memory for all cells
+  HugePageBuffer buffer;
+  /// @brief first cell of the world
+  Cell *cells;
+  /// @brief 1 if cells of the row are constructed, one byte per row so rows
+  /// could be allocated from different threads
+  std::vector<std::uint8_t> allocated_rows;
+
+  /// @brief constants for rows and columns count
+  const std::uint32_t cRowsCount, cColumnsCount;
+};
+
+#endif // INCLUDE_WORLD_CELLS_H_
@@ -4,6 +4,8 @@
 ///
 #ifndef INCLUDE_WORLDHASHER_H_
 #define INCLUDE_WORLDHASHER_H_
+#include "packed_grid.h"
+
 #include <cstdint>
 #include <mutex>
 #include <set>
@@ -24,11 +26,20 @@ public:
   void UpdateCellAlive(const std::uint32_t row, const std::uint32_t column);
   /// @brief updates current hash according to new cell value (died)
   void UpdateCellDied(const std::uint32_t row, const std::uint32_t column);
+  /// @brief recalculate current hash of cells of rows [first_row, first_row
+  /// + rows_count) from packed cells at once
+  void UpdateRows(const PackedGrid &cells, const std::uint32_t first_row,
+                  const std::uint32_t rows_count);
   /// @brief calling to UpdateHash indicates that world is generated, check if
   /// hash already exists
   void UpdateHash();
   /// @brief returns count of equal hashes in all generations
   std::uint32_t EqualHashCount();
+  /// @brief returns count of stored hashes
+  std::uint64_t HashesCount();
+  /// @brief forget hashes of all generations, e.g. when the world is
+  /// rewound and the same generations will be calculated again
+  void Reset();
 
 private:
   /// @brief calculates index in hash vector, to which this row and column is
@@ -0,0 +1,16 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "async/async_step.h"
+
+CancellationToken::CancellationToken()
+    : is_cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CancellationToken::Cancel() { is_cancelled->store(true); }
+
+bool CancellationToken::IsCancelled() const { return is_cancelled->load(); }
+
+AsyncStepOptions::AsyncStepOptions()
+    : progress(), progress_period(0), time_budget(0), cancellation(),
+      executor(nullptr) {}
@@ -0,0 +1,72 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "async/step_executor.h"
+
+#include <algorithm>
+
+StepExecutor::StepExecutor(const std::uint32_t threads_count)
+    : is_stopped(false) {
+  const std::uint32_t count =
+      threads_count ? threads_count
+                    : std::max(1U, std::thread::hardware_concurrency());
+  for (std::uint32_t thread_num = 0; thread_num < count; thread_num++) {
+    threads.emplace_back(&StepExecutor::RunThread, this);
+  }
+}
+
+StepExecutor::~StepExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    is_stopped = true;
+  }
+  tasks_available.notify_all();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // slices finished above could have queued their tasks again, so owners of
+  // all unfinished tasks are notified after threads are stopped
+  for (auto &queued : tasks) {
+    if (queued.cancel) {
+      queued.cancel();
+    }
+  }
+  tasks.clear();
+}
+
+void StepExecutor::Submit(const Task &task, const CancelTask &cancel) {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    tasks.push_back(QueuedTask{task, cancel});
+  }
+  tasks_available.notify_one();
+}
+
+std::uint32_t StepExecutor::GetThreadsCount() const { return threads.size(); }
+
+StepExecutor &StepExecutor::GetDefault() {
+  static StepExecutor executor;
+  return executor;
+}
+
+void StepExecutor::RunThread() {
+  while (true) {
+    QueuedTask queued;
+    {
+      std::unique_lock<std::mutex> lock(tasks_mutex);
+      tasks_available.wait(lock,
+                           [this] { return is_stopped || !tasks.empty(); });
+      if (is_stopped) {
+        return;
+      }
+      queued = std::move(tasks.front());
+      tasks.pop_front();
+    }
+
+    if (queued.task()) {
+      Submit(queued.task, queued.cancel);
+    }
+  }
+}
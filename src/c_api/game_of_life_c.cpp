@@ -0,0 +1,186 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "c_api/game_of_life_c.h"
+#include "game_of_life.h"
+#include "tuning/game_of_life_factory.h"
+
+#include <iostream>
+#include <new>
+
+///
+/// @brief The gol_world owns the game behind the C handle
+///
+struct gol_world {
+  gol_world(const std::uint32_t rows, const std::uint32_t columns,
+            const GameOfLifeSettings &settings)
+      : game(new GameOfLife(rows, columns, settings)), settings(settings),
+        rows(rows), columns(columns) {}
+
+  std::unique_ptr<GameOfLife> game;
+  /// @brief settings of the game, autotune is reset when the game is tuned
+  GameOfLifeSettings settings;
+  const std::uint32_t rows, columns;
+};
+
+namespace {
+GameOfLifeSettings MakeSettings(const gol_settings *settings) {
+  GameOfLifeSettings game_settings;
+  if (!settings) {
+    return game_settings;
+  }
+  game_settings.threads_count = settings->threads_count;
+  game_settings.autotune = settings->autotune != 0;
+  if (settings->autotune_profile_path) {
+    game_settings.autotune_profile_path = settings->autotune_profile_path;
+  }
+  switch (settings->engine) {
+  case GOL_ENGINE_TEMPORAL_BLOCKING:
+    game_settings.engine = GenerationEngineType::TemporalBlocking;
+    break;
+  case GOL_ENGINE_LOOKUP_TABLE:
+    game_settings.engine = GenerationEngineType::LookupTable;
+    break;
+  case GOL_ENGINE_PER_CELL:
+  default:
+    game_settings.engine = GenerationEngineType::PerCell;
+  }
+  return game_settings;
+}
+
+/// @brief fill the world with cells, the game is tuned on the first cells
+/// if autotune is set
+void LoadCells(gol_world *world, const std::vector<Point> &alive_cells) {
+  if (world->settings.autotune) {
+    world->game = GameOfLifeFactory::MakeGameOfLife(
+        world->rows, world->columns, world->settings, alive_cells);
+    world->settings.autotune = false;
+    return;
+  }
+  world->game->FillInitialPicture(alive_cells);
+}
+} // namespace
+
+uint32_t gol_api_version(void) { return GOL_API_VERSION; }
+
+gol_world *gol_world_create(uint32_t rows, uint32_t columns,
+                            const gol_settings *settings) {
+  if (rows == 0 || columns == 0) {
+    return nullptr;
+  }
+  try {
+    return new gol_world(rows, columns, MakeSettings(settings));
+  } catch (const std::exception &exception) {
+    std::cerr << "Can't create the world: " << exception.what() << std::endl;
+    return nullptr;
+  } catch (...) {
+    std::cerr << "Can't create the world" << std::endl;
+    return nullptr;
+  }
+}
+
+void gol_world_destroy(gol_world *world) { delete world; }
+
+gol_status gol_world_load_cells(gol_world *world, const uint32_t *cells,
+                                size_t cells_count) {
+  if (!world || (!cells && cells_count)) {
+    return GOL_ERROR_INVALID_ARGUMENT;
+  }
+  try {
+    std::vector<Point> alive_cells;
+    alive_cells.reserve(cells_count);
+    for (size_t cell = 0; cell < cells_count; cell++) {
+      const uint32_t row = cells[2 * cell];
+      const uint32_t column = cells[2 * cell + 1];
+      if (row >= world->rows || column >= world->columns) {
+        return GOL_ERROR_INVALID_ARGUMENT;
+      }
+      alive_cells.push_back({row, column});
+    }
+    LoadCells(world, alive_cells);
+  } catch (const std::bad_alloc &) {
+    return GOL_ERROR_OUT_OF_MEMORY;
+  } catch (...) {
+    return GOL_ERROR_INTERNAL;
+  }
+  return GOL_OK;
+}
+
+gol_status gol_world_load_pattern(gol_world *world, const char *pattern,
+                                  uint32_t row, uint32_t column) {
+  if (!world || !pattern || row >= world->rows || column >= world->columns) {
+    return GOL_ERROR_INVALID_ARGUMENT;
+  }
+  try {
+    std::vector<Point> alive_cells;
+    std::uint32_t pattern_row = 0, pattern_column = 0;
+    for (const char *symbol = pattern; *symbol; symbol++) {
+      if (*symbol == '/' || *symbol == '\n') {
+        pattern_row++;
+        pattern_column = 0;
+        continue;
+      }
+      if (*symbol == 'o' || *symbol == '*') {
+        alive_cells.push_back(
+            {static_cast<std::uint32_t>(
+                 (static_cast<std::uint64_t>(row) + pattern_row) %
+                 world->rows),
+             static_cast<std::uint32_t>(
+                 (static_cast<std::uint64_t>(column) + pattern_column) %
+                 world->columns)});
+      }
+      pattern_column++;
+    }
+    LoadCells(world, alive_cells);
+  } catch (const std::bad_alloc &) {
+    return GOL_ERROR_OUT_OF_MEMORY;
+  } catch (...) {
+    return GOL_ERROR_INTERNAL;
+  }
+  return GOL_OK;
+}
+
+gol_status gol_world_step(gol_world *world, uint32_t generations) {
+  if (!world) {
+    return GOL_ERROR_INVALID_ARGUMENT;
+  }
+  try {
+    if (generations == 1) {
+      world->game->ExecuteNextGeneration();
+    } else {
+      world->game->StepGenerations(generations);
+    }
+  } catch (const std::bad_alloc &) {
+    return GOL_ERROR_OUT_OF_MEMORY;
+  } catch (...) {
+    return GOL_ERROR_INTERNAL;
+  }
+  return GOL_OK;
+}
+
+int gol_world_is_game_over(gol_world *world) {
+  return world && world->game->IsGameOver() ? 1 : 0;
+}
+
+uint32_t gol_world_get_generation(const gol_world *world) {
+  return world ? world->game->GetGenerationsCount() : 0;
+}
+
+uint64_t gol_world_get_alive_cells_count(const gol_world *world) {
+  return world ? world->game->GetStatistics().GetSummary().population : 0;
+}
+
+const uint64_t *gol_world_get_cells(const gol_world *world,
+                                    gol_grid_layout *layout) {
+  if (!world) {
+    return nullptr;
+  }
+  const PackedGrid &cells = world->game->GetPackedCells();
+  if (layout) {
+    layout->rows = cells.GetRowCount();
+    layout->columns = cells.GetColumnCount();
+    layout->words_per_row = cells.GetWordsPerRow();
+  }
+  return cells.GetData();
+}
@@ -5,6 +5,8 @@
 ///
 #include "cell.h"
 
+#include <algorithm>
+
 namespace detail {
 CellData::CellData() {
   is_alive = 0;
@@ -45,3 +47,8 @@ void Cell::RemoveNeighbour() {
     data.neighbours_count--;
   }
 }
+
+void Cell::SetNeighboursCount(const std::uint8_t neighbours_count) {
+  std::lock_guard<std::mutex> lock(cell_mutex);
+  data.neighbours_count = std::min(neighbours_count, cMaxNeighboursCount);
+}
@@ -0,0 +1,634 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "census/object_census.h"
+#include "engine/bit_sliced_kernel.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+constexpr std::uint32_t ObjectCensus::cMaxPeriod;
+constexpr std::int32_t ObjectCensus::cJoinDistance;
+constexpr std::int32_t ObjectCensus::cInteractionDistance;
+
+namespace {
+///
+/// @brief The KnownPattern describes a common object by one of its phases,
+/// rows are separated by '/', 'o' is an alive cell
+///
+struct KnownPattern {
+  const char *name;
+  const char *cells;
+};
+
+const KnownPattern cKnownPatterns[] = {
+    {"block", "oo/oo"},
+    {"beehive", ".oo./o..o/.oo."},
+    {"loaf", ".oo./o..o/.o.o/..o."},
+    {"boat", "oo./o.o/.o."},
+    {"ship", "oo./o.o/.oo"},
+    {"tub", ".o./o.o/.o."},
+    {"pond", ".oo./o..o/o..o/.oo."},
+    {"blinker", "ooo"},
+    {"toad", ".ooo/ooo."},
+    {"beacon", "oo../oo../..oo/..oo"},
+    {"glider", ".o./..o/ooo"},
+    {"lwss", ".o..o/o..../o...o/oooo."},
+};
+
+/// @brief FNV-1a hash, stable between runs and platforms
+std::uint32_t HashKey(const std::string &key) {
+  std::uint32_t hash = 2166136261u;
+  for (const char symbol : key) {
+    hash ^= static_cast<std::uint8_t>(symbol);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+} // namespace
+
+ObjectCensus::ObjectCensus(const TotalisticRuleTable &rule_table)
+    : cRuleTable(rule_table), dilated_begin(0), dilated_end(0),
+      first_object_word(0), last_object_word(0),
+      ring_borders(rule_table.GetBordersRule() ==
+                   CellBordersRule::RingBorders) {
+  AddKnownObjects();
+}
+
+std::size_t ObjectCensus::GetKnownShapesCount() const {
+  return known_objects.size();
+}
+
+void ObjectCensus::AddKnownObjects() {
+  for (const auto &pattern : cKnownPatterns) {
+    std::vector<ObjectCell> cells;
+    std::int32_t row = 0, column = 0;
+    for (const char *symbol = pattern.cells; *symbol; symbol++) {
+      if (*symbol == '/') {
+        row++;
+        column = 0;
+        continue;
+      }
+      if (*symbol == 'o') {
+        cells.emplace_back(row, column);
+      }
+      column++;
+    }
+    Simulate(cells, pattern.name);
+  }
+}
+
+std::vector<CensusEntry> ObjectCensus::Take(const PackedGrid &grid) {
+  remaining = grid;
+  if (object.GetRowCount() != grid.GetRowCount() ||
+      object.GetColumnCount() != grid.GetColumnCount()) {
+    object = PackedGrid(grid.GetRowCount(), grid.GetColumnCount());
+  }
+  dilated_row.resize(grid.GetWordsPerRow());
+  dilation_scratch.resize(grid.GetWordsPerRow());
+
+  std::vector<std::vector<ObjectCell>> components;
+  for (std::uint32_t row = 0; row < remaining.GetRowCount(); row++) {
+    const std::uint64_t *remaining_row = remaining.GetRow(row);
+    for (std::uint32_t word = 0; word < remaining.GetWordsPerRow(); word++) {
+      while (remaining_row[word]) {
+        components.emplace_back();
+        ExtractObject(row, word, components.back());
+      }
+    }
+  }
+
+  std::unordered_map<std::string, CensusEntry> entries;
+  for (auto &cells : MergeInteracting(components)) {
+    UnwrapObject(cells);
+    const ObjectInfo &info = Classify(cells);
+    auto entry = entries.find(info.name);
+    if (entry == entries.end()) {
+      entries.emplace(info.name, CensusEntry{info, 1});
+    } else {
+      entry->second.count++;
+    }
+  }
+
+  std::vector<CensusEntry> census;
+  census.reserve(entries.size());
+  for (const auto &entry : entries) {
+    census.push_back(entry.second);
+  }
+  std::sort(census.begin(), census.end(),
+            [](const CensusEntry &left, const CensusEntry &right) {
+              if (left.count != right.count) {
+                return left.count > right.count;
+              }
+              return left.object.name < right.object.name;
+            });
+  return census;
+}
+
+std::uint64_t ObjectCensus::DilateWord(const std::uint64_t *row,
+                                       const std::uint32_t word) const {
+  const std::uint32_t words_per_row = remaining.GetWordsPerRow();
+  const std::uint32_t last_bit = (remaining.GetColumnCount() - 1) % 64;
+
+  std::uint64_t west_carry = 0;
+  if (word > 0) {
+    west_carry = row[word - 1] >> 63;
+  } else if (ring_borders) {
+    west_carry = (row[words_per_row - 1] >> last_bit) & 1;
+  }
+
+  std::uint64_t east = row[word] >> 1;
+  if (word + 1 < words_per_row) {
+    east |= row[word + 1] << 63;
+  } else if (ring_borders) {
+    east |= (row[0] & 1) << last_bit;
+  }
+  return row[word] | (row[word] << 1) | west_carry | east;
+}
+
+void ObjectCensus::DilateRow(const std::uint64_t *row) {
+  const std::uint32_t words_per_row = remaining.GetWordsPerRow();
+  // cJoinDistance is less than 64, so the dilated object spreads at most to
+  // one word at both sides of its span
+  dilated_begin = first_object_word > 0 ? first_object_word - 1 : 0;
+  dilated_end = std::min(last_object_word + 2, words_per_row);
+  if (ring_borders && (dilated_begin == 0 || dilated_end == words_per_row)) {
+    // the object could wrap around the column borders
+    dilated_begin = 0;
+    dilated_end = words_per_row;
+  }
+  // words next to the span are read as empty
+  if (dilated_begin > 0) {
+    dilated_row[dilated_begin - 1] = dilation_scratch[dilated_begin - 1] = 0;
+  }
+  if (dilated_end < words_per_row) {
+    dilated_row[dilated_end] = dilation_scratch[dilated_end] = 0;
+  }
+  std::copy(row + dilated_begin, row + dilated_end,
+            dilated_row.begin() + dilated_begin);
+  for (std::int32_t step = 0; step < cJoinDistance; step++) {
+    dilated_row.swap(dilation_scratch);
+    for (std::uint32_t word = dilated_begin; word < dilated_end; word++) {
+      dilated_row[word] = DilateWord(dilation_scratch.data(), word);
+    }
+    // bits after the last column must stay 0 for ring wrap of next step
+    if (dilated_end == words_per_row) {
+      dilated_row[words_per_row - 1] &= remaining.GetLastWordMask();
+    }
+  }
+}
+
+void ObjectCensus::AddObjectWord(const std::uint32_t word) {
+  first_object_word = std::min(first_object_word, word);
+  last_object_word = std::max(last_object_word, word);
+}
+
+void ObjectCensus::ExtractObject(const std::uint32_t row,
+                                 const std::uint32_t word,
+                                 std::vector<ObjectCell> &cells) {
+  const std::uint32_t rows_count = remaining.GetRowCount();
+
+  std::uint64_t &seed_word = remaining.GetRow(row)[word];
+  const std::uint64_t seed = seed_word & (~seed_word + 1);
+  seed_word &= ~seed;
+  object.GetRow(row)[word] = seed;
+  first_object_word = last_object_word = word;
+  pending_rows.assign(1, row);
+  object_rows.assign(1, row);
+
+  while (!pending_rows.empty()) {
+    const std::uint32_t current_row = pending_rows.back();
+    pending_rows.pop_back();
+    std::uint64_t *object_row = object.GetRow(current_row);
+    std::uint64_t *remaining_row = remaining.GetRow(current_row);
+
+    // grow the object inside the row until it stops changing
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      DilateRow(object_row);
+      for (std::uint32_t current_word = dilated_begin;
+           current_word < dilated_end; current_word++) {
+        const std::uint64_t added =
+            dilated_row[current_word] & remaining_row[current_word];
+        if (added) {
+          object_row[current_word] |= added;
+          remaining_row[current_word] &= ~added;
+          AddObjectWord(current_word);
+          changed = true;
+        }
+      }
+    }
+
+    // spread to the rows above and below, dilated_row is the final row
+    for (std::int32_t offset = -cJoinDistance; offset <= cJoinDistance;
+         offset++) {
+      std::int64_t neighbour_row =
+          static_cast<std::int64_t>(current_row) + offset;
+      if (offset == 0) {
+        continue;
+      }
+      if (neighbour_row < 0 || neighbour_row >= rows_count) {
+        if (!ring_borders) {
+          continue;
+        }
+        neighbour_row = (neighbour_row + rows_count) % rows_count;
+      }
+      std::uint64_t *neighbour_object = object.GetRow(neighbour_row);
+      std::uint64_t *neighbour_remaining = remaining.GetRow(neighbour_row);
+      bool added_any = false;
+      for (std::uint32_t current_word = dilated_begin;
+           current_word < dilated_end; current_word++) {
+        const std::uint64_t added =
+            dilated_row[current_word] & neighbour_remaining[current_word];
+        if (added) {
+          neighbour_object[current_word] |= added;
+          neighbour_remaining[current_word] &= ~added;
+          AddObjectWord(current_word);
+          added_any = true;
+        }
+      }
+      if (added_any) {
+        pending_rows.push_back(neighbour_row);
+        object_rows.push_back(neighbour_row);
+      }
+    }
+  }
+
+  std::sort(object_rows.begin(), object_rows.end());
+  object_rows.erase(std::unique(object_rows.begin(), object_rows.end()),
+                    object_rows.end());
+  cells.clear();
+  for (const std::uint32_t object_row_index : object_rows) {
+    std::uint64_t *object_row = object.GetRow(object_row_index);
+    for (std::uint32_t current_word = first_object_word;
+         current_word <= last_object_word; current_word++) {
+      std::uint64_t bits = object_row[current_word];
+      while (bits) {
+        cells.emplace_back(object_row_index,
+                           current_word * 64 + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+      object_row[current_word] = 0;
+    }
+  }
+}
+
+void ObjectCensus::UnwrapObject(std::vector<ObjectCell> &cells) const {
+  if (!ring_borders) {
+    return;
+  }
+
+  const auto unwrap = [&cells](const bool by_rows, const std::int32_t size) {
+    std::vector<std::int32_t> values;
+    values.reserve(cells.size());
+    for (const auto &cell : cells) {
+      values.push_back(by_rows ? cell.first : cell.second);
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    if (values.front() != 0 || values.back() != size - 1) {
+      return;
+    }
+
+    // the object continues after the largest gap between its lines
+    std::int32_t start = values.front();
+    std::int32_t largest_gap = values.front() + size - values.back();
+    for (std::size_t index = 1; index < values.size(); index++) {
+      const std::int32_t gap = values[index] - values[index - 1];
+      if (gap > largest_gap) {
+        largest_gap = gap;
+        start = values[index];
+      }
+    }
+    for (auto &cell : cells) {
+      std::int32_t &value = by_rows ? cell.first : cell.second;
+      if (value < start) {
+        value += size;
+      }
+    }
+  };
+
+  unwrap(true, remaining.GetRowCount());
+  unwrap(false, remaining.GetColumnCount());
+}
+
+std::vector<std::vector<ObjectCensus::ObjectCell>>
+ObjectCensus::MergeInteracting(
+    const std::vector<std::vector<ObjectCell>> &components) {
+  const std::int64_t rows = remaining.GetRowCount();
+  const std::int64_t columns = remaining.GetColumnCount();
+  std::unordered_map<std::int64_t, std::uint32_t> cell_components;
+  for (std::uint32_t index = 0; index < components.size(); index++) {
+    for (const auto &cell : components[index]) {
+      cell_components.emplace(cell.first * columns + cell.second, index);
+    }
+  }
+
+  // only components with cells at most cInteractionDistance apart could
+  // change each other, they share a dead neighbour
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> close_pairs;
+  for (std::uint32_t index = 0; index < components.size(); index++) {
+    for (const auto &cell : components[index]) {
+      for (std::int32_t d_row = -cInteractionDistance;
+           d_row <= cInteractionDistance; d_row++) {
+        for (std::int32_t d_column = -cInteractionDistance;
+             d_column <= cInteractionDistance; d_column++) {
+          std::int64_t row = cell.first + d_row;
+          std::int64_t column = cell.second + d_column;
+          if (row < 0 || row >= rows || column < 0 || column >= columns) {
+            if (!ring_borders) {
+              continue;
+            }
+            row = (row + rows) % rows;
+            column = (column + columns) % columns;
+          }
+          const auto other = cell_components.find(row * columns + column);
+          if (other != cell_components.end() && other->second > index) {
+            close_pairs.emplace_back(index, other->second);
+          }
+        }
+      }
+    }
+  }
+  std::sort(close_pairs.begin(), close_pairs.end());
+  close_pairs.erase(std::unique(close_pairs.begin(), close_pairs.end()),
+                    close_pairs.end());
+
+  // merged objects are tested again with their other close components,
+  // until no pair of objects interacts
+  std::vector<std::uint32_t> parents(components.size());
+  std::vector<std::vector<ObjectCell>> objects = components;
+  for (std::uint32_t index = 0; index < parents.size(); index++) {
+    parents[index] = index;
+  }
+  const auto find_root = [&parents](std::uint32_t index) {
+    while (parents[index] != index) {
+      index = parents[index] = parents[parents[index]];
+    }
+    return index;
+  };
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (const auto &pair : close_pairs) {
+      const std::uint32_t first = find_root(pair.first);
+      const std::uint32_t second = find_root(pair.second);
+      if (first != second && Interact(objects[first], objects[second])) {
+        objects[first].insert(objects[first].end(), objects[second].begin(),
+                              objects[second].end());
+        objects[second].clear();
+        parents[second] = first;
+        merged = true;
+      }
+    }
+  }
+
+  std::vector<std::vector<ObjectCell>> result;
+  for (std::uint32_t index = 0; index < objects.size(); index++) {
+    if (parents[index] == index) {
+      result.push_back(std::move(objects[index]));
+    }
+  }
+  return result;
+}
+
+bool ObjectCensus::Interact(const std::vector<ObjectCell> &first,
+                            const std::vector<ObjectCell> &second) {
+  std::vector<ObjectCell> cells = first;
+  cells.insert(cells.end(), second.begin(), second.end());
+  UnwrapObject(cells);
+  cells = Normalize(cells);
+  std::int32_t height = 0, width = 0;
+  for (const auto &cell : cells) {
+    height = std::max(height, cell.first + 1);
+    width = std::max(width, cell.second + 1);
+  }
+
+  // the objects are stepped together and apart in the same frame, they
+  // interact if the union of separate evolutions differs from the common one
+  constexpr std::int32_t margin = cMaxPeriod + 2;
+  const TotalisticRuleTable isolated_rules(cRuleTable.GetBirthMask(),
+                                           cRuleTable.GetSurvivalMask(),
+                                           CellBordersRule::LimitedBorders);
+  PackedGrid together(height + 2 * margin, width + 2 * margin);
+  PackedGrid apart_first(together.GetRowCount(), together.GetColumnCount());
+  PackedGrid apart_second(together.GetRowCount(), together.GetColumnCount());
+  PackedGrid next(together.GetRowCount(), together.GetColumnCount());
+  const BitSlicedKernel kernel(isolated_rules, together.GetColumnCount());
+  for (std::size_t index = 0; index < cells.size(); index++) {
+    const std::int32_t row = cells[index].first + margin;
+    const std::int32_t column = cells[index].second + margin;
+    together.Set(row, column, true);
+    (index < first.size() ? apart_first : apart_second).Set(row, column, true);
+  }
+
+  for (std::uint32_t generation = 1; generation <= cMaxPeriod; generation++) {
+    kernel.StepGrid(together, next);
+    std::swap(together, next);
+    kernel.StepGrid(apart_first, next);
+    std::swap(apart_first, next);
+    kernel.StepGrid(apart_second, next);
+    std::swap(apart_second, next);
+    for (std::uint32_t row = 0; row < together.GetRowCount(); row++) {
+      const std::uint64_t *together_row = together.GetRow(row);
+      const std::uint64_t *first_row = apart_first.GetRow(row);
+      const std::uint64_t *second_row = apart_second.GetRow(row);
+      for (std::uint32_t word = 0; word < together.GetWordsPerRow(); word++) {
+        if (together_row[word] != (first_row[word] | second_row[word])) {
+          return true;
+        }
+      }
+    }
+  }
+  // parts which are not objects alone, like separated cells of spaceships,
+  // belong to the object they form together
+  if (Classify(cells).kind == ObjectKind::Unknown) {
+    return false;
+  }
+  const std::vector<ObjectCell> first_cells(cells.begin(),
+                                            cells.begin() + first.size());
+  const std::vector<ObjectCell> second_cells(cells.begin() + first.size(),
+                                             cells.end());
+  return Classify(first_cells).kind == ObjectKind::Unknown ||
+         Classify(second_cells).kind == ObjectKind::Unknown;
+}
+
+const ObjectInfo &
+ObjectCensus::Classify(const std::vector<ObjectCell> &cells) {
+  const std::string key = Canonicalize(cells);
+  auto known_object = known_objects.find(key);
+  if (known_object != known_objects.end()) {
+    return known_object->second;
+  }
+  Simulate(cells, "");
+  return known_objects.at(key);
+}
+
+ObjectInfo ObjectCensus::Simulate(const std::vector<ObjectCell> &cells,
+                                  const std::string &name) {
+  const std::vector<ObjectCell> start_cells = Normalize(cells);
+  std::int32_t height = 0, width = 0;
+  for (const auto &cell : start_cells) {
+    height = std::max(height, cell.first + 1);
+    width = std::max(width, cell.second + 1);
+  }
+
+  // the object moves at most one cell per generation, so it never reaches
+  // the borders of the isolated grid while the period is searched
+  constexpr std::int32_t margin = cMaxPeriod + 2;
+  const TotalisticRuleTable isolated_rules(cRuleTable.GetBirthMask(),
+                                           cRuleTable.GetSurvivalMask(),
+                                           CellBordersRule::LimitedBorders);
+  PackedGrid current(height + 2 * margin, width + 2 * margin);
+  PackedGrid next(current.GetRowCount(), current.GetColumnCount());
+  const BitSlicedKernel kernel(isolated_rules, current.GetColumnCount());
+  for (const auto &cell : start_cells) {
+    current.Set(cell.first + margin, cell.second + margin, true);
+  }
+
+  const std::string start_key = Encode(start_cells);
+  std::vector<std::string> phase_keys{Canonicalize(start_cells)};
+  ObjectInfo info{"", ObjectKind::Unknown, 0};
+  for (std::uint32_t generation = 1; generation <= cMaxPeriod; generation++) {
+    kernel.StepGrid(current, next);
+    std::swap(current, next);
+    const std::vector<ObjectCell> phase_cells = GetCells(current);
+    if (phase_cells.empty()) {
+      break;
+    }
+    const std::vector<ObjectCell> normalized_cells = Normalize(phase_cells);
+    if (Encode(normalized_cells) == start_key) {
+      std::int32_t top_row = std::numeric_limits<std::int32_t>::max();
+      std::int32_t left_column = std::numeric_limits<std::int32_t>::max();
+      for (const auto &cell : phase_cells) {
+        top_row = std::min(top_row, cell.first);
+        left_column = std::min(left_column, cell.second);
+      }
+      info.period = generation;
+      if (top_row != margin || left_column != margin) {
+        info.kind = ObjectKind::Spaceship;
+      } else if (generation == 1) {
+        info.kind = ObjectKind::StillLife;
+      } else {
+        info.kind = ObjectKind::Oscillator;
+      }
+      break;
+    }
+    phase_keys.push_back(Canonicalize(normalized_cells));
+  }
+
+  if (info.kind == ObjectKind::Unknown) {
+    phase_keys.resize(1);
+  }
+  if (info.kind != ObjectKind::Unknown && !name.empty()) {
+    info.name = name;
+  } else {
+    // the smallest phase key names the object, whatever phase is seen first
+    const std::string &name_key =
+        *std::min_element(phase_keys.begin(), phase_keys.end());
+    char code[32];
+    switch (info.kind) {
+    case ObjectKind::StillLife:
+      std::snprintf(code, sizeof(code), "xs%zu_%08x", start_cells.size(),
+                    HashKey(name_key));
+      break;
+    case ObjectKind::Oscillator:
+      std::snprintf(code, sizeof(code), "xp%u_%08x", info.period,
+                    HashKey(name_key));
+      break;
+    case ObjectKind::Spaceship:
+      std::snprintf(code, sizeof(code), "xq%u_%08x", info.period,
+                    HashKey(name_key));
+      break;
+    case ObjectKind::Unknown:
+    default:
+      std::snprintf(code, sizeof(code), "xx%zu_%08x", start_cells.size(),
+                    HashKey(name_key));
+    }
+    info.name = code;
+  }
+
+  for (const auto &phase_key : phase_keys) {
+    known_objects.emplace(phase_key, info);
+  }
+  return info;
+}
+
+std::vector<ObjectCensus::ObjectCell>
+ObjectCensus::Normalize(std::vector<ObjectCell> cells) {
+  std::int32_t top_row = std::numeric_limits<std::int32_t>::max();
+  std::int32_t left_column = std::numeric_limits<std::int32_t>::max();
+  for (const auto &cell : cells) {
+    top_row = std::min(top_row, cell.first);
+    left_column = std::min(left_column, cell.second);
+  }
+  for (auto &cell : cells) {
+    cell.first -= top_row;
+    cell.second -= left_column;
+  }
+  return cells;
+}
+
+std::string ObjectCensus::Encode(const std::vector<ObjectCell> &cells) {
+  std::int32_t height = 0, width = 0;
+  for (const auto &cell : cells) {
+    height = std::max(height, cell.first + 1);
+    width = std::max(width, cell.second + 1);
+  }
+  std::string key = std::to_string(height) + "x" + std::to_string(width) + ":";
+  const std::size_t header_size = key.size();
+  key.resize(header_size + (static_cast<std::size_t>(height) * width + 7) / 8,
+             '\0');
+  for (const auto &cell : cells) {
+    const std::size_t bit =
+        static_cast<std::size_t>(cell.first) * width + cell.second;
+    key[header_size + bit / 8] |= static_cast<char>(1 << (bit % 8));
+  }
+  return key;
+}
+
+std::string ObjectCensus::Canonicalize(const std::vector<ObjectCell> &cells) {
+  std::string canonical_key;
+  std::vector<ObjectCell> transformed(cells.size());
+  for (std::uint32_t transformation = 0; transformation < 8;
+       transformation++) {
+    for (std::size_t index = 0; index < cells.size(); index++) {
+      std::int32_t row = cells[index].first;
+      std::int32_t column = cells[index].second;
+      if (transformation & 4) {
+        std::swap(row, column);
+      }
+      if (transformation & 2) {
+        row = -row;
+      }
+      if (transformation & 1) {
+        column = -column;
+      }
+      transformed[index] = ObjectCell(row, column);
+    }
+    const std::string key = Encode(Normalize(transformed));
+    if (transformation == 0 || key < canonical_key) {
+      canonical_key = key;
+    }
+  }
+  return canonical_key;
+}
+
+std::vector<ObjectCensus::ObjectCell>
+ObjectCensus::GetCells(const PackedGrid &grid) {
+  std::vector<ObjectCell> cells;
+  for (std::uint32_t row = 0; row < grid.GetRowCount(); row++) {
+    const std::uint64_t *grid_row = grid.GetRow(row);
+    for (std::uint32_t word = 0; word < grid.GetWordsPerRow(); word++) {
+      std::uint64_t bits = grid_row[word];
+      while (bits) {
+        cells.emplace_back(row, word * 64 + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+  return cells;
+}
@@ -0,0 +1,44 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "continuous/continuous_world.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+ContinuousWorld::ContinuousWorld(const std::uint32_t rows,
+                                 const std::uint32_t columns)
+    : cRowsCount(rows), cColumnsCount(columns),
+      cells(static_cast<std::size_t>(rows) * columns, 0) {}
+
+double ContinuousWorld::Get(const std::uint32_t row,
+                            const std::uint32_t column) const {
+  if (row >= cRowsCount || column >= cColumnsCount) {
+    return 0;
+  }
+  return cells[static_cast<std::size_t>(row) * cColumnsCount + column];
+}
+
+void ContinuousWorld::Set(const std::uint32_t row, const std::uint32_t column,
+                          const double value) {
+  if (row >= cRowsCount || column >= cColumnsCount) {
+    std::cerr << "Incorrect column or row" << std::endl;
+    return;
+  }
+  cells[static_cast<std::size_t>(row) * cColumnsCount + column] =
+      std::min(1.0, std::max(0.0, value));
+}
+
+const std::vector<double> &ContinuousWorld::GetCells() const { return cells; }
+
+std::vector<double> &ContinuousWorld::GetCells() { return cells; }
+
+double ContinuousWorld::GetMass() const {
+  return std::accumulate(cells.begin(), cells.end(), 0.0);
+}
+
+std::uint32_t ContinuousWorld::GetRowCount() const { return cRowsCount; }
+
+std::uint32_t ContinuousWorld::GetColumnCount() const { return cColumnsCount; }
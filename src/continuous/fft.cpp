@@ -0,0 +1,249 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "continuous/fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+constexpr double cPi = 3.14159265358979323846;
+
+bool IsPowerOfTwo(const std::uint32_t value) {
+  return value && !(value & (value - 1));
+}
+
+std::vector<std::uint32_t> GetReversedIndexes(const std::uint32_t length) {
+  std::vector<std::uint32_t> reversed(length, 0);
+  std::uint32_t bits = 0;
+  while ((1U << bits) < length) {
+    bits++;
+  }
+  for (std::uint32_t index = 0; index < length; index++) {
+    for (std::uint32_t bit = 0; bit < bits; bit++) {
+      reversed[index] |= ((index >> bit) & 1) << (bits - 1 - bit);
+    }
+  }
+  return reversed;
+}
+} // namespace
+
+Fft::Fft(const std::uint32_t length) : cLength(length), radix_length(1) {
+  if (IsPowerOfTwo(length)) {
+    radix_length = length;
+  } else {
+    // linear convolution of length values with 2 * length - 1 chirp values
+    while (radix_length < 2 * length - 1) {
+      radix_length *= 2;
+    }
+  }
+  twiddles.resize(radix_length / 2);
+  for (std::uint32_t index = 0; index < radix_length / 2; index++) {
+    twiddles[index] = std::polar(1.0, -2 * cPi * index / radix_length);
+  }
+  reversed = GetReversedIndexes(radix_length);
+
+  if (radix_length == length) {
+    return;
+  }
+  chirp.resize(length);
+  for (std::uint64_t index = 0; index < length; index++) {
+    // k^2 mod 2 * length keeps the angle exact for long transforms
+    const std::uint64_t square = (index * index) % (2ULL * length);
+    chirp[index] = std::polar(1.0, -cPi * square / length);
+  }
+  chirp_spectrum.assign(radix_length, Complex(0, 0));
+  chirp_spectrum[0] = std::conj(chirp[0]);
+  for (std::uint32_t index = 1; index < length; index++) {
+    chirp_spectrum[index] = std::conj(chirp[index]);
+    chirp_spectrum[radix_length - index] = std::conj(chirp[index]);
+  }
+  TransformPowerOfTwo(chirp_spectrum.data(), radix_length, twiddles,
+                      reversed);
+}
+
+std::uint32_t Fft::GetLength() const { return cLength; }
+
+void Fft::TransformPowerOfTwo(
+    Complex *data, const std::uint32_t length,
+    const std::vector<Complex> &twiddles,
+    const std::vector<std::uint32_t> &reversed) const {
+  for (std::uint32_t index = 0; index < length; index++) {
+    if (index < reversed[index]) {
+      std::swap(data[index], data[reversed[index]]);
+    }
+  }
+  for (std::uint32_t half = 1; half < length; half *= 2) {
+    const std::uint32_t twiddle_step = length / (2 * half);
+    for (std::uint32_t start = 0; start < length; start += 2 * half) {
+      for (std::uint32_t index = 0; index < half; index++) {
+        const Complex odd =
+            data[start + index + half] * twiddles[index * twiddle_step];
+        data[start + index + half] = data[start + index] - odd;
+        data[start + index] += odd;
+      }
+    }
+  }
+}
+
+void Fft::TransformForward(Complex *data,
+                           std::vector<Complex> &scratch) const {
+  if (radix_length == cLength) {
+    TransformPowerOfTwo(data, cLength, twiddles, reversed);
+    return;
+  }
+
+  scratch.assign(radix_length, Complex(0, 0));
+  for (std::uint32_t index = 0; index < cLength; index++) {
+    scratch[index] = data[index] * chirp[index];
+  }
+  TransformPowerOfTwo(scratch.data(), radix_length, twiddles, reversed);
+  // inverse transform is the forward one of conjugated values
+  for (std::uint32_t index = 0; index < radix_length; index++) {
+    scratch[index] = std::conj(scratch[index] * chirp_spectrum[index]);
+  }
+  TransformPowerOfTwo(scratch.data(), radix_length, twiddles, reversed);
+  for (std::uint32_t index = 0; index < cLength; index++) {
+    data[index] =
+        std::conj(scratch[index]) * chirp[index] / double(radix_length);
+  }
+}
+
+void Fft::Transform(Complex *data, const bool inverse,
+                    std::vector<Complex> &scratch) const {
+  if (!inverse) {
+    TransformForward(data, scratch);
+    return;
+  }
+  for (std::uint32_t index = 0; index < cLength; index++) {
+    data[index] = std::conj(data[index]);
+  }
+  TransformForward(data, scratch);
+  for (std::uint32_t index = 0; index < cLength; index++) {
+    data[index] = std::conj(data[index]);
+  }
+}
+
+RealFft2d::RealFft2d(const std::uint32_t rows, const std::uint32_t columns,
+                     const std::uint32_t threads_count)
+    : cRowsCount(rows), cColumnsCount(columns),
+      cSpectrumColumns(columns / 2 + 1),
+      cThreadsCount(std::max(1U, threads_count)), row_fft(columns),
+      column_fft(rows), lines(cThreadsCount), scratches(cThreadsCount) {}
+
+std::uint32_t RealFft2d::GetSpectrumColumns() const {
+  return cSpectrumColumns;
+}
+
+template <typename Function>
+void RealFft2d::ParallelFor(const std::uint32_t count,
+                            const Function &function) {
+  const std::uint32_t threads_count = std::min(cThreadsCount, count);
+  if (threads_count <= 1) {
+    function(0, count, 0);
+    return;
+  }
+  std::vector<std::thread> threads;
+  for (std::uint32_t thread = 1; thread < threads_count; thread++) {
+    threads.emplace_back(function, count * thread / threads_count,
+                         count * (thread + 1) / threads_count, thread);
+  }
+  function(0, count / threads_count, 0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void RealFft2d::TransformColumns(std::vector<Complex> &spectrum,
+                                 const bool inverse) {
+  ParallelFor(cSpectrumColumns, [&](const std::uint32_t begin,
+                                    const std::uint32_t end,
+                                    const std::uint32_t thread) {
+    std::vector<Complex> &line = lines[thread];
+    line.resize(cRowsCount);
+    for (std::uint32_t column = begin; column < end; column++) {
+      for (std::uint32_t row = 0; row < cRowsCount; row++) {
+        line[row] = spectrum[row * cSpectrumColumns + column];
+      }
+      column_fft.Transform(line.data(), inverse, scratches[thread]);
+      for (std::uint32_t row = 0; row < cRowsCount; row++) {
+        spectrum[row * cSpectrumColumns + column] = line[row];
+      }
+    }
+  });
+}
+
+void RealFft2d::Forward(const double *input, std::vector<Complex> &spectrum) {
+  spectrum.resize(static_cast<std::size_t>(cRowsCount) * cSpectrumColumns);
+  const std::uint32_t pairs_count = (cRowsCount + 1) / 2;
+  ParallelFor(pairs_count, [&](const std::uint32_t begin,
+                               const std::uint32_t end,
+                               const std::uint32_t thread) {
+    std::vector<Complex> &line = lines[thread];
+    line.resize(cColumnsCount);
+    for (std::uint32_t pair = begin; pair < end; pair++) {
+      const std::uint32_t first = 2 * pair;
+      const bool has_second = first + 1 < cRowsCount;
+      // the second real row is the imaginary part
+      for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+        line[column] = Complex(
+            input[first * cColumnsCount + column],
+            has_second ? input[(first + 1) * cColumnsCount + column] : 0);
+      }
+      row_fft.Transform(line.data(), false, scratches[thread]);
+      for (std::uint32_t column = 0; column < cSpectrumColumns; column++) {
+        const Complex value = line[column];
+        const Complex mirrored =
+            std::conj(line[(cColumnsCount - column) % cColumnsCount]);
+        spectrum[first * cSpectrumColumns + column] = (value + mirrored) / 2.0;
+        if (has_second) {
+          spectrum[(first + 1) * cSpectrumColumns + column] =
+              (value - mirrored) / Complex(0, 2);
+        }
+      }
+    }
+  });
+  TransformColumns(spectrum, false);
+}
+
+void RealFft2d::Inverse(std::vector<Complex> &spectrum, double *output) {
+  TransformColumns(spectrum, true);
+  const double scale = 1.0 / (static_cast<double>(cRowsCount) * cColumnsCount);
+  const std::uint32_t pairs_count = (cRowsCount + 1) / 2;
+  ParallelFor(pairs_count, [&](const std::uint32_t begin,
+                               const std::uint32_t end,
+                               const std::uint32_t thread) {
+    std::vector<Complex> &line = lines[thread];
+    line.resize(cColumnsCount);
+    for (std::uint32_t pair = begin; pair < end; pair++) {
+      const std::uint32_t first = 2 * pair;
+      const bool has_second = first + 1 < cRowsCount;
+      // spectra of real rows are symmetric, the missing half is conjugated
+      for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+        const bool is_stored = column < cSpectrumColumns;
+        const std::uint32_t stored_column =
+            is_stored ? column : cColumnsCount - column;
+        const Complex *first_row = &spectrum[first * cSpectrumColumns];
+        Complex first_value = first_row[stored_column];
+        Complex second_value = has_second
+                                   ? first_row[cSpectrumColumns + stored_column]
+                                   : Complex(0, 0);
+        if (!is_stored) {
+          first_value = std::conj(first_value);
+          second_value = std::conj(second_value);
+        }
+        line[column] = first_value + Complex(0, 1) * second_value;
+      }
+      row_fft.Transform(line.data(), true, scratches[thread]);
+      for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+        output[first * cColumnsCount + column] = line[column].real() * scale;
+        if (has_second) {
+          output[(first + 1) * cColumnsCount + column] =
+              line[column].imag() * scale;
+        }
+      }
+    }
+  });
+}
@@ -0,0 +1,131 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "continuous/lenia_engine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+LeniaSettings::LeniaSettings()
+    : radius(13), peaks({1}), growth_center(0.15), growth_width(0.015),
+      time_step(0.1), alive_level(0.5) {}
+
+LeniaEngine::LeniaEngine(const std::uint32_t rows,
+                         const std::uint32_t columns,
+                         const LeniaSettings &settings,
+                         const std::uint32_t threads_count)
+    : settings(settings), world(rows, columns),
+      fft(rows, columns,
+          threads_count ? threads_count : std::thread::hardware_concurrency()),
+      potentials(static_cast<std::size_t>(rows) * columns, 0),
+      packed(rows, columns) {
+  BuildKernelSpectrum();
+}
+
+double LeniaEngine::GetKernelWeight(const double distance,
+                                    const std::vector<double> &peaks) {
+  if (distance <= 0 || distance >= 1 || peaks.empty()) {
+    return 0;
+  }
+  const double rings = distance * peaks.size();
+  const std::size_t ring =
+      std::min(peaks.size() - 1, static_cast<std::size_t>(rings));
+  const double ring_distance = rings - ring;
+  if (ring_distance <= 0) {
+    return 0;
+  }
+  // smooth bump which is 1 in the middle of the ring and 0 at its borders
+  return peaks[ring] *
+         std::exp(4 - 1 / (ring_distance * (1 - ring_distance)));
+}
+
+void LeniaEngine::BuildKernelSpectrum() {
+  const std::int64_t rows = world.GetRowCount();
+  const std::int64_t columns = world.GetColumnCount();
+  const std::int64_t radius = settings.radius;
+  std::vector<double> kernel(static_cast<std::size_t>(rows) * columns, 0);
+  double sum = 0;
+  for (std::int64_t d_row = -radius; d_row <= radius; d_row++) {
+    for (std::int64_t d_column = -radius; d_column <= radius; d_column++) {
+      const double distance =
+          std::sqrt(static_cast<double>(d_row * d_row + d_column * d_column)) /
+          radius;
+      const double weight = GetKernelWeight(distance, settings.peaks);
+      // the centre of the kernel is cell 0, offsets wrap around
+      const std::int64_t row = ((d_row % rows) + rows) % rows;
+      const std::int64_t column = ((d_column % columns) + columns) % columns;
+      kernel[row * columns + column] += weight;
+      sum += weight;
+    }
+  }
+  if (sum > 0) {
+    for (auto &weight : kernel) {
+      weight /= sum;
+    }
+  }
+  fft.Forward(kernel.data(), kernel_spectrum);
+}
+
+double LeniaEngine::GetGrowth(const double potential) const {
+  const double offset = (potential - settings.growth_center);
+  return 2 * std::exp(-offset * offset /
+                      (2 * settings.growth_width * settings.growth_width)) -
+         1;
+}
+
+void LeniaEngine::StepWorld() {
+  std::vector<double> &cells = world.GetCells();
+  fft.Forward(cells.data(), spectrum);
+  for (std::size_t index = 0; index < spectrum.size(); index++) {
+    spectrum[index] *= kernel_spectrum[index];
+  }
+  fft.Inverse(spectrum, potentials.data());
+
+  for (std::size_t index = 0; index < cells.size(); index++) {
+    cells[index] = std::min(
+        1.0, std::max(0.0, cells[index] + settings.time_step *
+                                              GetGrowth(potentials[index])));
+  }
+}
+
+void LeniaEngine::Step(PackedGrid &grid, const std::uint32_t generations) {
+  const std::uint32_t rows = world.GetRowCount();
+  const std::uint32_t columns = world.GetColumnCount();
+  if (grid.GetRowCount() != rows || grid.GetColumnCount() != columns) {
+    return;
+  }
+
+  // cells changed outside of the engine, e.g. by the initial picture
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      const bool is_alive = grid.Get(row, column);
+      if (is_alive != packed.Get(row, column)) {
+        world.Set(row, column, is_alive ? 1 : 0);
+      }
+    }
+  }
+
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    StepWorld();
+  }
+
+  const std::vector<double> &cells = world.GetCells();
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      packed.Set(row, column,
+                 cells[static_cast<std::size_t>(row) * columns + column] >=
+                     settings.alive_level);
+    }
+  }
+  grid = packed;
+}
+
+const ContinuousWorld &LeniaEngine::GetWorld() const { return world; }
+
+ContinuousWorld &LeniaEngine::GetWorld() { return world; }
+
+const std::vector<double> &LeniaEngine::GetPotentials() const {
+  return potentials;
+}
@@ -0,0 +1,141 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "distributed/band_process.h"
+#include "rules/rules_factory.h"
+
+#include <iostream>
+#include <tuple>
+
+BandProcess::BandProcess(const RowRange &band_rows,
+                         const std::uint32_t columns,
+                         const std::uint32_t band_num,
+                         HaloTransport &transport,
+                         GenerationCoordinator &coordinator)
+    : cBandRows(band_rows),
+      cBandRowsCount(band_rows.end_row - band_rows.begin_row),
+      cColumnsCount(columns), cBandNum(band_num),
+      world(cBandRowsCount + 2, columns),
+      rules(GameRulesFactory::MakeGameRules()), transport(transport),
+      coordinator(coordinator), generation(0) {}
+
+void BandProcess::SetInitialCells(const std::vector<Point> &alive_cells) {
+  for (const auto &alive_cell : alive_cells) {
+    if (alive_cell.x >= cBandRows.begin_row &&
+        alive_cell.x < cBandRows.end_row) {
+      world.MakeCellAlive(alive_cell.x - cBandRows.begin_row + 1, alive_cell.y,
+                          *rules);
+    }
+  }
+}
+
+void BandProcess::PackRow(const std::uint32_t local_row, PackedRow &row) {
+  row.assign((cColumnsCount + 63) / 64, 0);
+  for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+    if (world.GetCellAt(local_row, column).IsAlive()) {
+      row[column / 64] |= 1ULL << (column % 64);
+    }
+  }
+}
+
+void BandProcess::UnpackRow(const PackedRow &row,
+                            const std::uint32_t local_row) {
+  for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+    const bool is_alive = (row[column / 64] >> (column % 64)) & 1;
+    if (is_alive) {
+      world.MakeCellAlive(local_row, column, *rules);
+    } else {
+      world.MakeCellDied(local_row, column, *rules);
+    }
+  }
+}
+
+std::uint64_t BandProcess::GetRowAliveCellsCount(const std::uint32_t local_row) {
+  std::uint64_t alive_cells = 0;
+  for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+    alive_cells += world.GetCellAt(local_row, column).IsAlive();
+  }
+  return alive_cells;
+}
+
+bool BandProcess::ExchangeHalo() {
+  PackRow(1, first_row);
+  PackRow(cBandRowsCount, last_row);
+
+  if (!transport.SendRow(HaloDirection::Up, first_row) ||
+      !transport.SendRow(HaloDirection::Down, last_row) ||
+      !transport.ReceiveRow(HaloDirection::Up, halo_above) ||
+      !transport.ReceiveRow(HaloDirection::Down, halo_below)) {
+    std::cerr << "Band " << cBandNum << " can't exchange halo rows"
+              << std::endl;
+    return false;
+  }
+
+  UnpackRow(halo_above, 0);
+  UnpackRow(halo_below, cBandRowsCount + 1);
+  return true;
+}
+
+void BandProcess::ExecuteNextGeneration() {
+  std::vector<std::tuple<std::uint32_t, std::uint32_t, bool>> new_cell_states;
+  for (std::uint32_t row = 1; row <= cBandRowsCount; row++) {
+    for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+      const auto &cell = world.GetCellAt(row, column);
+      const bool is_cell_alive = rules->GetNewCellState(cell);
+      if (is_cell_alive != cell.IsAlive()) {
+        new_cell_states.push_back(std::make_tuple(row, column, is_cell_alive));
+      }
+    }
+  }
+
+  for (const auto &new_cell_state : new_cell_states) {
+    if (std::get<2>(new_cell_state)) {
+      world.MakeCellAlive(std::get<0>(new_cell_state),
+                          std::get<1>(new_cell_state), *rules);
+    } else {
+      world.MakeCellDied(std::get<0>(new_cell_state),
+                         std::get<1>(new_cell_state), *rules);
+    }
+  }
+}
+
+void BandProcess::ReportGeneration() {
+  // FNV-1a over packed band rows
+  constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+  constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+  std::uint64_t band_hash = fnv_offset;
+  PackedRow row;
+  for (std::uint32_t local_row = 1; local_row <= cBandRowsCount; local_row++) {
+    PackRow(local_row, row);
+    for (const auto word : row) {
+      band_hash = (band_hash ^ word) * fnv_prime;
+    }
+  }
+
+  const std::uint64_t alive_cells = world.GetAliveCellsCount() -
+                                    GetRowAliveCellsCount(0) -
+                                    GetRowAliveCellsCount(cBandRowsCount + 1);
+  coordinator.ReportGeneration(cBandNum, generation, alive_cells, band_hash);
+}
+
+bool BandProcess::Run() {
+  ReportGeneration();
+  while (true) {
+    bool game_over = false;
+    if (!coordinator.WaitDecision(generation, game_over)) {
+      std::cerr << "Band " << cBandNum << " lost the coordinator" << std::endl;
+      return false;
+    }
+    if (game_over) {
+      return true;
+    }
+
+    if (!ExchangeHalo()) {
+      return false;
+    }
+    ExecuteNextGeneration();
+    generation++;
+    ReportGeneration();
+  }
+}
@@ -0,0 +1,110 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "distributed/distributed_game_of_life.h"
+#include "distributed/band_process.h"
+#include "distributed/generation_coordinator.h"
+#include "distributed/shared_memory_transport.h"
+#include "termination/termination_policy_factory.h"
+
+#include <iostream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+DistributedSettings::DistributedSettings()
+    : rows(0), columns(0), bands_count(1),
+      session("game_of_life_" + std::to_string(getpid())),
+      timeout(std::chrono::milliseconds(10000)) {}
+
+DistributedGameOfLife::DistributedGameOfLife(
+    const DistributedSettings &settings)
+    : cSettings(settings) {}
+
+bool DistributedGameOfLife::RunBand(const DistributedSettings &settings,
+                                    const std::uint32_t band_num,
+                                    const std::vector<Point> &initial_cells) {
+  SharedMemoryTransport transport(settings.session, band_num,
+                                  settings.bands_count, settings.timeout);
+  GenerationCoordinator coordinator(settings.session, settings.bands_count,
+                                    false, settings.timeout);
+  if (!transport.IsValid() || !coordinator.IsValid()) {
+    return false;
+  }
+
+  RowPartitioner partitioner(settings.rows, settings.bands_count);
+  BandProcess band(partitioner.GetRange(band_num), settings.columns, band_num,
+                   transport, coordinator);
+  band.SetInitialCells(initial_cells);
+  return band.Run();
+}
+
+DistributedResult
+DistributedGameOfLife::Run(const std::vector<Point> &initial_cells) {
+  DistributedResult result = {false, 0, 0};
+  if (cSettings.bands_count == 0 || cSettings.bands_count > cSettings.rows) {
+    std::cerr << "Count of bands should be from 1 to count of rows"
+              << std::endl;
+    return result;
+  }
+
+  GenerationCoordinator coordinator(cSettings.session, cSettings.bands_count,
+                                    true, cSettings.timeout);
+  const auto rings = SharedMemoryTransport::CreateRings(
+      cSettings.session, cSettings.bands_count, (cSettings.columns + 63) / 64);
+  if (!coordinator.IsValid()) {
+    return result;
+  }
+  for (const auto &ring : rings) {
+    if (!ring->IsValid()) {
+      return result;
+    }
+  }
+
+  std::vector<pid_t> band_pids;
+  for (std::uint32_t band_num = 0; band_num < cSettings.bands_count;
+       band_num++) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+      const bool band_completed = RunBand(cSettings, band_num, initial_cells);
+      _exit(band_completed ? 0 : 1);
+    }
+    if (pid < 0) {
+      std::cerr << "Can't start band " << band_num << std::endl;
+      coordinator.Abort();
+      break;
+    }
+    band_pids.push_back(pid);
+  }
+
+  bool coordinated = band_pids.size() == cSettings.bands_count;
+  const std::unique_ptr<TerminationPolicy> termination =
+      TerminationPolicyFactory::MakeDefaultPolicy();
+  std::uint32_t generation = 0;
+  while (coordinated) {
+    bool game_over = false;
+    if (!coordinator.Decide(generation, *termination, game_over)) {
+      coordinator.Abort();
+      coordinated = false;
+      break;
+    }
+    if (game_over) {
+      break;
+    }
+    generation++;
+  }
+
+  bool bands_completed = true;
+  for (const auto pid : band_pids) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      bands_completed = false;
+    }
+  }
+
+  result.completed = coordinated && bands_completed;
+  result.generations_count = generation;
+  result.alive_cells_count = coordinator.GetAliveCellsCount();
+  return result;
+}
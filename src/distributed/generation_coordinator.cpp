@@ -0,0 +1,147 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "distributed/generation_coordinator.h"
+#include "distributed/shared_memory_ring.h"
+
+#include <fcntl.h>
+#include <iostream>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+GenerationCoordinator::GenerationCoordinator(
+    const std::string &session, const std::uint32_t bands_count,
+    const bool create, const std::chrono::milliseconds timeout)
+    : cName("/" + session + "_coordinator"), cBandsCount(bands_count),
+      cOwner(create), cTimeout(timeout), segment(nullptr),
+      segment_size(sizeof(State) + bands_count * sizeof(BandReport)),
+      equal_worlds_count(0), alive_cells_count(0) {
+  const int descriptor =
+      shm_open(cName.c_str(), create ? (O_CREAT | O_RDWR | O_TRUNC) : O_RDWR,
+               0600);
+  if (descriptor < 0) {
+    std::cerr << "Can't open shared memory " << cName << std::endl;
+    return;
+  }
+  if (create && ftruncate(descriptor, segment_size)) {
+    std::cerr << "Can't resize shared memory " << cName << std::endl;
+    close(descriptor);
+    return;
+  }
+
+  void *mapped = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (mapped == MAP_FAILED) {
+    std::cerr << "Can't map shared memory " << cName << std::endl;
+    return;
+  }
+  segment = mapped;
+
+  if (create) {
+    State *state = new (segment) State();
+    state->decided.store(0);
+    state->game_over.store(0);
+    for (std::uint32_t band_num = 0; band_num < cBandsCount; band_num++) {
+      BandReport *report = new (&GetReport(band_num)) BandReport();
+      report->reported.store(0);
+    }
+  }
+}
+
+GenerationCoordinator::~GenerationCoordinator() {
+  if (segment) {
+    munmap(segment, segment_size);
+  }
+  if (cOwner) {
+    shm_unlink(cName.c_str());
+  }
+}
+
+bool GenerationCoordinator::IsValid() const { return segment != nullptr; }
+
+GenerationCoordinator::BandReport &
+GenerationCoordinator::GetReport(const std::uint32_t band_num) {
+  return reinterpret_cast<BandReport *>(static_cast<State *>(segment) +
+                                        1)[band_num];
+}
+
+void GenerationCoordinator::ReportGeneration(const std::uint32_t band_num,
+                                             const std::uint32_t generation,
+                                             const std::uint64_t alive_cells,
+                                             const std::uint64_t band_hash) {
+  if (!segment || band_num >= cBandsCount) {
+    return;
+  }
+  BandReport &report = GetReport(band_num);
+  report.alive_cells_count = alive_cells;
+  report.band_hash = band_hash;
+  report.reported.store(generation + 1, std::memory_order_release);
+}
+
+bool GenerationCoordinator::WaitDecision(const std::uint32_t generation,
+                                         bool &game_over) {
+  if (!segment) {
+    return false;
+  }
+  State *state = static_cast<State *>(segment);
+  SpinWait wait(cTimeout);
+  while (state->decided.load(std::memory_order_acquire) < generation + 1 &&
+         !state->game_over.load(std::memory_order_acquire)) {
+    if (!wait.Pause()) {
+      return false;
+    }
+  }
+  game_over = state->game_over.load(std::memory_order_acquire);
+  return true;
+}
+
+bool GenerationCoordinator::Decide(const std::uint32_t generation,
+                                   TerminationPolicy &termination,
+                                   bool &game_over) {
+  if (!segment) {
+    return false;
+  }
+
+  std::vector<std::uint64_t> world_hash(cBandsCount);
+  std::uint64_t alive_cells = 0;
+  for (std::uint32_t band_num = 0; band_num < cBandsCount; band_num++) {
+    BandReport &report = GetReport(band_num);
+    SpinWait wait(cTimeout);
+    while (report.reported.load(std::memory_order_acquire) < generation + 1) {
+      if (!wait.Pause()) {
+        std::cerr << "Band " << band_num << " did not report generation "
+                  << generation << std::endl;
+        return false;
+      }
+    }
+    alive_cells += report.alive_cells_count;
+    world_hash[band_num] = report.band_hash;
+  }
+
+  if (!hashes.insert(world_hash).second) {
+    equal_worlds_count++;
+  }
+  alive_cells_count = alive_cells;
+  // bands report only population, other statistics stay zero
+  TerminationCounters counters{generation, equal_worlds_count, {}};
+  counters.summary.population = alive_cells;
+  game_over = termination.Update(counters) != TerminationReason::None;
+
+  State *state = static_cast<State *>(segment);
+  state->game_over.store(game_over, std::memory_order_release);
+  state->decided.store(generation + 1, std::memory_order_release);
+  return true;
+}
+
+void GenerationCoordinator::Abort() {
+  if (segment) {
+    static_cast<State *>(segment)->game_over.store(1);
+  }
+}
+
+std::uint64_t GenerationCoordinator::GetAliveCellsCount() const {
+  return alive_cells_count;
+}
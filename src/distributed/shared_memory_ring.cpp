@@ -0,0 +1,139 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "distributed/shared_memory_ring.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <iostream>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+SpinWait::SpinWait(const std::chrono::milliseconds timeout)
+    : deadline(std::chrono::steady_clock::now() + timeout), spins_count(0) {}
+
+bool SpinWait::Pause() {
+  constexpr std::uint32_t yield_spins_count = 64;
+  if (++spins_count < yield_spins_count) {
+    std::this_thread::yield();
+  } else {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  return std::chrono::steady_clock::now() < deadline;
+}
+
+SharedMemoryRing::SharedMemoryRing(const std::string &name,
+                                   const std::uint32_t slot_words,
+                                   const std::uint32_t slots_count,
+                                   const bool create)
+    : cName(name), cOwner(create), segment(nullptr), segment_size(0),
+      header(nullptr) {
+  const int descriptor =
+      shm_open(cName.c_str(), create ? (O_CREAT | O_RDWR | O_TRUNC) : O_RDWR,
+               0600);
+  if (descriptor < 0) {
+    std::cerr << "Can't open shared memory " << cName << std::endl;
+    return;
+  }
+  if (create) {
+    // every slot starts with the length of the message
+    segment_size = sizeof(Header) + static_cast<std::size_t>(slots_count) *
+                                        (slot_words + 1) *
+                                        sizeof(std::uint64_t);
+    if (ftruncate(descriptor, segment_size)) {
+      std::cerr << "Can't resize shared memory " << cName << std::endl;
+      close(descriptor);
+      return;
+    }
+  } else {
+    struct stat segment_stat;
+    if (fstat(descriptor, &segment_stat) ||
+        segment_stat.st_size < static_cast<off_t>(sizeof(Header))) {
+      std::cerr << "Shared memory " << cName << " is not created" << std::endl;
+      close(descriptor);
+      return;
+    }
+    segment_size = segment_stat.st_size;
+  }
+
+  void *mapped = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (mapped == MAP_FAILED) {
+    std::cerr << "Can't map shared memory " << cName << std::endl;
+    return;
+  }
+
+  segment = mapped;
+  header = static_cast<Header *>(segment);
+  if (create) {
+    new (header) Header();
+    header->head.store(0);
+    header->tail.store(0);
+    header->slot_words = slot_words;
+    header->slots_count = slots_count;
+  }
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+  if (segment) {
+    munmap(segment, segment_size);
+  }
+  if (cOwner) {
+    shm_unlink(cName.c_str());
+  }
+}
+
+bool SharedMemoryRing::IsValid() const { return header != nullptr; }
+
+std::uint64_t *SharedMemoryRing::GetSlot(const std::uint64_t position) {
+  std::uint64_t *slots = reinterpret_cast<std::uint64_t *>(header + 1);
+  return slots +
+         (position % header->slots_count) * (header->slot_words + 1);
+}
+
+bool SharedMemoryRing::Push(const std::vector<std::uint64_t> &message,
+                            const std::chrono::milliseconds timeout) {
+  if (!header || message.size() > header->slot_words) {
+    return false;
+  }
+
+  const std::uint64_t head = header->head.load(std::memory_order_relaxed);
+  SpinWait wait(timeout);
+  while (head - header->tail.load(std::memory_order_acquire) >=
+         header->slots_count) {
+    if (!wait.Pause()) {
+      return false;
+    }
+  }
+
+  std::uint64_t *slot = GetSlot(head);
+  slot[0] = message.size();
+  std::copy(message.begin(), message.end(), slot + 1);
+  header->head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool SharedMemoryRing::Pop(std::vector<std::uint64_t> &message,
+                           const std::chrono::milliseconds timeout) {
+  if (!header) {
+    return false;
+  }
+
+  const std::uint64_t tail = header->tail.load(std::memory_order_relaxed);
+  SpinWait wait(timeout);
+  while (header->head.load(std::memory_order_acquire) == tail) {
+    if (!wait.Pause()) {
+      return false;
+    }
+  }
+
+  const std::uint64_t *slot = GetSlot(tail);
+  message.assign(slot + 1, slot + 1 + slot[0]);
+  header->tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
@@ -0,0 +1,65 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "distributed/shared_memory_transport.h"
+
+constexpr std::uint32_t SharedMemoryTransport::cRingSlotsCount;
+
+SharedMemoryTransport::SharedMemoryTransport(
+    const std::string &session, const std::uint32_t band_num,
+    const std::uint32_t bands_count, const std::chrono::milliseconds timeout)
+    : cTimeout(timeout) {
+  const std::uint32_t band_above = (band_num + bands_count - 1) % bands_count;
+  const std::uint32_t band_below = (band_num + 1) % bands_count;
+
+  // sizes are read from the header created by the coordinator
+  send_up = std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(
+      GetRingName(session, HaloDirection::Up, band_num), 0, 0, false));
+  send_down = std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(
+      GetRingName(session, HaloDirection::Down, band_num), 0, 0, false));
+  // band above sends its last row down, band below sends its first row up
+  receive_up = std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(
+      GetRingName(session, HaloDirection::Down, band_above), 0, 0, false));
+  receive_down = std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(
+      GetRingName(session, HaloDirection::Up, band_below), 0, 0, false));
+}
+
+bool SharedMemoryTransport::IsValid() const {
+  return send_up->IsValid() && send_down->IsValid() &&
+         receive_up->IsValid() && receive_down->IsValid();
+}
+
+bool SharedMemoryTransport::SendRow(const HaloDirection direction,
+                                    const PackedRow &row) {
+  auto &ring = direction == HaloDirection::Up ? send_up : send_down;
+  return ring->Push(row, cTimeout);
+}
+
+bool SharedMemoryTransport::ReceiveRow(const HaloDirection direction,
+                                       PackedRow &row) {
+  auto &ring = direction == HaloDirection::Up ? receive_up : receive_down;
+  return ring->Pop(row, cTimeout);
+}
+
+std::string SharedMemoryTransport::GetRingName(const std::string &session,
+                                               const HaloDirection direction,
+                                               const std::uint32_t band_num) {
+  return "/" + session + (direction == HaloDirection::Up ? "_up_" : "_down_") +
+         std::to_string(band_num);
+}
+
+std::vector<std::unique_ptr<SharedMemoryRing>>
+SharedMemoryTransport::CreateRings(const std::string &session,
+                                   const std::uint32_t bands_count,
+                                   const std::uint32_t row_words) {
+  std::vector<std::unique_ptr<SharedMemoryRing>> rings;
+  for (std::uint32_t band_num = 0; band_num < bands_count; band_num++) {
+    for (const auto direction : {HaloDirection::Up, HaloDirection::Down}) {
+      rings.push_back(std::unique_ptr<SharedMemoryRing>(
+          new SharedMemoryRing(GetRingName(session, direction, band_num),
+                               row_words, cRingSlotsCount, true)));
+    }
+  }
+  return rings;
+}
@@ -13,22 +13,18 @@ void WorldConsoleDrawer::DrawHeadingLine(const std::uint32_t heading_size) {
   std::cout << std::endl;
 }
 
-void WorldConsoleDrawer::DrawCells(const WorldCells &cells) {
-  if (cells.size() < 1 || cells[0].size() < 1) {
+void WorldConsoleDrawer::DrawCells(const WorldSnapshot &snapshot) {
+  if (snapshot.GetRowCount() < 1 || snapshot.GetColumnCount() < 1) {
     std::cerr << "Rows and columns count should be at least 1" << std::endl;
     return;
   }
 
-  DrawHeadingLine(cells[0].size());
+  DrawHeadingLine(snapshot.GetColumnCount());
 
-  for (std::uint32_t row = 0; row < cells.size(); ++row) {
-    for (std::uint32_t column = 0; column < cells[0].size(); ++column) {
-      if (cells[row].size() < (column + 1)) {
-        std::cerr << "Rows should have equal number of columns" << std::endl;
-        return;
-      }
-
-      if (cells[row][column].IsAlive()) {
+  for (std::uint32_t row = 0; row < snapshot.GetRowCount(); ++row) {
+    for (std::uint32_t column = 0; column < snapshot.GetColumnCount();
+         ++column) {
+      if (snapshot.Get(row, column)) {
         std::cout << cRedColor << "X";
       } else {
         std::cout << cGreenColor << "-";
@@ -38,3 +34,16 @@ void WorldConsoleDrawer::DrawCells(const WorldCells &cells) {
     std::cout << cNoColor << std::endl;
   }
 }
+
+void WorldConsoleDrawer::DrawStatistics(const StatisticsSummary &summary) {
+  std::cout << "population " << summary.population << ", births "
+            << summary.births << ", deaths " << summary.deaths;
+  if (summary.population) {
+    const BoundingBox &box = summary.bounding_box;
+    std::cout << ", box [" << box.top_row << ", " << box.left_column
+              << "] - [" << box.bottom_row << ", " << box.right_column
+              << "], centroid (" << summary.centroid_row << ", "
+              << summary.centroid_column << ")";
+  }
+  std::cout << std::endl;
+}
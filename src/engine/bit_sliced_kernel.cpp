@@ -0,0 +1,151 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/bit_sliced_kernel.h"
+
+BitSlicedKernel::BitSlicedKernel(const TotalisticRuleTable &rule_table,
+                                 const std::uint32_t columns)
+    : cRingBorders(rule_table.GetBordersRule() == CellBordersRule::RingBorders),
+      cColumnsCount(columns), cWordsPerRow((columns + 63) / 64),
+      cLastBit(columns ? (columns - 1) % 64 : 0),
+      cLastWordMask(columns % 64 ? (1ULL << (columns % 64)) - 1 : ~0ULL),
+      cDeadRow(cWordsPerRow, 0) {
+  // the Moore neighbourhood has at most 8 neighbours
+  constexpr std::uint32_t max_neighbours_count = 8;
+  for (std::uint32_t neighbours = 0; neighbours <= max_neighbours_count;
+       neighbours++) {
+    const bool for_alive = rule_table.GetNewCellState(true, neighbours);
+    const bool for_dead = rule_table.GetNewCellState(false, neighbours);
+    if (for_alive || for_dead) {
+      count_rules.push_back({neighbours, for_alive, for_dead});
+    }
+  }
+}
+
+std::uint64_t BitSlicedKernel::GetWest(const std::uint64_t *row,
+                                       const std::uint32_t word) const {
+  std::uint64_t carry = 0;
+  if (word > 0) {
+    carry = row[word - 1] >> 63;
+  } else if (cRingBorders) {
+    carry = (row[cWordsPerRow - 1] >> cLastBit) & 1;
+  }
+  return (row[word] << 1) | carry;
+}
+
+std::uint64_t BitSlicedKernel::GetEast(const std::uint64_t *row,
+                                       const std::uint32_t word) const {
+  if (word + 1 < cWordsPerRow) {
+    return (row[word] >> 1) | (row[word + 1] << 63);
+  }
+  const std::uint64_t carry = cRingBorders ? (row[0] & 1) : 0;
+  return (row[word] >> 1) | (carry << cLastBit);
+}
+
+std::uint64_t BitSlicedKernel::Evaluate(const std::uint64_t alive,
+                                        const std::uint64_t s0,
+                                        const std::uint64_t s1,
+                                        const std::uint64_t s2,
+                                        const std::uint64_t s3) const {
+  std::uint64_t result = 0;
+  for (const auto &count_rule : count_rules) {
+    const std::uint32_t count = count_rule.neighbours_count;
+    const std::uint64_t matches = ((count & 1) ? s0 : ~s0) &
+                                  ((count & 2) ? s1 : ~s1) &
+                                  ((count & 4) ? s2 : ~s2) &
+                                  ((count & 8) ? s3 : ~s3);
+    if (count_rule.for_alive && count_rule.for_dead) {
+      result |= matches;
+    } else if (count_rule.for_alive) {
+      result |= matches & alive;
+    } else {
+      result |= matches & ~alive;
+    }
+  }
+  return result;
+}
+
+void BitSlicedKernel::StepRow(const std::uint64_t *above,
+                              const std::uint64_t *row,
+                              const std::uint64_t *below,
+                              std::uint64_t *next) const {
+  if (!above) {
+    above = cDeadRow.data();
+  }
+  if (!below) {
+    below = cDeadRow.data();
+  }
+
+  for (std::uint32_t word = 0; word < cWordsPerRow; word++) {
+    // 2 bit count of alive cells in three columns of the row above
+    const std::uint64_t above_west = GetWest(above, word);
+    const std::uint64_t above_east = GetEast(above, word);
+    const std::uint64_t above_xor = above_west ^ above_east;
+    const std::uint64_t above_low = above_xor ^ above[word];
+    const std::uint64_t above_high =
+        (above_west & above_east) | (above_xor & above[word]);
+
+    // 2 bit count of alive cells left and right of the cell
+    const std::uint64_t west = GetWest(row, word);
+    const std::uint64_t east = GetEast(row, word);
+    const std::uint64_t middle_low = west ^ east;
+    const std::uint64_t middle_high = west & east;
+
+    // 2 bit count of alive cells in three columns of the row below
+    const std::uint64_t below_west = GetWest(below, word);
+    const std::uint64_t below_east = GetEast(below, word);
+    const std::uint64_t below_xor = below_west ^ below_east;
+    const std::uint64_t below_low = below_xor ^ below[word];
+    const std::uint64_t below_high =
+        (below_west & below_east) | (below_xor & below[word]);
+
+    // sum three 2 bit counts into 4 bit planes
+    const std::uint64_t low_xor = above_low ^ middle_low;
+    const std::uint64_t s0 = low_xor ^ below_low;
+    const std::uint64_t carry_low =
+        (above_low & middle_low) | (low_xor & below_low);
+
+    const std::uint64_t high_xor = above_high ^ middle_high;
+    const std::uint64_t high_sum = high_xor ^ below_high;
+    const std::uint64_t high_carry =
+        (above_high & middle_high) | (high_xor & below_high);
+
+    const std::uint64_t s1 = high_sum ^ carry_low;
+    const std::uint64_t carry_middle = high_sum & carry_low;
+    const std::uint64_t s2 = high_carry ^ carry_middle;
+    const std::uint64_t s3 = high_carry & carry_middle;
+
+    next[word] = Evaluate(row[word], s0, s1, s2, s3);
+  }
+  next[cWordsPerRow - 1] &= cLastWordMask;
+}
+
+const std::uint64_t *
+BitSlicedKernel::GetRowAbove(const PackedGrid &grid,
+                             const std::uint32_t row) const {
+  if (row > 0) {
+    return grid.GetRow(row - 1);
+  }
+  return cRingBorders ? grid.GetRow(grid.GetRowCount() - 1) : nullptr;
+}
+
+const std::uint64_t *
+BitSlicedKernel::GetRowBelow(const PackedGrid &grid,
+                             const std::uint32_t row) const {
+  if (row + 1 < grid.GetRowCount()) {
+    return grid.GetRow(row + 1);
+  }
+  return cRingBorders ? grid.GetRow(0) : nullptr;
+}
+
+void BitSlicedKernel::StepGrid(const PackedGrid &current,
+                               PackedGrid &next) const {
+  if (cWordsPerRow == 0) {
+    return;
+  }
+  for (std::uint32_t row = 0; row < current.GetRowCount(); row++) {
+    StepRow(GetRowAbove(current, row), current.GetRow(row),
+            GetRowBelow(current, row), next.GetRow(row));
+  }
+}
@@ -0,0 +1,34 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/generation_engine_factory.h"
+#include "engine/lattice_engine.h"
+#include "engine/lookup_table_engine.h"
+#include "engine/temporal_blocking_engine.h"
+
+std::unique_ptr<GenerationEngine> GenerationEngineFactory::MakeGenerationEngine(
+    const GenerationEngineType type, const TotalisticRuleTable &rule_table,
+    const std::uint32_t columns, const std::uint32_t tile_rows,
+    const std::uint32_t depth) {
+  // square tiles and tables don't fit other cells, every type of them is
+  // calculated by the lattice engine
+  if (rule_table.GetTopology() != GridTopology::Square) {
+    return std::unique_ptr<GenerationEngine>(
+        new LatticeEngine(rule_table, columns));
+  }
+  switch (type) {
+  case GenerationEngineType::LookupTable:
+    return std::unique_ptr<GenerationEngine>(new LookupTableEngine(rule_table));
+  case GenerationEngineType::TemporalBlocking:
+  case GenerationEngineType::PerCell:
+  default:
+    return std::unique_ptr<GenerationEngine>(
+        new TemporalBlockingEngine(rule_table, columns, tile_rows, depth));
+  }
+}
+
+std::unique_ptr<GenerationEngine> GenerationEngineFactory::MakeGenerationEngine(
+    const NeighbourhoodRuleTable &rule_table) {
+  return std::unique_ptr<GenerationEngine>(new LookupTableEngine(rule_table));
+}
@@ -0,0 +1,201 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/lattice_engine.h"
+
+#include <algorithm>
+
+namespace {
+/// @brief add three bits of every cell into sum and carry bits
+inline void AddThree(const std::uint64_t a, const std::uint64_t b,
+                     const std::uint64_t c, std::uint64_t &sum,
+                     std::uint64_t &carry) {
+  const std::uint64_t a_xor_b = a ^ b;
+  sum = a_xor_b ^ c;
+  carry = (a & b) | (a_xor_b & c);
+}
+
+/// @brief add six bits of every cell into the three lower bit planes
+inline void AddSix(const std::uint64_t addends[6], std::uint64_t &s0,
+                   std::uint64_t &s1, std::uint64_t &s2) {
+  std::uint64_t ones_first, twos_first, ones_second, twos_second;
+  AddThree(addends[0], addends[1], addends[2], ones_first, twos_first);
+  AddThree(addends[3], addends[4], addends[5], ones_second, twos_second);
+  s0 = ones_first ^ ones_second;
+  AddThree(twos_first, twos_second, ones_first & ones_second, s1, s2);
+}
+
+/// @brief cells of even columns of a word, 64 is even, so it is the same
+/// for every word
+constexpr std::uint64_t cEvenColumns = 0x5555555555555555ULL;
+} // namespace
+
+LatticeEngine::LatticeEngine(const TotalisticRuleTable &rule_table,
+                             const std::uint32_t columns)
+    : cTopology(rule_table.GetTopology()),
+      cRingBorders(rule_table.GetBordersRule() == CellBordersRule::RingBorders),
+      cColumnsCount(columns), cWordsPerRow((columns + 63) / 64),
+      cPaddedWordsPerRow(cWordsPerRow + 2),
+      cLastWordMask(columns % 64 ? (1ULL << (columns % 64)) - 1 : ~0ULL),
+      cDeadRow(cPaddedWordsPerRow, 0) {
+  const std::uint32_t max_neighbours_count =
+      GridNeighbourhood::GetNeighboursCount(cTopology);
+  for (std::uint32_t neighbours = 0; neighbours <= max_neighbours_count;
+       neighbours++) {
+    const bool for_alive = rule_table.GetNewCellState(true, neighbours);
+    const bool for_dead = rule_table.GetNewCellState(false, neighbours);
+    if (for_alive || for_dead) {
+      count_rules.push_back({neighbours, for_alive, for_dead});
+    }
+  }
+}
+
+void LatticeEngine::Step(PackedGrid &grid, const std::uint32_t generations) {
+  const std::uint32_t rows = grid.GetRowCount();
+  if (rows == 0 || cWordsPerRow == 0 ||
+      grid.GetColumnCount() != cColumnsCount) {
+    return;
+  }
+
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    FillPadded(grid);
+    for (std::uint32_t row = 0; row < rows; row++) {
+      const std::uint64_t *above = GetPaddedRow(row - 1LL, rows);
+      const std::uint64_t *middle = GetPaddedRow(row, rows);
+      const std::uint64_t *below = GetPaddedRow(row + 1LL, rows);
+      if (cTopology == GridTopology::Triangular) {
+        StepTriangularRow(row, above, middle, below, grid.GetRow(row));
+      } else {
+        StepHexagonalRow(row, above, middle, below, grid.GetRow(row));
+      }
+      grid.GetRow(row)[cWordsPerRow - 1] &= cLastWordMask;
+    }
+  }
+}
+
+void LatticeEngine::FillPadded(const PackedGrid &grid) {
+  const std::uint32_t rows = grid.GetRowCount();
+  padded.assign(static_cast<std::size_t>(rows) * cPaddedWordsPerRow, 0);
+
+  const auto set_bit = [](std::uint64_t *row, const std::int64_t column) {
+    // padded bit of the column is column + 64
+    const std::uint64_t bit = column + 64;
+    row[bit / 64] |= 1ULL << (bit % 64);
+  };
+  const std::int64_t columns = cColumnsCount;
+  const std::int64_t outer_columns[] = {-2, -1, columns, columns + 1};
+  for (std::uint32_t row = 0; row < rows; row++) {
+    std::uint64_t *destination = &padded[row * cPaddedWordsPerRow];
+    std::copy(grid.GetRow(row), grid.GetRow(row) + cWordsPerRow,
+              destination + 1);
+    if (!cRingBorders) {
+      continue;
+    }
+    for (const std::int64_t column : outer_columns) {
+      const std::int64_t wrapped = ((column % columns) + columns) % columns;
+      if (grid.Get(row, wrapped)) {
+        set_bit(destination, column);
+      }
+    }
+  }
+}
+
+const std::uint64_t *
+LatticeEngine::GetPaddedRow(const std::int64_t row,
+                            const std::int64_t rows) const {
+  if (row < 0 || row >= rows) {
+    if (!cRingBorders) {
+      return cDeadRow.data();
+    }
+    return &padded[((row + rows) % rows) * cPaddedWordsPerRow];
+  }
+  return &padded[row * cPaddedWordsPerRow];
+}
+
+std::uint64_t LatticeEngine::GetShifted(const std::uint64_t *row,
+                                        const std::uint32_t word,
+                                        const std::int32_t offset) const {
+  // word of the world row is padded word + 1
+  const std::uint64_t *current = row + word + 1;
+  if (offset > 0) {
+    return (current[0] >> offset) | (current[1] << (64 - offset));
+  }
+  if (offset < 0) {
+    return (current[0] << -offset) | (current[-1] >> (64 + offset));
+  }
+  return current[0];
+}
+
+void LatticeEngine::StepHexagonalRow(const std::uint32_t row,
+                                     const std::uint64_t *above,
+                                     const std::uint64_t *middle,
+                                     const std::uint64_t *below,
+                                     std::uint64_t *next) const {
+  // odd rows see columns 0 and + 1 of rows around, even rows -1 and 0
+  const std::int32_t west = (row % 2) ? 0 : -1;
+  for (std::uint32_t word = 0; word < cWordsPerRow; word++) {
+    const std::uint64_t addends[6] = {
+        GetShifted(above, word, west),  GetShifted(above, word, west + 1),
+        GetShifted(middle, word, -1),   GetShifted(middle, word, 1),
+        GetShifted(below, word, west),  GetShifted(below, word, west + 1)};
+    std::uint64_t planes[4] = {0, 0, 0, 0};
+    AddSix(addends, planes[0], planes[1], planes[2]);
+    next[word] = Evaluate(middle[word + 1], planes);
+  }
+}
+
+void LatticeEngine::StepTriangularRow(const std::uint32_t row,
+                                      const std::uint64_t *above,
+                                      const std::uint64_t *middle,
+                                      const std::uint64_t *below,
+                                      std::uint64_t *next) const {
+  // cells pointing up have even row + column
+  const std::uint64_t up = (row % 2) ? ~cEvenColumns : cEvenColumns;
+  for (std::uint32_t word = 0; word < cWordsPerRow; word++) {
+    // the base of a triangle touches two more cells of the next row
+    const std::uint64_t base_west = (GetShifted(below, word, -2) & up) |
+                                    (GetShifted(above, word, -2) & ~up);
+    const std::uint64_t base_east = (GetShifted(below, word, 2) & up) |
+                                    (GetShifted(above, word, 2) & ~up);
+
+    // 12 neighbours are added by four adders of three into ones and twos
+    std::uint64_t ones[4], twos[6];
+    AddThree(GetShifted(above, word, -1), above[word + 1],
+             GetShifted(above, word, 1), ones[0], twos[0]);
+    AddThree(GetShifted(below, word, -1), below[word + 1],
+             GetShifted(below, word, 1), ones[1], twos[1]);
+    AddThree(GetShifted(middle, word, -2), GetShifted(middle, word, -1),
+             GetShifted(middle, word, 1), ones[2], twos[2]);
+    AddThree(GetShifted(middle, word, 2), base_west, base_east, ones[3],
+             twos[3]);
+
+    std::uint64_t planes[4];
+    std::uint64_t ones_sum;
+    AddThree(ones[0], ones[1], ones[2], ones_sum, twos[4]);
+    planes[0] = ones_sum ^ ones[3];
+    twos[5] = ones_sum & ones[3];
+    AddSix(twos, planes[1], planes[2], planes[3]);
+    next[word] = Evaluate(middle[word + 1], planes);
+  }
+}
+
+std::uint64_t LatticeEngine::Evaluate(const std::uint64_t alive,
+                                      const std::uint64_t planes[4]) const {
+  std::uint64_t result = 0;
+  for (const auto &count_rule : count_rules) {
+    const std::uint32_t count = count_rule.neighbours_count;
+    const std::uint64_t matches = ((count & 1) ? planes[0] : ~planes[0]) &
+                                  ((count & 2) ? planes[1] : ~planes[1]) &
+                                  ((count & 4) ? planes[2] : ~planes[2]) &
+                                  ((count & 8) ? planes[3] : ~planes[3]);
+    if (count_rule.for_alive && count_rule.for_dead) {
+      result |= matches;
+    } else if (count_rule.for_alive) {
+      result |= matches & alive;
+    } else {
+      result |= matches & ~alive;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,152 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/lookup_table_engine.h"
+
+#include <algorithm>
+#include <utility>
+
+constexpr std::uint32_t LookupTableEngine::cTableSize;
+
+LookupTableEngine::LookupTableEngine(const TotalisticRuleTable &rule_table)
+    : LookupTableEngine(NeighbourhoodRuleTable(rule_table)) {}
+
+LookupTableEngine::LookupTableEngine(const NeighbourhoodRuleTable &rule_table)
+    : table(cTableSize, 0),
+      cRingBorders(rule_table.GetBordersRule() ==
+                   CellBordersRule::RingBorders) {
+  constexpr std::uint32_t block_side = 4;
+  const auto is_alive = [](const std::uint32_t neighbourhood,
+                           const std::uint32_t row,
+                           const std::uint32_t column) {
+    return (neighbourhood >> (row * block_side + column)) & 1;
+  };
+
+  for (std::uint32_t neighbourhood = 0; neighbourhood < cTableSize;
+       neighbourhood++) {
+    std::uint8_t block_state = 0;
+    for (std::uint32_t row = 1; row <= 2; row++) {
+      for (std::uint32_t column = 1; column <= 2; column++) {
+        // 3x3 block around the cell is the index of the rule table
+        std::uint32_t cell_neighbourhood = 0;
+        for (std::uint32_t block_row = 0; block_row < 3; block_row++) {
+          for (std::uint32_t block_column = 0; block_column < 3;
+               block_column++) {
+            cell_neighbourhood |=
+                is_alive(neighbourhood, row + block_row - 1,
+                         column + block_column - 1)
+                << (block_row * 3 + block_column);
+          }
+        }
+        if (rule_table.GetNewCellState(cell_neighbourhood)) {
+          block_state |= 1 << ((row - 1) * 2 + (column - 1));
+        }
+      }
+    }
+    table[neighbourhood] = block_state;
+  }
+}
+
+std::uint8_t
+LookupTableEngine::GetBlockState(const std::uint16_t neighbourhood) const {
+  return table[neighbourhood];
+}
+
+void LookupTableEngine::Step(PackedGrid &grid,
+                             const std::uint32_t generations) {
+  if (grid.GetRowCount() == 0 || grid.GetWordsPerRow() == 0) {
+    return;
+  }
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    FillPadded(grid);
+    StepGeneration(grid);
+  }
+}
+
+void LookupTableEngine::FillPadded(const PackedGrid &grid) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::uint32_t columns = grid.GetColumnCount();
+  if (padded.GetRowCount() != rows + 3 ||
+      padded.GetColumnCount() != columns + 3) {
+    padded = PackedGrid(rows + 3, columns + 3);
+  }
+
+  const std::uint32_t words_per_row = grid.GetWordsPerRow();
+  const std::uint32_t padded_words_per_row = padded.GetWordsPerRow();
+  for (std::int64_t padded_row = 0; padded_row < rows + 3; padded_row++) {
+    std::uint64_t *destination = padded.GetRow(padded_row);
+    std::fill(destination, destination + padded_words_per_row, 0);
+
+    std::int64_t row = padded_row - 1;
+    if (row < 0 || row >= rows) {
+      if (!cRingBorders) {
+        continue;
+      }
+      row = ((row % rows) + rows) % rows;
+    }
+
+    // padded column is world column + 1
+    const std::uint64_t *source = grid.GetRow(row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      destination[word] |= source[word] << 1;
+      if (word + 1 < padded_words_per_row) {
+        destination[word + 1] |= source[word] >> 63;
+      }
+    }
+    if (cRingBorders) {
+      padded.Set(padded_row, 0, grid.Get(row, columns - 1));
+      padded.Set(padded_row, columns + 1, grid.Get(row, 0));
+      padded.Set(padded_row, columns + 2, grid.Get(row, 1 % columns));
+    }
+  }
+}
+
+std::uint32_t LookupTableEngine::GetNibble(const std::uint64_t *row,
+                                           const std::uint32_t column) const {
+  const std::uint32_t word = column / 64;
+  const std::uint32_t bit = column % 64;
+  std::uint64_t cells = row[word] >> bit;
+  if (bit > 60 && word + 1 < padded.GetWordsPerRow()) {
+    cells |= row[word + 1] << (64 - bit);
+  }
+  return cells & 0xF;
+}
+
+void LookupTableEngine::StepGeneration(PackedGrid &grid) {
+  const std::uint32_t rows = grid.GetRowCount();
+  const std::uint32_t columns = grid.GetColumnCount();
+  grid.Clear();
+
+  for (std::uint32_t row = 0; row < rows; row += 2) {
+    // padded rows row .. row + 3 are world rows row - 1 .. row + 2
+    const std::uint64_t *padded_rows[4] = {
+        padded.GetRow(row), padded.GetRow(row + 1), padded.GetRow(row + 2),
+        padded.GetRow(row + 3)};
+    std::uint64_t *upper_row = grid.GetRow(row);
+    std::uint64_t *lower_row = row + 1 < rows ? grid.GetRow(row + 1) : nullptr;
+
+    for (std::uint32_t column = 0; column < columns; column += 2) {
+      const std::uint32_t neighbourhood =
+          GetNibble(padded_rows[0], column) |
+          (GetNibble(padded_rows[1], column) << 4) |
+          (GetNibble(padded_rows[2], column) << 8) |
+          (GetNibble(padded_rows[3], column) << 12);
+      const std::uint64_t block_state = table[neighbourhood];
+      if (!block_state) {
+        continue;
+      }
+      // column is even, so both cells of the block row are in one word
+      upper_row[column / 64] |= (block_state & 3) << (column % 64);
+      if (lower_row) {
+        lower_row[column / 64] |= (block_state >> 2) << (column % 64);
+      }
+    }
+
+    // odd count of columns: the second cell of the last block is outside
+    upper_row[grid.GetWordsPerRow() - 1] &= grid.GetLastWordMask();
+    if (lower_row) {
+      lower_row[grid.GetWordsPerRow() - 1] &= grid.GetLastWordMask();
+    }
+  }
+}
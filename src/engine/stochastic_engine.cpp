@@ -0,0 +1,49 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/stochastic_engine.h"
+#include "random/counter_random.h"
+
+#include <utility>
+
+StochasticEngine::StochasticEngine(std::unique_ptr<GenerationEngine> engine,
+                                   const double birth_probability,
+                                   const double survival_probability,
+                                   const std::uint64_t seed)
+    : engine(std::move(engine)),
+      cBirthThreshold(CounterRandom::GetThreshold(birth_probability)),
+      cSurvivalThreshold(CounterRandom::GetThreshold(survival_probability)),
+      cSeed(seed), generation(0) {}
+
+void StochasticEngine::SetGeneration(const std::uint64_t generation) {
+  this->generation = generation;
+}
+
+void StochasticEngine::Step(PackedGrid &grid,
+                            const std::uint32_t generations) {
+  const std::uint32_t rows = grid.GetRowCount();
+  const std::uint32_t words_per_row = grid.GetWordsPerRow();
+  for (std::uint32_t step = 0; step < generations; step++) {
+    previous = grid;
+    engine->Step(grid, 1);
+
+    for (std::uint32_t row = 0; row < rows; row++) {
+      const std::uint64_t *previous_row = previous.GetRow(row);
+      std::uint64_t *next_row = grid.GetRow(row);
+      for (std::uint32_t word = 0; word < words_per_row; word++) {
+        const std::uint64_t births = next_row[word] & ~previous_row[word];
+        const std::uint64_t survivals = next_row[word] & previous_row[word];
+        // births and survivals use different counters of the word
+        const std::uint64_t counter =
+            (static_cast<std::uint64_t>(row) * words_per_row + word) * 2;
+        next_row[word] =
+            CounterRandom::GetBernoulliWord(cSeed, generation, counter,
+                                            cBirthThreshold, births) |
+            CounterRandom::GetBernoulliWord(cSeed, generation, counter + 1,
+                                            cSurvivalThreshold, survivals);
+      }
+    }
+    generation++;
+  }
+}
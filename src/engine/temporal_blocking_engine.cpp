@@ -0,0 +1,97 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/temporal_blocking_engine.h"
+
+#include <algorithm>
+#include <utility>
+
+TemporalBlockingEngine::TemporalBlockingEngine(
+    const TotalisticRuleTable &rule_table, const std::uint32_t columns,
+    const std::uint32_t tile_rows, const std::uint32_t depth)
+    : kernel(rule_table, columns),
+      cRingBorders(rule_table.GetBordersRule() == CellBordersRule::RingBorders),
+      cTileRows(tile_rows ? tile_rows : 1), cDepth(depth ? depth : 1),
+      tile(cTileRows + 2 * cDepth, columns),
+      next_tile(cTileRows + 2 * cDepth, columns) {}
+
+void TemporalBlockingEngine::Step(PackedGrid &grid,
+                                  const std::uint32_t generations) {
+  if (grid.GetRowCount() == 0 || grid.GetWordsPerRow() == 0) {
+    return;
+  }
+  if (output.GetRowCount() != grid.GetRowCount() ||
+      output.GetColumnCount() != grid.GetColumnCount()) {
+    output = PackedGrid(grid.GetRowCount(), grid.GetColumnCount());
+  }
+
+  std::uint32_t remaining_generations = generations;
+  while (remaining_generations > 0) {
+    const std::uint32_t block_generations =
+        std::min(remaining_generations, cDepth);
+    StepBlock(grid, output, block_generations);
+    std::swap(grid, output);
+    remaining_generations -= block_generations;
+  }
+}
+
+void TemporalBlockingEngine::LoadTile(const PackedGrid &grid,
+                                      const std::int64_t first_row,
+                                      const std::uint32_t rows_count) {
+  const std::int64_t world_rows = grid.GetRowCount();
+  const std::uint32_t words_per_row = grid.GetWordsPerRow();
+  for (std::uint32_t local_row = 0; local_row < rows_count; local_row++) {
+    std::int64_t row = first_row + local_row;
+    std::uint64_t *tile_row = tile.GetRow(local_row);
+    if (row < 0 || row >= world_rows) {
+      if (!cRingBorders) {
+        std::fill(tile_row, tile_row + words_per_row, 0);
+        continue;
+      }
+      row = ((row % world_rows) + world_rows) % world_rows;
+    }
+    const std::uint64_t *grid_row = grid.GetRow(row);
+    std::copy(grid_row, grid_row + words_per_row, tile_row);
+  }
+}
+
+void TemporalBlockingEngine::StepBlock(const PackedGrid &current,
+                                       PackedGrid &next,
+                                       const std::uint32_t generations) {
+  const std::uint32_t world_rows = current.GetRowCount();
+  const std::uint32_t words_per_row = current.GetWordsPerRow();
+
+  for (std::uint32_t tile_begin = 0; tile_begin < world_rows;
+       tile_begin += cTileRows) {
+    const std::uint32_t tile_rows =
+        std::min(cTileRows, world_rows - tile_begin);
+    const std::uint32_t local_rows = tile_rows + 2 * generations;
+    const std::int64_t first_row =
+        static_cast<std::int64_t>(tile_begin) - generations;
+    LoadTile(current, first_row, local_rows);
+
+    for (std::uint32_t generation = 1; generation <= generations;
+         generation++) {
+      for (std::uint32_t local_row = generation;
+           local_row + generation < local_rows; local_row++) {
+        std::uint64_t *next_row = next_tile.GetRow(local_row);
+        const std::int64_t row = first_row + local_row;
+        if (!cRingBorders && (row < 0 || row >= world_rows)) {
+          // rows outside of limited world always stay dead
+          std::fill(next_row, next_row + words_per_row, 0);
+          continue;
+        }
+        kernel.StepRow(tile.GetRow(local_row - 1), tile.GetRow(local_row),
+                       tile.GetRow(local_row + 1), next_row);
+      }
+      std::swap(tile, next_tile);
+    }
+
+    for (std::uint32_t row = 0; row < tile_rows; row++) {
+      const std::uint64_t *tile_row = tile.GetRow(generations + row);
+      std::copy(tile_row, tile_row + words_per_row,
+                next.GetRow(tile_begin + row));
+    }
+  }
+}
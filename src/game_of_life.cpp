@@ -5,24 +5,83 @@
 ///
 #include "game_of_life.h"
 #include "drawer/world_drawer_factory.h"
+#include "engine/generation_engine_factory.h"
+#include "engine/stochastic_engine.h"
+#include "partition/thread_placement.h"
+#include "termination/termination_policy_factory.h"
 
+#include <chrono>
+#include <ctime>
 #include <iostream>
 #include <map>
-#include <math.h>
 #include <thread>
+#include <utility>
 
-GameOfLife::GameOfLife(const std::uint32_t rows, const std::uint32_t columns)
-    : world(rows, columns), initial_figure(rows, columns),
-      generations_count(0) {
+GameOfLifeSettings::GameOfLifeSettings()
+    : threads_count(0), adaptive_load_balancing(true), numa_placement(false),
+      engine(GenerationEngineType::PerCell), temporal_tile_rows(64),
+      temporal_depth(8), topology(GridTopology::Square), rule(),
+      birth_probability(1), survival_probability(1), random_seed(0),
+      lenia(), autotune(false), autotune_profile_path() {}
+
+GameOfLife::GameOfLife(const std::uint32_t rows, const std::uint32_t columns,
+                       const GameOfLifeSettings &settings)
+    : world(rows, columns, !settings.numa_placement),
+      initial_figure(rows, columns), generations_count(0), settings(settings),
+      is_async_step_running(false), continuous_engine(nullptr) {
   drawer = WorldDrawerFactory::MakeWorldDrawer();
-  rules = GameRulesFactory::MakeGameRules();
+  rules = GameRulesFactory::MakeGameRules(settings.topology, settings.rule);
+  if (rules->GetBordersRule() == CellBordersRule::RingBorders &&
+      ((settings.topology != GridTopology::Square && rows % 2) ||
+       (settings.topology == GridTopology::Triangular && columns % 2))) {
+    std::cerr << "Ring borders of " << GridNeighbourhood::GetTopologyName(
+                                           settings.topology)
+              << " cells need even size of the world" << std::endl;
+  }
+  termination = TerminationPolicyFactory::MakeDefaultPolicy();
+  const NeighbourhoodRuleTable neighbourhood_table(*rules);
+  if (settings.topology != GridTopology::Square ||
+      neighbourhood_table.IsTotalistic()) {
+    is_per_cell = settings.engine == GenerationEngineType::PerCell;
+    engine = GenerationEngineFactory::MakeGenerationEngine(
+        settings.engine, TotalisticRuleTable(*rules), columns,
+        settings.temporal_tile_rows, settings.temporal_depth);
+  } else {
+    // cells of the world store only counts of neighbours
+    is_per_cell = false;
+    engine = GenerationEngineFactory::MakeGenerationEngine(neighbourhood_table);
+  }
+  if (settings.engine == GenerationEngineType::Continuous) {
+    std::unique_ptr<LeniaEngine> lenia(new LeniaEngine(
+        rows, columns, settings.lenia, settings.threads_count));
+    continuous_engine = lenia.get();
+    engine = std::move(lenia);
+    is_per_cell = false;
+  } else if (settings.birth_probability < 1 ||
+             settings.survival_probability < 1) {
+    // random bits are keyed on positions of words of packed cells
+    is_per_cell = false;
+    engine = std::unique_ptr<GenerationEngine>(new StochasticEngine(
+        std::move(engine), settings.birth_probability,
+        settings.survival_probability, settings.random_seed));
+  }
 
-  if (rows * columns > cMinPointsForMultithreading) {
+  const std::uint32_t requested_threads_count =
+      std::min(cMaxThreadCount, settings.threads_count
+                                    ? settings.threads_count
+                                    : std::thread::hardware_concurrency());
+  // one worker thread only adds synchronization to the single thread run
+  if (rows * columns > cMinPointsForMultithreading &&
+      requested_threads_count > 1) {
     multithread = true;
     stop_threads = false;
-    threads_count =
-        std::min(cMaxThreadCount, std::thread::hardware_concurrency());
+    threads_allocation_finished_count = 0;
+    threads_count = requested_threads_count;
 
+    metrics = std::unique_ptr<GameMetrics>(new GameMetrics(threads_count));
+    partitioner = std::unique_ptr<RowPartitioner>(
+        new RowPartitioner(rows, threads_count));
+    scratch.resize(threads_count + 1);
     start_cell_process_semaphores.resize(threads_count);
     for (std::uint32_t thread_num = 0; thread_num < threads_count;
          thread_num++) {
@@ -41,7 +100,31 @@ GameOfLife::GameOfLife(const std::uint32_t rows, const std::uint32_t columns)
   } else {
     multithread = false;
     threads_count = 0;
+    metrics = std::unique_ptr<GameMetrics>(new GameMetrics(threads_count));
+    scratch.resize(1);
   }
+
+  if (settings.numa_placement && multithread) {
+    std::unique_lock<std::mutex> lk(conditional_wait_cell_processed_mutex);
+    conditional_wait_cell_processed.wait(lk, [this] {
+      return threads_allocation_finished_count >= threads_count;
+    });
+  }
+  // rows which are not owned by any worker thread are allocated here
+  world.AllocateRows(0, rows);
+  UpdateTermination();
+}
+
+void GameOfLife::PlaceThread(std::uint32_t thread_num) {
+  ThreadPlacement::PinCurrentThread(thread_num);
+  const RowRange row_range = partitioner->GetRange(thread_num);
+  world.AllocateRows(row_range.begin_row, row_range.end_row);
+
+  {
+    std::lock_guard<std::mutex> lk(conditional_wait_cell_processed_mutex);
+    threads_allocation_finished_count++;
+  }
+  conditional_wait_cell_processed.notify_all();
 }
 
 GameOfLife::~GameOfLife() {
@@ -51,7 +134,23 @@ GameOfLife::~GameOfLife() {
   }
 }
 
-void GameOfLife::Draw() { drawer->DrawCells(world.GetCells()); }
+void GameOfLife::Draw() {
+  if (snapshots) {
+    const SnapshotGuard snapshot = ReadSnapshot();
+    drawer->DrawCells(*snapshot);
+    drawer->DrawStatistics(snapshot->GetSummary());
+    return;
+  }
+  // the world is copied under the lock, so a step of another thread doesn't
+  // change it
+  boost::shared_lock<boost::shared_mutex> lock(world_cells_mutex);
+  const WorldSnapshot snapshot(generations_count,
+                               world.GetStatistics().GetSummary(),
+                               world.GetPackedCells());
+  lock.unlock();
+  drawer->DrawCells(snapshot);
+  drawer->DrawStatistics(snapshot.GetSummary());
+}
 
 void GameOfLife::FillInitialPicture(const GameOfLifeInitialState &state) {
   switch (state) {
@@ -76,12 +175,203 @@ void GameOfLife::FillInitialPicture(const GameOfLifeInitialState &state) {
   default: { initial_figure.BuildRandom(); }
   }
 
-  world.SetInitialCells(initial_figure.GetPoints(), *rules.get());
+  FillInitialPicture(initial_figure.GetPoints());
+}
+
+void GameOfLife::FillInitialPicture(const std::vector<Point> &alive_cells) {
+  {
+    boost::unique_lock<boost::shared_mutex> lock(world_cells_mutex);
+    world.SetInitialCells(alive_cells, *rules.get());
+  }
+  StartInitialPicture();
+}
+
+void GameOfLife::StampPattern(const Pattern &pattern, const std::uint32_t row,
+                              const std::uint32_t column,
+                              const PatternTransform transform) {
+  std::int64_t window_top = 0;
+  PackedGrid rows =
+      ReadRegionRows(row, std::max(pattern.rows, pattern.columns),
+                     CellBordersRule::RingBorders, window_top);
+  PatternLibrary::Stamp(rows, pattern, transform,
+                        static_cast<std::uint32_t>(row - window_top), column);
+  ReplaceRegionRows(rows, window_top);
+  FinishEdit();
+}
+
+void GameOfLife::PasteRegion(const PackedGrid &cells,
+                             const std::int64_t top_row,
+                             const std::int64_t left_column,
+                             const RegionOperation operation) {
+  WriteRegionRows(cells, top_row, left_column, operation);
+  FinishEdit();
+}
+
+void GameOfLife::ClearRegion(const Region &region) {
+  WriteRegionRows(PackedGrid(region.rows, region.columns), region.top_row,
+                  region.left_column, RegionOperation::Replace);
+  FinishEdit();
+}
+
+void GameOfLife::CopyRegion(const Region &region, const std::int64_t top_row,
+                            const std::int64_t left_column) {
+  WriteRegionRows(RegionQuery::ReadCells(world.GetPackedCells(), region,
+                                         rules->GetBordersRule()),
+                  top_row, left_column, RegionOperation::Replace);
+  FinishEdit();
+}
+
+void GameOfLife::MoveRegion(const Region &region, const std::int64_t top_row,
+                            const std::int64_t left_column) {
+  const PackedGrid cells = RegionQuery::ReadCells(
+      world.GetPackedCells(), region, rules->GetBordersRule());
+  WriteRegionRows(PackedGrid(region.rows, region.columns), region.top_row,
+                  region.left_column, RegionOperation::Replace);
+  WriteRegionRows(cells, top_row, left_column, RegionOperation::Replace);
+  FinishEdit();
+}
+
+void GameOfLife::TransformRegion(const Region &region,
+                                 const PatternTransform transform) {
+  const PackedGrid cells = RegionQuery::ReadCells(
+      world.GetPackedCells(), region, rules->GetBordersRule());
+  WriteRegionRows(PackedGrid(region.rows, region.columns), region.top_row,
+                  region.left_column, RegionOperation::Replace);
+  WriteRegionRows(RegionOperations::Transform(cells, transform),
+                  region.top_row, region.left_column,
+                  RegionOperation::Replace);
+  FinishEdit();
+}
+
+PackedGrid GameOfLife::ReadRegionRows(const std::int64_t top_row,
+                                      const std::uint32_t rows,
+                                      const CellBordersRule borders_rule,
+                                      std::int64_t &window_top) const {
+  const PackedGrid &cells = world.GetPackedCells();
+  const std::int64_t world_rows = cells.GetRowCount();
+  std::int64_t first_row = top_row;
+  std::int64_t last_row = top_row + rows;
+  if (borders_rule != CellBordersRule::RingBorders) {
+    // rows outside of limited borders are not changed
+    first_row = std::min(std::max<std::int64_t>(top_row, 0), world_rows);
+    last_row = std::min(std::max(last_row, first_row), world_rows);
+  } else if (rows >= world_rows) {
+    // the region wraps onto itself, so all rows are in the window in order
+    first_row = 0;
+    last_row = world_rows;
+  }
+  window_top = first_row;
+  PackedGrid window(static_cast<std::uint32_t>(last_row - first_row),
+                    cells.GetColumnCount());
+  for (std::uint32_t row = 0; row < window.GetRowCount(); row++) {
+    const std::uint64_t *world_row = cells.GetRow(static_cast<std::uint32_t>(
+        ((first_row + row) % world_rows + world_rows) % world_rows));
+    std::copy(world_row, world_row + cells.GetWordsPerRow(),
+              window.GetRow(row));
+  }
+  return window;
+}
+
+void GameOfLife::ReplaceRegionRows(const PackedGrid &rows,
+                                   const std::int64_t window_top) {
+  const std::int64_t world_rows = world.GetRowCount();
+  if (!rows.GetRowCount()) {
+    return;
+  }
+  const std::int64_t first_row =
+      (window_top % world_rows + world_rows) % world_rows;
+  boost::unique_lock<boost::shared_mutex> lock(world_cells_mutex);
+  world.ReplaceRows(rows, static_cast<std::uint32_t>(first_row),
+                    *rules.get());
+}
+
+void GameOfLife::WriteRegionRows(const PackedGrid &cells,
+                                 const std::int64_t top_row,
+                                 const std::int64_t left_column,
+                                 const RegionOperation operation) {
+  std::int64_t window_top = 0;
+  PackedGrid rows = ReadRegionRows(top_row, cells.GetRowCount(),
+                                   rules->GetBordersRule(), window_top);
+  RegionOperations::Write(rows, cells, top_row - window_top, left_column,
+                          operation, rules->GetBordersRule());
+  ReplaceRegionRows(rows, window_top);
+}
+
+void GameOfLife::StartInitialPicture() {
   world.UpdateHash();
+  termination->Reset();
+  UpdateTermination();
+  if (history) {
+    history->Clear();
+    history->Push(generations_count, world.GetPackedCells());
+  }
+  PublishGeneration();
+}
+
+void GameOfLife::FinishEdit() {
+  // an edit is not a generation, so the policy is not updated and it checks
+  // the edited world after the next generation
+  termination_reason = TerminationReason::None;
+  if (history) {
+    history->Push(generations_count, world.GetPackedCells());
+  }
+  PublishGeneration();
 }
 
+void GameOfLife::PublishGeneration() {
+  if (snapshots) {
+    snapshots->Publish(generations_count, world.GetPackedCells(),
+                       world.GetStatistics());
+  }
+  if (frame_server) {
+    frame_server->Publish(generations_count, world.GetPackedCells());
+  }
+}
+
+const PackedGrid &GameOfLife::GetPackedCells() const {
+  return world.GetPackedCells();
+}
+
+SnapshotGuard GameOfLife::ReadSnapshot() const {
+  if (!snapshots) {
+    return SnapshotGuard();
+  }
+  return snapshots->Read();
+}
+
+PackedGrid GameOfLife::QueryRegion(const Region &region) const {
+  if (!snapshots) {
+    boost::shared_lock<boost::shared_mutex> lock(world_cells_mutex);
+    return RegionQuery::ReadCells(world.GetPackedCells(), region,
+                                  rules->GetBordersRule());
+  }
+  const SnapshotGuard snapshot = ReadSnapshot();
+  return RegionQuery::ReadCells(*snapshot, region, rules->GetBordersRule());
+}
+
+std::vector<CellSpan>
+GameOfLife::QueryRegionSpans(const Region &region) const {
+  return RegionQuery::GetSpans(QueryRegion(region));
+}
+
+const WorldStatistics &GameOfLife::GetStatistics() const {
+  return world.GetStatistics();
+}
+
+void GameOfLife::EnableMetricsExport(const std::string &file_path,
+                                     const MetricsFormat format,
+                                     const std::uint32_t period_generations) {
+  metrics_exporter = std::unique_ptr<MetricsExporter>(
+      new MetricsExporter(file_path, format, period_generations));
+}
+
+const GameMetrics &GameOfLife::GetMetrics() const { return *metrics; }
+
 void GameOfLife::UpdateWorldWithNewCellStates(
     const std::vector<CellData> &new_cell_states) {
+  if (cMetricsEnabled) {
+    metrics->AddChangedCells(new_cell_states.size());
+  }
   for (const auto &new_cell_state : new_cell_states) {
     if (std::get<2>(new_cell_state)) {
       world.MakeCellAlive(std::get<0>(new_cell_state),
@@ -93,26 +383,32 @@ void GameOfLife::UpdateWorldWithNewCellStates(
   }
 }
 
+ContinuousWorld *GameOfLife::GetContinuousWorld() {
+  return continuous_engine ? &continuous_engine->GetWorld() : nullptr;
+}
+
+const ContinuousWorld *GameOfLife::GetContinuousWorld() const {
+  return continuous_engine ? &continuous_engine->GetWorld() : nullptr;
+}
+
 void GameOfLife::ProcessCellsThread(std::uint32_t thread_num) {
   int sem_wait_result;
-  struct timespec ts;
-  constexpr std::uint64_t sem_wait_nanos = 1000000ULL;
-  ts.tv_nsec += sem_wait_nanos;
-
-  std::uint32_t cell_count = std::ceil(
-      world.GetRowCount() * world.GetColumnCount() / (float)threads_count);
-  std::uint32_t start_column = 0;
-  std::uint32_t start_row = 0;
-
-  if (world.GetColumnCount() <= cell_count) {
-    start_row = thread_num * cell_count / world.GetColumnCount();
-    start_column = (thread_num * cell_count) % world.GetColumnCount();
-  } else {
-    start_row = (thread_num * cell_count) / world.GetColumnCount();
-    start_column = (thread_num * cell_count) % world.GetColumnCount();
+  constexpr long sem_wait_nanos = 1000000L;
+  constexpr long nanos_in_second = 1000000000L;
+
+  if (settings.numa_placement) {
+    PlaceThread(thread_num);
   }
 
   while (!stop_threads.load()) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += sem_wait_nanos;
+    if (ts.tv_nsec >= nanos_in_second) {
+      ts.tv_sec++;
+      ts.tv_nsec -= nanos_in_second;
+    }
+
     while ((sem_wait_result = sem_timedwait(
                 &start_cell_process_semaphores[thread_num], &ts)) == -1 &&
            errno == EINTR)
@@ -122,27 +418,30 @@ void GameOfLife::ProcessCellsThread(std::uint32_t thread_num) {
       continue;
     }
 
-    std::vector<CellData> new_cell_states;
+    const auto slice_start = std::chrono::steady_clock::now();
+    const RowRange row_range = partitioner->GetRange(thread_num);
+    std::vector<CellData> &new_cell_states =
+        scratch[thread_num].new_cell_states;
+    new_cell_states.clear();
 
-    std::uint32_t points_count = 0;
-    for (std::uint32_t row = start_row; row < world.GetRowCount(); row++) {
-      if (points_count > cell_count) {
-        break;
-      }
-      for (std::uint32_t column = (row == start_row ? start_column : 0);
-           column < world.GetColumnCount(); column++) {
-        points_count++;
-        if (points_count > cell_count) {
-          break;
-        }
-        const auto &cell = world.GetCellAt(row, column);
-        bool is_cell_alive = rules->GetNewCellState(cell);
-        if (is_cell_alive == cell.IsAlive())
-          continue;
+    {
+      ScopedPhaseTimer evaluation_timer(*metrics, GenerationPhase::Evaluation,
+                                        thread_num);
+      for (std::uint32_t row = row_range.begin_row; row < row_range.end_row;
+           row++) {
+        for (std::uint32_t column = 0; column < world.GetColumnCount();
+             column++) {
+          const auto &cell = world.GetCellAt(row, column);
+          bool is_cell_alive = rules->GetNewCellState(cell);
+          if (is_cell_alive == cell.IsAlive())
+            continue;
 
-        new_cell_states.push_back(std::make_tuple(row, column, is_cell_alive));
+          new_cell_states.push_back(
+              std::make_tuple(row, column, is_cell_alive));
+        }
       }
     }
+    auto slice_cost = std::chrono::steady_clock::now() - slice_start;
 
     {
       std::lock_guard<std::mutex> lk(conditional_wait_cell_states_mutex);
@@ -151,13 +450,24 @@ void GameOfLife::ProcessCellsThread(std::uint32_t thread_num) {
     conditional_wait_cell_states.notify_all();
 
     {
+      ScopedPhaseTimer barrier_timer(*metrics, GenerationPhase::BarrierWait,
+                                     thread_num);
       std::unique_lock<std::mutex> lk(conditional_wait_cell_states_mutex);
       conditional_wait_cell_states.wait(lk, [this] {
         return threads_preparation_finished_count >= threads_count;
       });
     }
 
-    UpdateWorldWithNewCellStates(new_cell_states);
+    const auto update_start = std::chrono::steady_clock::now();
+    {
+      ScopedPhaseTimer update_timer(*metrics, GenerationPhase::UpdateWorld,
+                                    thread_num);
+      UpdateWorldWithNewCellStates(new_cell_states);
+    }
+    slice_cost += std::chrono::steady_clock::now() - update_start;
+    partitioner->SetMeasuredCost(
+        thread_num,
+        std::chrono::duration<double, std::micro>(slice_cost).count());
 
     {
       std::lock_guard<std::mutex> lk(conditional_wait_cell_processed_mutex);
@@ -182,41 +492,305 @@ void GameOfLife::ExecuteNextGenerationMultithreaded() {
   }
 
   {
+    ScopedPhaseTimer barrier_timer(*metrics, GenerationPhase::BarrierWait,
+                                   metrics->GetControlThreadNum());
     std::unique_lock<std::mutex> lk(conditional_wait_cell_processed_mutex);
     conditional_wait_cell_processed.wait(
         lk, [this] { return thread_finished_count >= threads_count; });
   }
+
+  if (settings.adaptive_load_balancing && !settings.numa_placement) {
+    partitioner->Rebalance();
+  }
 }
 
 void GameOfLife::ExecuteNextGenerationSinglehread() {
-  std::vector<CellData> new_cell_states;
+  std::vector<CellData> &new_cell_states = scratch.back().new_cell_states;
+  new_cell_states.clear();
 
-  for (std::uint32_t row = 0; row < world.GetRowCount(); row++) {
-    for (std::uint32_t column = 0; column < world.GetColumnCount(); column++) {
-      const auto &cell = world.GetCellAt(row, column);
-      bool is_cell_alive = rules->GetNewCellState(cell);
-      if (is_cell_alive == cell.IsAlive())
-        continue;
+  {
+    ScopedPhaseTimer evaluation_timer(*metrics, GenerationPhase::Evaluation,
+                                      metrics->GetControlThreadNum());
+    for (std::uint32_t row = 0; row < world.GetRowCount(); row++) {
+      for (std::uint32_t column = 0; column < world.GetColumnCount();
+           column++) {
+        const auto &cell = world.GetCellAt(row, column);
+        bool is_cell_alive = rules->GetNewCellState(cell);
+        if (is_cell_alive == cell.IsAlive())
+          continue;
 
-      new_cell_states.push_back(std::make_tuple(row, column, is_cell_alive));
+        new_cell_states.push_back(std::make_tuple(row, column, is_cell_alive));
+      }
     }
   }
 
+  ScopedPhaseTimer update_timer(*metrics, GenerationPhase::UpdateWorld,
+                                metrics->GetControlThreadNum());
   UpdateWorldWithNewCellStates(new_cell_states);
 }
 
 void GameOfLife::ExecuteNextGeneration() {
-  if (multithread) {
-    ExecuteNextGenerationMultithreaded();
+  if (!is_per_cell) {
+    ExecuteGenerationsWithEngine(1);
   } else {
-    ExecuteNextGenerationSinglehread();
+    // cells are evaluated and updated in one pass of worker threads
+    boost::unique_lock<boost::shared_mutex> lock(world_cells_mutex);
+    world.StartGeneration();
+    if (multithread) {
+      ExecuteNextGenerationMultithreaded();
+    } else {
+      ExecuteNextGenerationSinglehread();
+    }
+    generations_count++;
+  }
+  FinishGenerations();
+}
+
+void GameOfLife::StepGenerations(const std::uint32_t generations) {
+  std::uint32_t remaining = generations;
+  while (remaining > 0) {
+    // the policy sees every generation its decision could change on, so
+    // the game is over at the same generation as with ExecuteNextGeneration
+    const std::uint32_t stride = std::min(
+        remaining, std::max(1U, termination->GetStride(generations_count)));
+    ExecuteGenerationsWithEngine(stride);
+    FinishGenerations();
+    remaining -= stride;
+  }
+}
+
+void GameOfLife::ExecuteGenerationsWithEngine(
+    const std::uint32_t generations) {
+  {
+    ScopedPhaseTimer evaluation_timer(*metrics, GenerationPhase::Evaluation,
+                                      metrics->GetControlThreadNum());
+    engine_cells = world.GetPackedCells();
+    engine->SetGeneration(generations_count);
+    engine->Step(engine_cells, generations);
+  }
+
+  ScopedPhaseTimer update_timer(*metrics, GenerationPhase::UpdateWorld,
+                                metrics->GetControlThreadNum());
+  // readers without snapshots see cells, statistics and count of one
+  // generation
+  boost::unique_lock<boost::shared_mutex> lock(world_cells_mutex);
+  world.StartGeneration();
+  world.ApplyPackedCells(engine_cells, *rules.get());
+  generations_count += generations;
+}
+
+void GameOfLife::FinishGenerations() {
+  {
+    ScopedPhaseTimer hash_timer(*metrics, GenerationPhase::UpdateHash,
+                                metrics->GetControlThreadNum());
+    world.UpdateHash();
+  }
+  UpdateTermination();
+  if (history) {
+    history->Push(generations_count, world.GetPackedCells());
+  }
+  PublishGeneration();
+
+  if (cMetricsEnabled) {
+    metrics->SetWorldStatistics(world.GetStatistics().GetSummary());
+    metrics->FinishGeneration(generations_count, world.GetHashesCount());
+    if (metrics_exporter) {
+      metrics_exporter->OnGeneration(*metrics);
+    }
   }
+}
+
+std::future<StepResult>
+GameOfLife::StepAsync(const std::uint32_t generations,
+                      const AsyncStepOptions &options) {
+  std::shared_ptr<AsyncStepJob> job(new AsyncStepJob());
+  job->generations = generations;
+  job->until_game_over = false;
+  job->options = options;
+  return StartAsyncStep(job);
+}
+
+std::future<StepResult>
+GameOfLife::RunUntilGameOver(const AsyncStepOptions &options) {
+  std::shared_ptr<AsyncStepJob> job(new AsyncStepJob());
+  job->generations = 0;
+  job->until_game_over = true;
+  job->options = options;
+  return StartAsyncStep(job);
+}
+
+std::future<StepResult>
+GameOfLife::StartAsyncStep(std::shared_ptr<AsyncStepJob> job) {
+  job->done = 0;
+  job->deadline = std::chrono::steady_clock::now() + job->options.time_budget;
+  std::future<StepResult> result = job->promise.get_future();
+  if (is_async_step_running.exchange(true)) {
+    job->promise.set_value(
+        StepResult{StepStatus::Rejected, 0, generations_count});
+    return result;
+  }
+
+  StepExecutor &executor = job->options.executor
+                               ? *job->options.executor
+                               : StepExecutor::GetDefault();
+  executor.Submit(
+      [this, job] {
+        try {
+          return ExecuteAsyncSlice(*job);
+        } catch (...) {
+          is_async_step_running = false;
+          job->promise.set_exception(std::current_exception());
+          return false;
+        }
+      },
+      [this, job] { FinishAsyncStep(*job, StepStatus::Cancelled); });
+  return result;
+}
 
+bool GameOfLife::ExecuteAsyncSlice(AsyncStepJob &job) {
+  const AsyncStepOptions &options = job.options;
+  const bool has_budget = options.time_budget.count() > 0;
+  for (std::uint32_t slice = 0; slice < cAsyncSliceGenerations; slice++) {
+    if (options.cancellation.IsCancelled()) {
+      FinishAsyncStep(job, StepStatus::Cancelled);
+      return false;
+    }
+    if (job.until_game_over ? IsGameOver() : job.done >= job.generations) {
+      FinishAsyncStep(job, job.until_game_over ? StepStatus::GameOver
+                                               : StepStatus::Completed);
+      return false;
+    }
+    if (has_budget && std::chrono::steady_clock::now() >= job.deadline) {
+      FinishAsyncStep(job, StepStatus::BudgetExhausted);
+      return false;
+    }
+
+    ExecuteNextGeneration();
+    job.done++;
+    if (options.progress && options.progress_period &&
+        job.done % options.progress_period == 0) {
+      options.progress(StepProgress{job.done, generations_count,
+                                    world.GetAliveCellsCount()});
+    }
+  }
+  return true;
+}
+
+void GameOfLife::FinishAsyncStep(AsyncStepJob &job, const StepStatus status) {
+  const StepResult result{status, job.done, generations_count};
+  // the caller could start the next step as soon as the future is ready
+  is_async_step_running = false;
+  job.promise.set_value(result);
+}
+
+void GameOfLife::EnableSnapshots() {
+  if (snapshots) {
+    return;
+  }
+  snapshots = std::unique_ptr<SnapshotPublisher>(
+      new SnapshotPublisher(world.GetStatistics()));
+  snapshots->Publish(generations_count, world.GetPackedCells(),
+                     world.GetStatistics());
+}
+
+bool GameOfLife::EnableStreaming(const std::string &socket_path,
+                                 const FrameServerSettings &server_settings) {
+  std::unique_ptr<FrameServer> server(
+      new FrameServer(socket_path, server_settings));
+  if (!server->Start()) {
+    return false;
+  }
+  frame_server = std::move(server);
+  return true;
+}
+
+void GameOfLife::EnableHistory(const std::size_t memory_budget,
+                               const std::uint32_t keyframe_interval) {
+  history = std::unique_ptr<RewindBuffer>(
+      new RewindBuffer(memory_budget, keyframe_interval));
+  history->Push(generations_count, world.GetPackedCells());
+}
+
+bool GameOfLife::Rewind(const std::uint32_t generations) {
+  if (!history || generations > generations_count) {
+    return false;
+  }
+  const std::uint32_t generation = generations_count - generations;
+  PackedGrid cells;
+  if (!history->Get(generation, cells)) {
+    return false;
+  }
+
+  {
+    boost::unique_lock<boost::shared_mutex> lock(world_cells_mutex);
+    world.StartGeneration();
+    world.ApplyPackedCells(cells, *rules.get());
+    generations_count = generation;
+  }
+  world.ResetHashes();
   world.UpdateHash();
-  generations_count++;
+  history->Truncate(generation);
+  termination->Reset();
+  UpdateTermination();
+  PublishGeneration();
+  return true;
+}
+
+bool GameOfLife::GetHistoryCells(const std::uint32_t generation,
+                                 PackedGrid &cells) const {
+  return history && history->Get(generation, cells);
 }
 
 bool GameOfLife::IsGameOver() {
-  return rules->IsGameOver(world.GetAliveCellsCount(),
-                           world.GetEqualWorldsCount(), generations_count);
+  return termination_reason != TerminationReason::None;
+}
+
+TerminationReason GameOfLife::GetTerminationReason() const {
+  return termination_reason;
+}
+
+void GameOfLife::SetTerminationPolicy(
+    std::unique_ptr<TerminationPolicy> policy) {
+  termination = std::move(policy);
+  termination->Reset();
+  UpdateTermination();
+}
+
+void GameOfLife::UpdateTermination() {
+  const TerminationCounters counters{generations_count,
+                                     world.GetEqualWorldsCount(),
+                                     world.GetStatistics().GetSummary()};
+  termination_reason = termination->Update(counters);
+}
+
+std::uint32_t GameOfLife::GetGenerationsCount() const {
+  return generations_count;
+}
+
+std::vector<CensusEntry> GameOfLife::TakeCensus() {
+  // objects are simulated in isolation with Conway like rules of square
+  // cells, other worlds don't evolve by them
+  if (settings.topology != GridTopology::Square ||
+      !NeighbourhoodRuleTable(*rules).IsTotalistic() ||
+      settings.engine == GenerationEngineType::Continuous ||
+      settings.birth_probability < 1 || settings.survival_probability < 1) {
+    std::cerr << "Census needs deterministic totalistic rules of square cells"
+              << std::endl;
+    return std::vector<CensusEntry>();
+  }
+  if (!census) {
+    census = std::unique_ptr<ObjectCensus>(
+        new ObjectCensus(TotalisticRuleTable(*rules)));
+  }
+  return census->Take(world.GetPackedCells());
+}
+
+const PopulationPyramid &GameOfLife::GetPopulationPyramid() {
+  if (!population_pyramid) {
+    population_pyramid = std::unique_ptr<PopulationPyramid>(
+        new PopulationPyramid(world.GetStatistics()));
+  } else {
+    population_pyramid->Update(world.GetStatistics());
+  }
+  return *population_pyramid;
 }
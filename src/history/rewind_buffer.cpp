@@ -0,0 +1,190 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "history/rewind_buffer.h"
+#include "history/zero_run_codec.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+constexpr std::uint32_t RewindBuffer::cDefaultKeyframeInterval;
+
+RewindBuffer::RewindBuffer(const std::size_t memory_budget,
+                           const std::uint32_t keyframe_interval)
+    : cMemoryBudget(memory_budget),
+      cKeyframeInterval(std::max(1U, keyframe_interval)),
+      frames_since_keyframe(0), memory_usage(0) {}
+
+void RewindBuffer::Push(const std::uint32_t generation,
+                        const PackedGrid &grid) {
+  if (!frames.empty() && (grid.GetRowCount() != newest.GetRowCount() ||
+                          grid.GetColumnCount() != newest.GetColumnCount())) {
+    Clear();
+  }
+  if (!frames.empty() && generation == frames.back().generation) {
+    ReplaceNewest(grid);
+    return;
+  }
+  if (!frames.empty() && generation < frames.back().generation) {
+    std::cerr << "Generation " << generation
+              << " is not newer than the history" << std::endl;
+    return;
+  }
+
+  const std::size_t words_count =
+      static_cast<std::size_t>(grid.GetRowCount()) * grid.GetWordsPerRow();
+  Frame frame{generation, frames.empty() ||
+                              frames_since_keyframe + 1 >= cKeyframeInterval,
+              {}};
+  if (frame.is_keyframe) {
+    ZeroRunCodec::Encode(grid.GetData(), words_count, frame.data);
+    frames_since_keyframe = 0;
+  } else {
+    delta.resize(words_count);
+    const std::uint64_t *old_words = newest.GetData();
+    const std::uint64_t *new_words = grid.GetData();
+    for (std::size_t word = 0; word < words_count; word++) {
+      delta[word] = old_words[word] ^ new_words[word];
+    }
+    ZeroRunCodec::Encode(delta.data(), words_count, frame.data);
+    frames_since_keyframe++;
+  }
+  frame.data.shrink_to_fit();
+
+  memory_usage += GetFrameSize(frame);
+  frames.push_back(std::move(frame));
+  newest = grid;
+  EnforceBudget();
+}
+
+void RewindBuffer::ReplaceNewest(const PackedGrid &grid) {
+  Frame &frame = frames.back();
+  const std::size_t words_count =
+      static_cast<std::size_t>(grid.GetRowCount()) * grid.GetWordsPerRow();
+  memory_usage -= GetFrameSize(frame);
+  if (frame.is_keyframe) {
+    frame.data.clear();
+    ZeroRunCodec::Encode(grid.GetData(), words_count, frame.data);
+  } else {
+    // the old delta XOR the old and the new grid is the delta from the
+    // previous frame to the new grid
+    delta.resize(words_count);
+    const std::uint64_t *old_words = newest.GetData();
+    const std::uint64_t *new_words = grid.GetData();
+    for (std::size_t word = 0; word < words_count; word++) {
+      delta[word] = old_words[word] ^ new_words[word];
+    }
+    ZeroRunCodec::DecodeXor(frame.data, delta.data(), words_count);
+    frame.data.clear();
+    ZeroRunCodec::Encode(delta.data(), words_count, frame.data);
+  }
+  frame.data.shrink_to_fit();
+
+  memory_usage += GetFrameSize(frame);
+  newest = grid;
+  EnforceBudget();
+}
+
+bool RewindBuffer::Get(const std::uint32_t generation,
+                       PackedGrid &grid) const {
+  const std::size_t index = FindFrame(generation);
+  if (index == frames.size()) {
+    return false;
+  }
+  std::size_t keyframe = index;
+  while (!frames[keyframe].is_keyframe) {
+    keyframe--;
+  }
+
+  PackedGrid restored(newest.GetRowCount(), newest.GetColumnCount());
+  std::uint64_t *words = restored.GetRow(0);
+  const std::size_t words_count = static_cast<std::size_t>(
+                                      restored.GetRowCount()) *
+                                  restored.GetWordsPerRow();
+  for (std::size_t frame = keyframe; frame <= index; frame++) {
+    if (!ZeroRunCodec::DecodeXor(frames[frame].data, words, words_count)) {
+      std::cerr << "History of generation " << frames[frame].generation
+                << " is corrupted" << std::endl;
+      return false;
+    }
+  }
+  grid = std::move(restored);
+  return true;
+}
+
+void RewindBuffer::Truncate(const std::uint32_t generation) {
+  if (frames.empty() || frames.back().generation <= generation) {
+    return;
+  }
+  while (!frames.empty() && frames.back().generation > generation) {
+    memory_usage -= GetFrameSize(frames.back());
+    frames.pop_back();
+  }
+  if (frames.empty()) {
+    Clear();
+    return;
+  }
+
+  Get(frames.back().generation, newest);
+  frames_since_keyframe = 0;
+  for (auto frame = frames.rbegin(); !frame->is_keyframe; ++frame) {
+    frames_since_keyframe++;
+  }
+}
+
+void RewindBuffer::Clear() {
+  frames.clear();
+  frames_since_keyframe = 0;
+  memory_usage = 0;
+  newest = PackedGrid();
+}
+
+bool RewindBuffer::IsEmpty() const { return frames.empty(); }
+
+std::uint32_t RewindBuffer::GetOldestGeneration() const {
+  return frames.empty() ? 0 : frames.front().generation;
+}
+
+std::uint32_t RewindBuffer::GetNewestGeneration() const {
+  return frames.empty() ? 0 : frames.back().generation;
+}
+
+std::size_t RewindBuffer::GetFramesCount() const { return frames.size(); }
+
+std::size_t RewindBuffer::GetMemoryUsage() const { return memory_usage; }
+
+std::size_t RewindBuffer::FindFrame(const std::uint32_t generation) const {
+  const auto frame = std::lower_bound(
+      frames.begin(), frames.end(), generation,
+      [](const Frame &frame, const std::uint32_t generation) {
+        return frame.generation < generation;
+      });
+  if (frame == frames.end() || frame->generation != generation) {
+    return frames.size();
+  }
+  return frame - frames.begin();
+}
+
+std::size_t RewindBuffer::GetFrameSize(const Frame &frame) {
+  return sizeof(frame) + frame.data.capacity();
+}
+
+void RewindBuffer::EnforceBudget() {
+  while (memory_usage > cMemoryBudget) {
+    // frames up to the next keyframe depend on the oldest keyframe
+    std::size_t next_keyframe = 1;
+    while (next_keyframe < frames.size() &&
+           !frames[next_keyframe].is_keyframe) {
+      next_keyframe++;
+    }
+    if (next_keyframe == frames.size()) {
+      return;
+    }
+    for (std::size_t frame = 0; frame < next_keyframe; frame++) {
+      memory_usage -= GetFrameSize(frames.front());
+      frames.pop_front();
+    }
+  }
+}
@@ -0,0 +1,76 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "history/zero_run_codec.h"
+
+#include <cstring>
+
+void ZeroRunCodec::Encode(const std::uint64_t *words, const std::size_t count,
+                          std::vector<std::uint8_t> &data) {
+  std::size_t position = 0;
+  while (position < count) {
+    const std::size_t zeros_start = position;
+    while (position < count && !words[position]) {
+      position++;
+    }
+    const std::size_t literals_start = position;
+    while (position < count && words[position]) {
+      position++;
+    }
+
+    WriteVarint(literals_start - zeros_start, data);
+    WriteVarint(position - literals_start, data);
+    const std::size_t bytes = (position - literals_start) * sizeof(*words);
+    data.resize(data.size() + bytes);
+    std::memcpy(data.data() + data.size() - bytes, words + literals_start,
+                bytes);
+  }
+}
+
+bool ZeroRunCodec::DecodeXor(const std::vector<std::uint8_t> &data,
+                             std::uint64_t *words, const std::size_t count) {
+  std::size_t position = 0, word = 0;
+  while (position < data.size()) {
+    std::uint64_t zeros = 0, literals = 0;
+    if (!ReadVarint(data, position, zeros) ||
+        !ReadVarint(data, position, literals) || zeros > count - word ||
+        literals > count - word - zeros ||
+        literals * sizeof(*words) > data.size() - position) {
+      return false;
+    }
+    word += zeros;
+    for (std::uint64_t literal = 0; literal < literals; literal++) {
+      std::uint64_t value;
+      std::memcpy(&value, data.data() + position, sizeof(value));
+      position += sizeof(value);
+      words[word++] ^= value;
+    }
+  }
+  return word == count;
+}
+
+void ZeroRunCodec::WriteVarint(std::uint64_t value,
+                               std::vector<std::uint8_t> &data) {
+  while (value >= 0x80) {
+    data.push_back(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  data.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool ZeroRunCodec::ReadVarint(const std::vector<std::uint8_t> &data,
+                              std::size_t &position, std::uint64_t &value) {
+  value = 0;
+  for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+    if (position >= data.size()) {
+      return false;
+    }
+    const std::uint8_t byte = data[position++];
+    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
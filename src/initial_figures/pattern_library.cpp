@@ -0,0 +1,102 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "initial_figures/pattern_library.h"
+#include "region/region_operations.h"
+
+constexpr std::uint64_t pattern_bitmap::Cells::cBlock[];
+constexpr std::uint64_t pattern_bitmap::Cells::cBeehive[];
+constexpr std::uint64_t pattern_bitmap::Cells::cLoaf[];
+constexpr std::uint64_t pattern_bitmap::Cells::cBoat[];
+constexpr std::uint64_t pattern_bitmap::Cells::cBlinker[];
+constexpr std::uint64_t pattern_bitmap::Cells::cToad[];
+constexpr std::uint64_t pattern_bitmap::Cells::cBeacon[];
+constexpr std::uint64_t pattern_bitmap::Cells::cPulsar[];
+constexpr std::uint64_t pattern_bitmap::Cells::cPentadecathlon[];
+constexpr std::uint64_t pattern_bitmap::Cells::cGlider[];
+constexpr std::uint64_t pattern_bitmap::Cells::cLightweightSpaceship[];
+constexpr std::uint64_t pattern_bitmap::Cells::cRPentomino[];
+constexpr std::uint64_t pattern_bitmap::Cells::cAcorn[];
+constexpr std::uint64_t pattern_bitmap::Cells::cDiehard[];
+constexpr std::uint64_t pattern_bitmap::Cells::cGosperGliderGun[];
+constexpr std::uint64_t pattern_bitmap::Cells::cBlockLayingSwitchEngine[];
+
+constexpr Pattern PatternLibrary::cBlock;
+constexpr Pattern PatternLibrary::cBeehive;
+constexpr Pattern PatternLibrary::cLoaf;
+constexpr Pattern PatternLibrary::cBoat;
+constexpr Pattern PatternLibrary::cBlinker;
+constexpr Pattern PatternLibrary::cToad;
+constexpr Pattern PatternLibrary::cBeacon;
+constexpr Pattern PatternLibrary::cPulsar;
+constexpr Pattern PatternLibrary::cPentadecathlon;
+constexpr Pattern PatternLibrary::cGlider;
+constexpr Pattern PatternLibrary::cLightweightSpaceship;
+constexpr Pattern PatternLibrary::cRPentomino;
+constexpr Pattern PatternLibrary::cAcorn;
+constexpr Pattern PatternLibrary::cDiehard;
+constexpr Pattern PatternLibrary::cGosperGliderGun;
+constexpr Pattern PatternLibrary::cBlockLayingSwitchEngine;
+
+const std::vector<Pattern> &PatternLibrary::GetPatterns() {
+  static const std::vector<Pattern> patterns = {cBlock,
+                                                 cBeehive,
+                                                 cLoaf,
+                                                 cBoat,
+                                                 cBlinker,
+                                                 cToad,
+                                                 cBeacon,
+                                                 cPulsar,
+                                                 cPentadecathlon,
+                                                 cGlider,
+                                                 cLightweightSpaceship,
+                                                 cRPentomino,
+                                                 cAcorn,
+                                                 cDiehard,
+                                                 cGosperGliderGun,
+                                                 cBlockLayingSwitchEngine};
+  return patterns;
+}
+
+const Pattern *PatternLibrary::FindPattern(const std::string &name) {
+  for (const auto &pattern : GetPatterns()) {
+    if (name == pattern.name) {
+      return &pattern;
+    }
+  }
+  return nullptr;
+}
+
+PackedGrid PatternLibrary::GetCells(const Pattern &pattern) {
+  PackedGrid cells(pattern.rows, pattern.columns);
+  for (std::uint32_t row = 0; row < pattern.rows; row++) {
+    *cells.GetRow(row) = pattern.cells[row];
+  }
+  return cells;
+}
+
+std::vector<std::uint64_t>
+PatternLibrary::GetTransformedCells(const Pattern &pattern,
+                                    const PatternTransform transform,
+                                    std::uint32_t &rows,
+                                    std::uint32_t &columns) {
+  const PackedGrid cells =
+      RegionOperations::Transform(GetCells(pattern), transform);
+  rows = cells.GetRowCount();
+  columns = cells.GetColumnCount();
+  std::vector<std::uint64_t> words(rows, 0);
+  for (std::uint32_t row = 0; row < rows && columns; row++) {
+    words[row] = *cells.GetRow(row);
+  }
+  return words;
+}
+
+void PatternLibrary::Stamp(PackedGrid &grid, const Pattern &pattern,
+                           const PatternTransform transform,
+                           const std::uint32_t row,
+                           const std::uint32_t column) {
+  RegionOperations::Write(
+      grid, RegionOperations::Transform(GetCells(pattern), transform), row,
+      column, RegionOperation::Or, CellBordersRule::RingBorders);
+}
@@ -4,20 +4,38 @@
 /// (BMW AG)
 ///
 #include "game_of_life.h"
+#include "tuning/game_of_life_factory.h"
 
+#include <cstring>
 #include <iostream>
 
 int main(int argc, char **argv) {
   std::cout << "Game of life started" << std::endl;
-  GameOfLife game(5, 10);
-  game.FillInitialPicture(GameOfLifeInitialState::RandomLine);
-  while (true) {
-    game.Draw();
-    game.ExecuteNextGeneration();
-    if (game.IsGameOver()) {
-      std::cout << "Game over" << std::endl;
-      game.Draw();
-      break;
-    }
+  constexpr std::uint32_t rows = 5, columns = 10;
+  GameOfLifeSettings settings;
+  // --autotune [profile path] measures engines and threads before the game
+  // or reads them from the profile
+  if (argc > 1 && !std::strcmp(argv[1], "--autotune")) {
+    settings.autotune = true;
+    settings.autotune_profile_path = argc > 2 ? argv[2] : "";
+  }
+  InitialFigure initial_figure(rows, columns);
+  initial_figure.BuildRandomLine();
+  const std::unique_ptr<GameOfLife> game_pointer =
+      GameOfLifeFactory::MakeGameOfLife(rows, columns, settings,
+                                        initial_figure.GetPoints());
+  GameOfLife &game = *game_pointer;
+  game.EnableSnapshots();
+  game.Draw();
+  AsyncStepOptions options;
+  options.progress_period = 1;
+  options.progress = [&game](const StepProgress &) { game.Draw(); };
+  // the main thread is free until the game is over
+  game.RunUntilGameOver(options).wait();
+  std::cout << "Game over: "
+            << GetTerminationReasonName(game.GetTerminationReason())
+            << std::endl;
+  for (const auto &entry : game.TakeCensus()) {
+    std::cout << entry.object.name << " " << entry.count << std::endl;
   }
 }
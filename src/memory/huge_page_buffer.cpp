@@ -0,0 +1,62 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "memory/huge_page_buffer.h"
+
+#include <iostream>
+#include <sys/mman.h>
+
+constexpr std::size_t HugePageBuffer::cHugePageSize;
+
+HugePageBuffer::HugePageBuffer(const std::size_t requested_size)
+    : data(nullptr), size(0), mode(HugePageMode::Disabled) {
+  if (requested_size == 0) {
+    return;
+  }
+
+  const std::size_t huge_size =
+      (requested_size + cHugePageSize - 1) / cHugePageSize * cHugePageSize;
+
+#ifdef MAP_HUGETLB
+  if (requested_size >= cHugePageSize) {
+    void *huge_data = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (huge_data != MAP_FAILED) {
+      data = huge_data;
+      size = huge_size;
+      mode = HugePageMode::Explicit;
+      return;
+    }
+  }
+#endif
+
+  // regions smaller than a huge page are not rounded up
+  size = requested_size >= cHugePageSize ? huge_size : requested_size;
+  void *regular_data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (regular_data == MAP_FAILED) {
+    std::cerr << "Can't map " << size << " bytes" << std::endl;
+    size = 0;
+    return;
+  }
+  data = regular_data;
+
+#ifdef MADV_HUGEPAGE
+  if (size >= cHugePageSize && !madvise(data, size, MADV_HUGEPAGE)) {
+    mode = HugePageMode::Transparent;
+  }
+#endif
+}
+
+HugePageBuffer::~HugePageBuffer() {
+  if (data) {
+    munmap(data, size);
+  }
+}
+
+void *HugePageBuffer::GetData() const { return data; }
+
+std::size_t HugePageBuffer::GetSize() const { return size; }
+
+HugePageMode HugePageBuffer::GetMode() const { return mode; }
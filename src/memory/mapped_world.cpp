@@ -0,0 +1,305 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "memory/mapped_world.h"
+#include "engine/bit_sliced_kernel.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+constexpr std::size_t MappedWorld::cReadaheadBytes;
+constexpr char MappedWorld::cMagic[8];
+constexpr std::size_t MappedWorld::cCellsOffset;
+
+namespace {
+std::uint32_t CountWordsPerRow(const std::uint32_t columns) {
+  return (columns + 63) / 64;
+}
+
+std::size_t GetPageSize() {
+  static const std::size_t page_size =
+      static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+} // namespace
+
+std::unique_ptr<MappedWorld>
+MappedWorld::Create(const std::string &path, const std::uint32_t rows,
+                    const std::uint32_t columns,
+                    const std::uint32_t readahead_rows) {
+  const std::size_t size =
+      cCellsOffset + static_cast<std::size_t>(rows) *
+                         CountWordsPerRow(columns) * sizeof(std::uint64_t);
+  const int descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0) {
+    std::cerr << "Can't create world file " << path << std::endl;
+    return nullptr;
+  }
+  // the file is sparse, cells which were never written are read as zeros
+  if (ftruncate(descriptor, static_cast<off_t>(size))) {
+    std::cerr << "Can't resize world file " << path << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, cMagic, sizeof(cMagic));
+  header.rows = rows;
+  header.columns = columns;
+  header.generations_count = 0;
+  header.is_stepping = 0;
+  if (pwrite(descriptor, &header, sizeof(header), 0) !=
+      static_cast<ssize_t>(sizeof(header))) {
+    std::cerr << "Can't write world file " << path << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+  return Map(descriptor, size, readahead_rows);
+}
+
+std::unique_ptr<MappedWorld>
+MappedWorld::Open(const std::string &path,
+                  const std::uint32_t readahead_rows) {
+  const int descriptor = open(path.c_str(), O_RDWR);
+  if (descriptor < 0) {
+    std::cerr << "Can't open world file " << path << std::endl;
+    return nullptr;
+  }
+  FileHeader header{};
+  struct stat file_stat {};
+  if (fstat(descriptor, &file_stat) ||
+      pread(descriptor, &header, sizeof(header), 0) !=
+          static_cast<ssize_t>(sizeof(header)) ||
+      std::memcmp(header.magic, cMagic, sizeof(cMagic))) {
+    std::cerr << "File " << path << " is not a world file" << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+  if (header.is_stepping) {
+    std::cerr << "World file " << path
+              << " was left in the middle of a generation" << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+  const std::size_t size =
+      cCellsOffset + static_cast<std::size_t>(header.rows) *
+                         CountWordsPerRow(header.columns) *
+                         sizeof(std::uint64_t);
+  if (static_cast<std::size_t>(file_stat.st_size) < size) {
+    std::cerr << "World file " << path << " is truncated" << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+  return Map(descriptor, size, readahead_rows);
+}
+
+std::unique_ptr<MappedWorld>
+MappedWorld::Map(const int descriptor, const std::size_t size,
+                 const std::uint32_t readahead_rows) {
+  void *data =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  if (data == MAP_FAILED) {
+    std::cerr << "Can't map world file of " << size << " bytes" << std::endl;
+    close(descriptor);
+    return nullptr;
+  }
+  return std::unique_ptr<MappedWorld>(
+      new MappedWorld(descriptor, data, size, readahead_rows));
+}
+
+MappedWorld::MappedWorld(const int descriptor, void *data,
+                         const std::size_t size,
+                         const std::uint32_t readahead_rows)
+    : descriptor(descriptor), data(data), size(size),
+      header(static_cast<FileHeader *>(data)),
+      cells(reinterpret_cast<std::uint64_t *>(static_cast<char *>(data) +
+                                              cCellsOffset)),
+      words_per_row(CountWordsPerRow(header->columns)),
+      readahead_rows(readahead_rows) {
+  const std::size_t row_bytes =
+      std::max<std::size_t>(1, words_per_row * sizeof(std::uint64_t));
+  if (!this->readahead_rows) {
+    this->readahead_rows = static_cast<std::uint32_t>(
+        std::max<std::size_t>(1, cReadaheadBytes / row_bytes));
+  }
+  // the whole file is read in order, the kernel reads ahead and frees pages
+  // behind
+  madvise(data, size, MADV_SEQUENTIAL);
+}
+
+MappedWorld::~MappedWorld() {
+  Flush();
+  munmap(data, size);
+  close(descriptor);
+}
+
+std::uint32_t MappedWorld::GetRowCount() const { return header->rows; }
+
+std::uint32_t MappedWorld::GetColumnCount() const { return header->columns; }
+
+std::uint32_t MappedWorld::GetWordsPerRow() const { return words_per_row; }
+
+std::uint64_t MappedWorld::GetGenerationsCount() const {
+  return header->generations_count;
+}
+
+bool MappedWorld::Get(const std::uint32_t row,
+                      const std::uint32_t column) const {
+  if (row >= header->rows || column >= header->columns) {
+    return false;
+  }
+  return (GetRow(row)[column / 64] >> (column % 64)) & 1;
+}
+
+void MappedWorld::Set(const std::uint32_t row, const std::uint32_t column,
+                      const bool is_alive) {
+  if (row >= header->rows || column >= header->columns) {
+    std::cerr << "Incorrect column or row" << std::endl;
+    return;
+  }
+  const std::uint64_t bit = 1ULL << (column % 64);
+  if (is_alive) {
+    GetRow(row)[column / 64] |= bit;
+  } else {
+    GetRow(row)[column / 64] &= ~bit;
+  }
+}
+
+std::uint64_t *MappedWorld::GetRow(const std::uint32_t row) {
+  return cells + static_cast<std::size_t>(row) * words_per_row;
+}
+
+const std::uint64_t *MappedWorld::GetRow(const std::uint32_t row) const {
+  return cells + static_cast<std::size_t>(row) * words_per_row;
+}
+
+std::uint64_t MappedWorld::CountAlive() const {
+  std::uint64_t count = 0;
+  const std::size_t words =
+      static_cast<std::size_t>(header->rows) * words_per_row;
+  for (std::size_t word = 0; word < words; word++) {
+    count += __builtin_popcountll(cells[word]);
+  }
+  return count;
+}
+
+bool MappedWorld::Step(const TotalisticRuleTable &rule_table,
+                       const std::uint32_t generations) {
+  if (rule_table.GetTopology() != GridTopology::Square) {
+    std::cerr << "Mapped world supports only square cells" << std::endl;
+    return false;
+  }
+  const std::uint32_t rows = header->rows;
+  if (!rows || !words_per_row) {
+    header->generations_count += generations;
+    return true;
+  }
+
+  const BitSlicedKernel kernel(rule_table, header->columns);
+  const bool is_ring =
+      rule_table.GetBordersRule() == CellBordersRule::RingBorders;
+  const std::size_t row_bytes = words_per_row * sizeof(std::uint64_t);
+  // old rows are overwritten by the sweep, so the row above, the current
+  // row and the first row for ring borders are kept in memory
+  std::vector<std::uint64_t> above(words_per_row), current(words_per_row),
+      first(words_per_row), next(words_per_row);
+  // the mark is in the file before the first row is overwritten
+  header->is_stepping = 1;
+  if (!FlushHeader()) {
+    return false;
+  }
+
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    Advise(0, std::min(rows, readahead_rows), MADV_WILLNEED);
+    std::memcpy(first.data(), GetRow(0), row_bytes);
+    std::memcpy(current.data(), first.data(), row_bytes);
+    // the last row is not written yet when the first row is calculated
+    std::memcpy(above.data(), GetRow(rows - 1), row_bytes);
+
+    for (std::uint32_t row = 0; row < rows; row++) {
+      if (row % readahead_rows == 0) {
+        Advise(row + readahead_rows, row + 2 * readahead_rows, MADV_WILLNEED);
+        if (row >= 2 * readahead_rows) {
+          Release(row - 2 * readahead_rows, row - readahead_rows);
+        }
+      }
+      const std::uint64_t *row_above =
+          row > 0 || is_ring ? above.data() : nullptr;
+      const std::uint64_t *row_below =
+          row + 1 < rows ? GetRow(row + 1) : is_ring ? first.data() : nullptr;
+      kernel.StepRow(row_above, current.data(), row_below, next.data());
+      std::memcpy(GetRow(row), next.data(), row_bytes);
+
+      above.swap(current);
+      if (row + 1 < rows) {
+        std::memcpy(current.data(), GetRow(row + 1), row_bytes);
+      }
+    }
+    header->generations_count++;
+  }
+  // rows of the last generation are in the file before the mark is removed
+  if (!Flush()) {
+    return false;
+  }
+  header->is_stepping = 0;
+  return FlushHeader();
+}
+
+bool MappedWorld::Flush() {
+  if (msync(data, size, MS_SYNC)) {
+    std::cerr << "Can't write world file" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool MappedWorld::FlushHeader() {
+  if (msync(data, std::min(size, GetPageSize()), MS_SYNC)) {
+    std::cerr << "Can't write world file header" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void MappedWorld::Advise(const std::uint32_t begin_row,
+                         const std::uint32_t end_row,
+                         const int advice) const {
+  const std::uint32_t last_row = std::min(end_row, header->rows);
+  if (begin_row >= last_row) {
+    return;
+  }
+  const std::size_t page_size = GetPageSize();
+  const std::size_t row_bytes = words_per_row * sizeof(std::uint64_t);
+  const std::size_t begin =
+      (cCellsOffset + begin_row * row_bytes) / page_size * page_size;
+  const std::size_t end = std::min(
+      size, (cCellsOffset + last_row * row_bytes + page_size - 1) /
+                page_size * page_size);
+  madvise(static_cast<char *>(data) + begin, end - begin, advice);
+}
+
+void MappedWorld::Release(const std::uint32_t begin_row,
+                          const std::uint32_t end_row) {
+  const std::size_t page_size = GetPageSize();
+  const std::size_t row_bytes = words_per_row * sizeof(std::uint64_t);
+  // only whole pages of the rows are released, pages shared with the rows
+  // around are still in use
+  const std::size_t begin =
+      (cCellsOffset + begin_row * row_bytes + page_size - 1) / page_size *
+      page_size;
+  const std::size_t end =
+      (cCellsOffset + end_row * row_bytes) / page_size * page_size;
+  if (begin >= end) {
+    return;
+  }
+  char *pages = static_cast<char *>(data) + begin;
+  msync(pages, end - begin, MS_ASYNC);
+  madvise(pages, end - begin, MADV_DONTNEED);
+}
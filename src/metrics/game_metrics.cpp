@@ -0,0 +1,179 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "metrics/game_metrics.h"
+
+namespace {
+const char *GetPhaseName(const GenerationPhase phase) {
+  switch (phase) {
+  case GenerationPhase::Evaluation:
+    return "evaluation";
+  case GenerationPhase::BarrierWait:
+    return "barrier_wait";
+  case GenerationPhase::UpdateWorld:
+    return "update_world";
+  case GenerationPhase::UpdateHash:
+    return "update_hash";
+  default:
+    return "unknown";
+  }
+}
+
+constexpr std::size_t cPhasesCount =
+    static_cast<std::size_t>(GenerationPhase::Count);
+} // namespace
+
+GameMetrics::ThreadMetrics::ThreadMetrics() : busy_nanos(0), idle_nanos(0) {
+  for (auto &nanos : phase_nanos) {
+    nanos.store(0);
+  }
+}
+
+GameMetrics::GameMetrics(const std::uint32_t threads_count)
+    : threads_metrics(threads_count + 1), changed_cells_count(0),
+      last_changed_cells_count(0), current_changed_cells_count(0),
+      world_statistics(), hash_table_size(0), generations_count(0) {}
+
+void GameMetrics::AddPhaseTime(const GenerationPhase phase,
+                               const std::uint32_t thread_num,
+                               const std::chrono::nanoseconds time) {
+  if (thread_num >= threads_metrics.size() || phase == GenerationPhase::Count) {
+    return;
+  }
+  threads_metrics[thread_num]
+      .phase_nanos[static_cast<std::size_t>(phase)]
+      .fetch_add(time.count(), std::memory_order_relaxed);
+}
+
+void GameMetrics::AddBusyTime(const std::uint32_t thread_num,
+                              const std::chrono::nanoseconds time) {
+  if (thread_num >= threads_metrics.size()) {
+    return;
+  }
+  threads_metrics[thread_num].busy_nanos.fetch_add(time.count(),
+                                                   std::memory_order_relaxed);
+}
+
+void GameMetrics::AddIdleTime(const std::uint32_t thread_num,
+                              const std::chrono::nanoseconds time) {
+  if (thread_num >= threads_metrics.size()) {
+    return;
+  }
+  threads_metrics[thread_num].idle_nanos.fetch_add(time.count(),
+                                                   std::memory_order_relaxed);
+}
+
+void GameMetrics::AddChangedCells(const std::uint64_t changed_cells) {
+  current_changed_cells_count.fetch_add(changed_cells,
+                                        std::memory_order_relaxed);
+}
+
+void GameMetrics::FinishGeneration(const std::uint32_t generations,
+                                   const std::uint64_t hash_size) {
+  const std::uint64_t changed_cells = current_changed_cells_count.exchange(0);
+  last_changed_cells_count.store(changed_cells);
+  changed_cells_count.fetch_add(changed_cells);
+  hash_table_size = hash_size;
+  generations_count = generations;
+}
+
+void GameMetrics::SetWorldStatistics(const StatisticsSummary &summary) {
+  world_statistics = summary;
+}
+
+std::uint32_t GameMetrics::GetControlThreadNum() const {
+  return threads_metrics.size() - 1;
+}
+
+std::uint32_t GameMetrics::GetGenerationsCount() const {
+  return generations_count;
+}
+
+std::chrono::nanoseconds
+GameMetrics::GetPhaseTime(const GenerationPhase phase) const {
+  std::uint64_t nanos = 0;
+  if (phase == GenerationPhase::Count) {
+    return std::chrono::nanoseconds(0);
+  }
+  for (const auto &thread_metrics : threads_metrics) {
+    nanos += thread_metrics.phase_nanos[static_cast<std::size_t>(phase)].load(
+        std::memory_order_relaxed);
+  }
+  return std::chrono::nanoseconds(nanos);
+}
+
+void GameMetrics::WriteJson(std::ostream &stream) const {
+  stream << "{\"generations\":" << generations_count
+         << ",\"changed_cells_total\":" << changed_cells_count.load()
+         << ",\"changed_cells_last\":" << last_changed_cells_count.load()
+         << ",\"hash_table_size\":" << hash_table_size
+         << ",\"population\":" << world_statistics.population
+         << ",\"births\":" << world_statistics.births
+         << ",\"deaths\":" << world_statistics.deaths;
+  if (world_statistics.population) {
+    const BoundingBox &box = world_statistics.bounding_box;
+    stream << ",\"bounding_box\":[" << box.top_row << "," << box.left_column
+           << "," << box.bottom_row << "," << box.right_column << "]"
+           << ",\"centroid\":[" << world_statistics.centroid_row << ","
+           << world_statistics.centroid_column << "]";
+  }
+  stream << ",\"phases_ns\":{";
+  for (std::size_t phase = 0; phase < cPhasesCount; phase++) {
+    const auto phase_type = static_cast<GenerationPhase>(phase);
+    stream << (phase ? "," : "") << "\"" << GetPhaseName(phase_type)
+           << "\":" << GetPhaseTime(phase_type).count();
+  }
+  stream << "},\"threads\":[";
+  for (std::size_t thread_num = 0; thread_num < threads_metrics.size();
+       thread_num++) {
+    const auto &thread_metrics = threads_metrics[thread_num];
+    stream << (thread_num ? "," : "") << "{\"thread\":" << thread_num
+           << ",\"control\":"
+           << (thread_num == GetControlThreadNum() ? "true" : "false")
+           << ",\"busy_ns\":" << thread_metrics.busy_nanos.load()
+           << ",\"idle_ns\":" << thread_metrics.idle_nanos.load() << "}";
+  }
+  stream << "]}" << std::endl;
+}
+
+void GameMetrics::WritePrometheus(std::ostream &stream) const {
+  stream << "# TYPE game_of_life_generations_total counter\n"
+         << "game_of_life_generations_total " << generations_count << "\n"
+         << "# TYPE game_of_life_changed_cells_total counter\n"
+         << "game_of_life_changed_cells_total " << changed_cells_count.load()
+         << "\n"
+         << "# TYPE game_of_life_changed_cells gauge\n"
+         << "game_of_life_changed_cells " << last_changed_cells_count.load()
+         << "\n"
+         << "# TYPE game_of_life_hash_table_size gauge\n"
+         << "game_of_life_hash_table_size " << hash_table_size << "\n"
+         << "# TYPE game_of_life_population gauge\n"
+         << "game_of_life_population " << world_statistics.population << "\n"
+         << "# TYPE game_of_life_births gauge\n"
+         << "game_of_life_births " << world_statistics.births << "\n"
+         << "# TYPE game_of_life_deaths gauge\n"
+         << "game_of_life_deaths " << world_statistics.deaths << "\n"
+         << "# TYPE game_of_life_phase_seconds_total counter\n";
+  for (std::size_t phase = 0; phase < cPhasesCount; phase++) {
+    const auto phase_type = static_cast<GenerationPhase>(phase);
+    stream << "game_of_life_phase_seconds_total{phase=\""
+           << GetPhaseName(phase_type) << "\"} "
+           << GetPhaseTime(phase_type).count() / 1e9 << "\n";
+  }
+  stream << "# TYPE game_of_life_thread_busy_seconds_total counter\n";
+  for (std::size_t thread_num = 0; thread_num < threads_metrics.size();
+       thread_num++) {
+    stream << "game_of_life_thread_busy_seconds_total{thread=\"" << thread_num
+           << "\"} " << threads_metrics[thread_num].busy_nanos.load() / 1e9
+           << "\n";
+  }
+  stream << "# TYPE game_of_life_thread_idle_seconds_total counter\n";
+  for (std::size_t thread_num = 0; thread_num < threads_metrics.size();
+       thread_num++) {
+    stream << "game_of_life_thread_idle_seconds_total{thread=\"" << thread_num
+           << "\"} " << threads_metrics[thread_num].idle_nanos.load() / 1e9
+           << "\n";
+  }
+  stream.flush();
+}
@@ -0,0 +1,47 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "metrics/metrics_exporter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+MetricsExporter::MetricsExporter(const std::string &file_path,
+                                 const MetricsFormat format,
+                                 const std::uint32_t period_generations)
+    : cFilePath(file_path), cFormat(format),
+      cPeriodGenerations(period_generations ? period_generations : 1),
+      last_exported_generation(0) {}
+
+bool MetricsExporter::OnGeneration(const GameMetrics &metrics) {
+  if (metrics.GetGenerationsCount() <
+      last_exported_generation + cPeriodGenerations) {
+    return false;
+  }
+  return Export(metrics);
+}
+
+bool MetricsExporter::Export(const GameMetrics &metrics) {
+  const std::string temporary_path = cFilePath + ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::trunc);
+    if (!stream) {
+      std::cerr << "Can't open metrics file " << temporary_path << std::endl;
+      return false;
+    }
+    if (cFormat == MetricsFormat::Json) {
+      metrics.WriteJson(stream);
+    } else {
+      metrics.WritePrometheus(stream);
+    }
+  }
+
+  if (std::rename(temporary_path.c_str(), cFilePath.c_str())) {
+    std::cerr << "Can't write metrics file " << cFilePath << std::endl;
+    return false;
+  }
+  last_exported_generation = metrics.GetGenerationsCount();
+  return true;
+}
@@ -0,0 +1,65 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "packed_grid.h"
+
+#include <algorithm>
+
+PackedGrid::PackedGrid() : rows(0), columns(0), words_per_row(0) {}
+
+PackedGrid::PackedGrid(const std::uint32_t rows, const std::uint32_t columns)
+    : rows(rows), columns(columns), words_per_row((columns + 63) / 64),
+      words(static_cast<std::size_t>(rows) * words_per_row, 0) {}
+
+std::uint32_t PackedGrid::GetRowCount() const { return rows; }
+
+std::uint32_t PackedGrid::GetColumnCount() const { return columns; }
+
+std::uint32_t PackedGrid::GetWordsPerRow() const { return words_per_row; }
+
+std::uint64_t PackedGrid::GetLastWordMask() const {
+  const std::uint32_t used_bits = columns % 64;
+  return used_bits ? (1ULL << used_bits) - 1 : ~0ULL;
+}
+
+bool PackedGrid::Get(const std::uint32_t row,
+                     const std::uint32_t column) const {
+  return (GetRow(row)[column / 64] >> (column % 64)) & 1;
+}
+
+void PackedGrid::Set(const std::uint32_t row, const std::uint32_t column,
+                     const bool is_alive) {
+  std::uint64_t &word = GetRow(row)[column / 64];
+  const std::uint64_t bit = 1ULL << (column % 64);
+  word = is_alive ? (word | bit) : (word & ~bit);
+}
+
+std::uint64_t *PackedGrid::GetRow(const std::uint32_t row) {
+  return words.data() + static_cast<std::size_t>(row) * words_per_row;
+}
+
+const std::uint64_t *PackedGrid::GetRow(const std::uint32_t row) const {
+  return words.data() + static_cast<std::size_t>(row) * words_per_row;
+}
+
+const std::uint64_t *PackedGrid::GetData() const { return words.data(); }
+
+void PackedGrid::Clear() { std::fill(words.begin(), words.end(), 0); }
+
+std::uint64_t PackedGrid::CountAlive() const {
+  std::uint64_t alive_cells = 0;
+  for (const auto word : words) {
+    alive_cells += __builtin_popcountll(word);
+  }
+  return alive_cells;
+}
+
+bool PackedGrid::operator==(const PackedGrid &other) const {
+  return rows == other.rows && columns == other.columns &&
+         words == other.words;
+}
+
+bool PackedGrid::operator!=(const PackedGrid &other) const {
+  return !(*this == other);
+}
@@ -0,0 +1,87 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "partition/row_partitioner.h"
+
+RowPartitioner::RowPartitioner(const std::uint32_t rows,
+                               const std::uint32_t parts_count)
+    : ranges(parts_count ? parts_count : 1), measured_costs(ranges.size(), 0),
+      row_costs(rows, 0), cRowsCount(rows) {
+  SplitEqually();
+}
+
+void RowPartitioner::SplitEqually() {
+  const std::uint32_t parts_count = ranges.size();
+  const std::uint32_t rows_per_part = cRowsCount / parts_count;
+  const std::uint32_t parts_with_extra_row = cRowsCount % parts_count;
+
+  std::uint32_t row = 0;
+  for (std::uint32_t part = 0; part < parts_count; part++) {
+    ranges[part].begin_row = row;
+    row += rows_per_part + (part < parts_with_extra_row ? 1 : 0);
+    ranges[part].end_row = row;
+  }
+}
+
+RowRange RowPartitioner::GetRange(const std::uint32_t part) const {
+  if (part >= ranges.size()) {
+    return {cRowsCount, cRowsCount};
+  }
+  return ranges[part];
+}
+
+std::uint32_t RowPartitioner::GetPartsCount() const { return ranges.size(); }
+
+void RowPartitioner::SetMeasuredCost(const std::uint32_t part,
+                                     const double cost) {
+  if (part < measured_costs.size()) {
+    measured_costs[part] = cost;
+  }
+}
+
+void RowPartitioner::Rebalance() {
+  for (std::uint32_t part = 0; part < ranges.size(); part++) {
+    const std::uint32_t rows_in_part =
+        ranges[part].end_row - ranges[part].begin_row;
+    if (rows_in_part == 0 || measured_costs[part] <= 0) {
+      continue;
+    }
+    const double row_cost = measured_costs[part] / rows_in_part;
+    for (std::uint32_t row = ranges[part].begin_row; row < ranges[part].end_row;
+         row++) {
+      row_costs[row] = row_costs[row] > 0 ? cCostSmoothing * row_cost +
+                                                (1 - cCostSmoothing) *
+                                                    row_costs[row]
+                                          : row_cost;
+    }
+    measured_costs[part] = 0;
+  }
+
+  double total_cost = 0;
+  for (const auto row_cost : row_costs) {
+    if (row_cost <= 0) {
+      // some rows were never measured, there is nothing to balance yet
+      return;
+    }
+    total_cost += row_cost;
+  }
+
+  const std::uint32_t parts_count = ranges.size();
+  std::uint32_t row = 0;
+  double accumulated_cost = 0;
+  for (std::uint32_t part = 0; part < parts_count; part++) {
+    ranges[part].begin_row = row;
+    if (part + 1 == parts_count) {
+      row = cRowsCount;
+    } else {
+      const double part_limit = total_cost * (part + 1) / parts_count;
+      while (row < cRowsCount &&
+             accumulated_cost + row_costs[row] / 2 < part_limit) {
+        accumulated_cost += row_costs[row];
+        row++;
+      }
+    }
+    ranges[part].end_row = row;
+  }
+}
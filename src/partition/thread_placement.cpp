@@ -0,0 +1,73 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "partition/thread_placement.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <utility>
+
+std::uint32_t ThreadPlacement::GetNodeOfCore(const std::uint32_t core) {
+  const std::string core_path =
+      "/sys/devices/system/cpu/cpu" + std::to_string(core);
+  DIR *core_directory = opendir(core_path.c_str());
+  if (!core_directory) {
+    return 0;
+  }
+
+  std::uint32_t node = 0;
+  while (struct dirent *entry = readdir(core_directory)) {
+    if (std::strncmp(entry->d_name, "node", 4) == 0 &&
+        entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+      node = std::strtoul(entry->d_name + 4, nullptr, 10);
+      break;
+    }
+  }
+  closedir(core_directory);
+  return node;
+}
+
+std::vector<std::uint32_t> ThreadPlacement::GetCoresOrderedByNode() {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set)) {
+    return {};
+  }
+
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> node_cores;
+  for (std::uint32_t core = 0; core < CPU_SETSIZE; core++) {
+    if (CPU_ISSET(core, &cpu_set)) {
+      node_cores.push_back(std::make_pair(GetNodeOfCore(core), core));
+    }
+  }
+  std::sort(node_cores.begin(), node_cores.end());
+
+  std::vector<std::uint32_t> cores;
+  for (const auto &node_core : node_cores) {
+    cores.push_back(node_core.second);
+  }
+  return cores;
+}
+
+bool ThreadPlacement::PinCurrentThread(const std::uint32_t thread_num) {
+  static const std::vector<std::uint32_t> cores = GetCoresOrderedByNode();
+  if (cores.empty()) {
+    return false;
+  }
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cores[thread_num % cores.size()], &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+    std::cerr << "Can't pin thread " << thread_num << std::endl;
+    return false;
+  }
+  return true;
+}
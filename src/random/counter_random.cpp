@@ -0,0 +1,79 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "random/counter_random.h"
+
+#include <cmath>
+
+constexpr std::uint32_t CounterRandom::cThresholdBits;
+constexpr std::uint64_t CounterRandom::cCountersPerWord;
+
+namespace {
+/// @brief finalizer of SplitMix64, every input bit changes about half of the
+/// output bits
+inline std::uint64_t Mix(std::uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
+constexpr std::uint64_t cGoldenGamma = 0x9E3779B97F4A7C15ULL;
+
+/// @brief return key of all words of the generation
+inline std::uint64_t GetKey(const std::uint64_t seed,
+                            const std::uint64_t generation) {
+  return Mix(seed + Mix(generation + cGoldenGamma));
+}
+
+inline std::uint64_t GetKeyWord(const std::uint64_t key,
+                                const std::uint64_t counter) {
+  return Mix(key + (counter + 1) * cGoldenGamma);
+}
+} // namespace
+
+std::uint64_t CounterRandom::GetWord(const std::uint64_t seed,
+                                     const std::uint64_t generation,
+                                     const std::uint64_t counter) {
+  return GetKeyWord(GetKey(seed, generation), counter);
+}
+
+std::uint64_t CounterRandom::GetThreshold(const double probability) {
+  if (!(probability > 0)) {
+    return 0;
+  }
+  if (probability >= 1) {
+    return 1ULL << cThresholdBits;
+  }
+  return static_cast<std::uint64_t>(
+      std::llround(std::ldexp(probability, cThresholdBits)));
+}
+
+std::uint64_t CounterRandom::GetBernoulliWord(const std::uint64_t seed,
+                                              const std::uint64_t generation,
+                                              const std::uint64_t counter,
+                                              const std::uint64_t threshold,
+                                              const std::uint64_t lanes) {
+  if (threshold >= (1ULL << cThresholdBits)) {
+    return lanes;
+  }
+  if (threshold == 0 || lanes == 0) {
+    return 0;
+  }
+
+  // lane is 1 if its random number is less than the threshold
+  const std::uint64_t key = GetKey(seed, generation);
+  std::uint64_t result = 0;
+  std::uint64_t undecided = lanes;
+  for (std::uint32_t bit = 0; bit < cThresholdBits && undecided; bit++) {
+    const std::uint64_t random =
+        GetKeyWord(key, counter * cCountersPerWord + bit);
+    if ((threshold >> (cThresholdBits - 1 - bit)) & 1) {
+      result |= undecided & ~random;
+      undecided &= random;
+    } else {
+      undecided &= ~random;
+    }
+  }
+  return result;
+}
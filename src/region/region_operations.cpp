@@ -0,0 +1,249 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "region/region_operations.h"
+
+#include <algorithm>
+
+namespace {
+constexpr std::uint32_t cWordBits = 64;
+
+/// @brief return value modulo size, always in [0, size)
+std::int64_t Wrap(const std::int64_t value, const std::int64_t size) {
+  const std::int64_t remainder = value % size;
+  return remainder < 0 ? remainder + size : remainder;
+}
+
+std::uint64_t Combine(const std::uint64_t current, const std::uint64_t value,
+                      const RegionOperation operation) {
+  switch (operation) {
+  case RegionOperation::Or:
+    return current | value;
+  case RegionOperation::And:
+    return current & value;
+  case RegionOperation::Xor:
+    return current ^ value;
+  case RegionOperation::Replace:
+  default:
+    return value;
+  }
+}
+
+std::uint64_t ReverseBits(std::uint64_t word) {
+  word = ((word >> 1) & 0x5555555555555555ULL) |
+         ((word & 0x5555555555555555ULL) << 1);
+  word = ((word >> 2) & 0x3333333333333333ULL) |
+         ((word & 0x3333333333333333ULL) << 2);
+  word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) |
+         ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  return __builtin_bswap64(word);
+}
+
+/// @brief transpose 64x64 cells, bit N of word M is swapped with bit M of
+/// word N by exchanging blocks of halving size
+void TransposeBlock(std::uint64_t *block) {
+  std::uint64_t mask = 0x00000000FFFFFFFFULL;
+  for (std::uint32_t width = 32; width != 0;
+       width >>= 1, mask ^= mask << width) {
+    for (std::uint32_t row = 0; row < cWordBits;
+         row = ((row | width) + 1) & ~width) {
+      const std::uint64_t swapped =
+          ((block[row] >> width) ^ block[row | width]) & mask;
+      block[row] ^= swapped << width;
+      block[row | width] ^= swapped;
+    }
+  }
+}
+
+/// @brief rotations and reflections are made of a transpose and then flips
+/// of rows and columns
+struct TransformSteps {
+  bool transpose;
+  bool flip_rows;
+  bool flip_columns;
+};
+
+TransformSteps GetTransformSteps(const PatternTransform transform) {
+  switch (transform) {
+  case PatternTransform::Rotate90:
+    return {true, false, true};
+  case PatternTransform::Rotate180:
+    return {false, true, true};
+  case PatternTransform::Rotate270:
+    return {true, true, false};
+  case PatternTransform::FlipHorizontal:
+    return {false, false, true};
+  case PatternTransform::FlipVertical:
+    return {false, true, false};
+  case PatternTransform::Transpose:
+    return {true, false, false};
+  case PatternTransform::AntiTranspose:
+    return {true, true, true};
+  case PatternTransform::Identity:
+  default:
+    return {false, false, false};
+  }
+}
+} // namespace
+
+void RegionOperations::Write(PackedGrid &grid, const PackedGrid &cells,
+                             const std::int64_t top_row,
+                             const std::int64_t left_column,
+                             const RegionOperation operation,
+                             const CellBordersRule borders_rule) {
+  const std::int64_t grid_rows = grid.GetRowCount();
+  const std::int64_t grid_columns = grid.GetColumnCount();
+  const std::int64_t columns = cells.GetColumnCount();
+  if (grid_rows == 0 || grid_columns == 0 || columns == 0) {
+    return;
+  }
+  const bool is_ring = borders_rule == CellBordersRule::RingBorders;
+
+  for (std::uint32_t row = 0; row < cells.GetRowCount(); row++) {
+    std::int64_t grid_row = top_row + row;
+    if (is_ring) {
+      grid_row = Wrap(grid_row, grid_rows);
+    } else if (grid_row < 0 || grid_row >= grid_rows) {
+      continue;
+    }
+    const std::uint64_t *source = cells.GetRow(row);
+    std::uint64_t *destination = grid.GetRow(grid_row);
+
+    // the row is written in segments of continuous grid columns, segments
+    // are split by ring borders
+    std::int64_t column = 0;
+    while (column < columns) {
+      std::int64_t grid_column = left_column + column;
+      std::int64_t length = columns - column;
+      if (is_ring) {
+        grid_column = Wrap(grid_column, grid_columns);
+      } else if (grid_column < 0) {
+        column += std::min<std::int64_t>(-grid_column, length);
+        continue;
+      } else if (grid_column >= grid_columns) {
+        break;
+      }
+      length = std::min(length, grid_columns - grid_column);
+      for (std::int64_t written = 0; written < length; written += cWordBits) {
+        const std::uint32_t chunk = static_cast<std::uint32_t>(
+            std::min<std::int64_t>(cWordBits, length - written));
+        std::uint64_t value =
+            RegionQuery::ReadBits(source, column + written, chunk);
+        if (operation != RegionOperation::Replace) {
+          value = Combine(
+              RegionQuery::ReadBits(destination, grid_column + written, chunk),
+              value, operation);
+        }
+        RegionQuery::WriteBits(destination, grid_column + written, value,
+                               chunk);
+      }
+      column += length;
+    }
+  }
+}
+
+void RegionOperations::Clear(PackedGrid &grid, const Region &region,
+                             const CellBordersRule borders_rule) {
+  Write(grid, PackedGrid(region.rows, region.columns), region.top_row,
+        region.left_column, RegionOperation::Replace, borders_rule);
+}
+
+void RegionOperations::Copy(const PackedGrid &source, const Region &region,
+                            PackedGrid &destination,
+                            const std::int64_t top_row,
+                            const std::int64_t left_column,
+                            const CellBordersRule borders_rule) {
+  Write(destination, RegionQuery::ReadCells(source, region, borders_rule),
+        top_row, left_column, RegionOperation::Replace, borders_rule);
+}
+
+void RegionOperations::Move(PackedGrid &grid, const Region &region,
+                            const std::int64_t top_row,
+                            const std::int64_t left_column,
+                            const CellBordersRule borders_rule) {
+  const PackedGrid cells = RegionQuery::ReadCells(grid, region, borders_rule);
+  Clear(grid, region, borders_rule);
+  Write(grid, cells, top_row, left_column, RegionOperation::Replace,
+        borders_rule);
+}
+
+void RegionOperations::TransformRegion(PackedGrid &grid, const Region &region,
+                                       const PatternTransform transform,
+                                       const CellBordersRule borders_rule) {
+  const PackedGrid cells = RegionQuery::ReadCells(grid, region, borders_rule);
+  Clear(grid, region, borders_rule);
+  Write(grid, Transform(cells, transform), region.top_row, region.left_column,
+        RegionOperation::Replace, borders_rule);
+}
+
+PackedGrid RegionOperations::Transform(const PackedGrid &cells,
+                                       const PatternTransform transform) {
+  const TransformSteps steps = GetTransformSteps(transform);
+  PackedGrid result = steps.transpose ? Transpose(cells) : cells;
+  if (steps.flip_rows) {
+    FlipRows(result);
+  }
+  if (steps.flip_columns) {
+    FlipColumns(result);
+  }
+  return result;
+}
+
+PackedGrid RegionOperations::Transpose(const PackedGrid &cells) {
+  const std::uint32_t rows = cells.GetRowCount();
+  const std::uint32_t columns = cells.GetColumnCount();
+  PackedGrid result(columns, rows);
+  std::uint64_t block[cWordBits];
+  for (std::uint32_t block_row = 0; block_row < rows; block_row += cWordBits) {
+    for (std::uint32_t word = 0; word < cells.GetWordsPerRow(); word++) {
+      // unused bits and rows after the last one are dead, so the transposed
+      // block has dead cells outside of the result
+      for (std::uint32_t row = 0; row < cWordBits; row++) {
+        block[row] =
+            block_row + row < rows ? cells.GetRow(block_row + row)[word] : 0;
+      }
+      TransposeBlock(block);
+      const std::uint32_t first_column = word * cWordBits;
+      const std::uint32_t last_column =
+          std::min(first_column + cWordBits, columns);
+      for (std::uint32_t column = first_column; column < last_column;
+           column++) {
+        result.GetRow(column)[block_row / cWordBits] =
+            block[column - first_column];
+      }
+    }
+  }
+  return result;
+}
+
+void RegionOperations::FlipRows(PackedGrid &cells) {
+  const std::uint32_t words_per_row = cells.GetWordsPerRow();
+  const std::uint32_t rows = cells.GetRowCount();
+  for (std::uint32_t row = 0; row < rows / 2; row++) {
+    std::swap_ranges(cells.GetRow(row), cells.GetRow(row) + words_per_row,
+                     cells.GetRow(rows - 1 - row));
+  }
+}
+
+void RegionOperations::FlipColumns(PackedGrid &cells) {
+  const std::uint32_t words_per_row = cells.GetWordsPerRow();
+  // bits of reversed words are moved to the start of the row by the count
+  // of unused bits of the last word
+  const std::uint32_t shift =
+      words_per_row * cWordBits - cells.GetColumnCount();
+  for (std::uint32_t row = 0; row < cells.GetRowCount(); row++) {
+    std::uint64_t *words = cells.GetRow(row);
+    std::reverse(words, words + words_per_row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      words[word] = ReverseBits(words[word]);
+    }
+    if (shift) {
+      for (std::uint32_t word = 0; word < words_per_row; word++) {
+        const std::uint64_t next =
+            word + 1 < words_per_row ? words[word + 1] : 0;
+        words[word] = (words[word] >> shift) | (next << (cWordBits - shift));
+      }
+    }
+  }
+}
@@ -0,0 +1,168 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "region/region_query.h"
+
+#include <algorithm>
+
+namespace {
+constexpr std::uint32_t cWordBits = 64;
+
+/// @brief return value modulo size, always in [0, size)
+std::int64_t Wrap(const std::int64_t value, const std::int64_t size) {
+  const std::int64_t remainder = value % size;
+  return remainder < 0 ? remainder + size : remainder;
+}
+
+/// @brief return mask of count lowest bits
+std::uint64_t GetLowMask(const std::uint32_t count) {
+  return count >= cWordBits ? ~0ULL : (1ULL << count) - 1;
+}
+
+/// @brief copy count cells of the grid row starting at column
+void CopyGridBits(const PackedGrid &grid, const std::uint32_t row,
+                  const std::uint32_t column, std::uint64_t *destination,
+                  const std::uint64_t destination_bit,
+                  const std::uint32_t count) {
+  RegionQuery::CopyBits(grid.GetRow(row), column, destination,
+                        destination_bit, count);
+}
+
+/// @brief copy count cells of the snapshot row starting at column
+void CopyGridBits(const WorldSnapshot &snapshot, const std::uint32_t row,
+                  const std::uint32_t column, std::uint64_t *destination,
+                  const std::uint64_t destination_bit,
+                  const std::uint32_t count) {
+  snapshot.CopyBits(row, column, destination, destination_bit, count);
+}
+
+/// @brief copy the region of rows of packed cells, Grid is PackedGrid or
+/// WorldSnapshot
+template <typename Grid>
+PackedGrid ReadGridCells(const Grid &grid, const Region &region,
+                         const CellBordersRule borders_rule) {
+  PackedGrid cells(region.rows, region.columns);
+  const std::int64_t grid_rows = grid.GetRowCount();
+  const std::int64_t grid_columns = grid.GetColumnCount();
+  if (grid_rows == 0 || grid_columns == 0 || region.columns == 0) {
+    return cells;
+  }
+  const bool is_ring = borders_rule == CellBordersRule::RingBorders;
+
+  for (std::uint32_t row = 0; row < region.rows; row++) {
+    std::int64_t grid_row = region.top_row + row;
+    if (is_ring) {
+      grid_row = Wrap(grid_row, grid_rows);
+    } else if (grid_row < 0 || grid_row >= grid_rows) {
+      continue;
+    }
+    std::uint64_t *destination = cells.GetRow(row);
+
+    // the region row is copied in segments of continuous grid columns,
+    // segments are split by ring borders
+    std::int64_t column = 0;
+    while (column < region.columns) {
+      std::int64_t grid_column = region.left_column + column;
+      std::int64_t length = region.columns - column;
+      if (is_ring) {
+        grid_column = Wrap(grid_column, grid_columns);
+      } else if (grid_column < 0) {
+        // dead cells before the left border
+        column += std::min<std::int64_t>(-grid_column, length);
+        continue;
+      } else if (grid_column >= grid_columns) {
+        break;
+      }
+      length = std::min(length, grid_columns - grid_column);
+      CopyGridBits(grid, grid_row, grid_column, destination, column, length);
+      column += length;
+    }
+  }
+  return cells;
+}
+} // namespace
+
+PackedGrid RegionQuery::ReadCells(const PackedGrid &grid, const Region &region,
+                                  const CellBordersRule borders_rule) {
+  return ReadGridCells(grid, region, borders_rule);
+}
+
+PackedGrid RegionQuery::ReadCells(const WorldSnapshot &snapshot,
+                                  const Region &region,
+                                  const CellBordersRule borders_rule) {
+  return ReadGridCells(snapshot, region, borders_rule);
+}
+
+std::vector<CellSpan>
+RegionQuery::ReadSpans(const PackedGrid &grid, const Region &region,
+                       const CellBordersRule borders_rule) {
+  return GetSpans(ReadCells(grid, region, borders_rule));
+}
+
+std::vector<CellSpan> RegionQuery::GetSpans(const PackedGrid &cells) {
+  std::vector<CellSpan> spans;
+  const std::uint32_t words_per_row = cells.GetWordsPerRow();
+  for (std::uint32_t row = 0; row < cells.GetRowCount(); row++) {
+    const std::uint64_t *words = cells.GetRow(row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      std::uint64_t bits = words[word];
+      while (bits) {
+        const std::uint32_t start = __builtin_ctzll(bits);
+        const std::uint64_t zeros = ~(bits >> start);
+        const std::uint32_t end =
+            zeros ? start + __builtin_ctzll(zeros) : cWordBits;
+        bits &= ~GetLowMask(end);
+
+        const std::uint32_t column = word * cWordBits + start;
+        // runs crossing word ends continue the previous span
+        if (start == 0 && !spans.empty() && spans.back().row == row &&
+            spans.back().column + spans.back().length == column) {
+          spans.back().length += end;
+        } else {
+          spans.push_back({row, column, end - start});
+        }
+      }
+    }
+  }
+  return spans;
+}
+
+std::uint64_t RegionQuery::ReadBits(const std::uint64_t *row,
+                                    const std::uint64_t bit,
+                                    const std::uint32_t count) {
+  const std::uint64_t word = bit / cWordBits;
+  const std::uint32_t offset = bit % cWordBits;
+  std::uint64_t value = row[word] >> offset;
+  if (offset + count > cWordBits) {
+    value |= row[word + 1] << (cWordBits - offset);
+  }
+  return value & GetLowMask(count);
+}
+
+void RegionQuery::WriteBits(std::uint64_t *row, const std::uint64_t bit,
+                            const std::uint64_t value,
+                            const std::uint32_t count) {
+  const std::uint64_t word = bit / cWordBits;
+  const std::uint32_t offset = bit % cWordBits;
+  const std::uint64_t mask = GetLowMask(count);
+  row[word] = (row[word] & ~(mask << offset)) | (value << offset);
+  if (offset + count > cWordBits) {
+    const std::uint32_t shift = cWordBits - offset;
+    row[word + 1] = (row[word + 1] & ~(mask >> shift)) | (value >> shift);
+  }
+}
+
+void RegionQuery::CopyBits(const std::uint64_t *source,
+                           const std::uint64_t source_bit,
+                           std::uint64_t *destination,
+                           const std::uint64_t destination_bit,
+                           const std::uint64_t count) {
+  for (std::uint64_t copied = 0; copied < count; copied += cWordBits) {
+    const std::uint32_t chunk =
+        static_cast<std::uint32_t>(std::min<std::uint64_t>(
+            cWordBits, count - copied));
+    WriteBits(destination, destination_bit + copied,
+              ReadBits(source, source_bit + copied, chunk), chunk);
+  }
+}
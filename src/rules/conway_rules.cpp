@@ -5,15 +5,28 @@
 #include "rules/conway_rules.h"
 
 bool ConwayRules::GetNewCellState(const Cell &cell) const {
-  if (cell.IsAlive()) {
-    return cSurvivalCount.find(cell.GetAliveNeighboursCount()) !=
-           cSurvivalCount.end();
+  return GetNewCellState(cell.IsAlive(), cell.GetAliveNeighboursCount());
+}
+
+bool ConwayRules::GetNewCellState(
+    const bool is_alive, const std::uint32_t alive_neighbours_count) const {
+  if (is_alive) {
+    return cSurvivalCount.find(alive_neighbours_count) != cSurvivalCount.end();
   } else {
-    return cRebirthCount.find(cell.GetAliveNeighboursCount()) !=
-           cRebirthCount.end();
+    return cRebirthCount.find(alive_neighbours_count) != cRebirthCount.end();
   }
 }
 
+bool ConwayRules::GetNewCellState(const std::uint32_t neighbourhood) const {
+  constexpr std::uint32_t cell_bit = 4;
+  return GetNewCellState((neighbourhood >> cell_bit) & 1,
+                         __builtin_popcount(neighbourhood & ~(1U << cell_bit)));
+}
+
+CellBordersRule ConwayRules::GetBordersRule() const { return borders_rule; }
+
+GridTopology ConwayRules::GetTopology() const { return GridTopology::Square; }
+
 void ConwayRules::GetCellIndex(std::int32_t &current_index,
                                const std::uint32_t &max_index) const {
   if (current_index < 0) {
@@ -21,14 +34,3 @@ void ConwayRules::GetCellIndex(std::int32_t &current_index,
   }
   current_index %= max_index;
 }
-
-bool ConwayRules::IsGameOver(const std::uint64_t &alive_cells_count,
-                             const std::uint32_t &equal_worlds_count,
-                             const std::uint32_t &generations_count) const {
-  if (alive_cells_count < cMinAliveCellsCount ||
-      equal_worlds_count > cMaxEqualWorldsCount ||
-      generations_count > cMaxGenerations) {
-    return true;
-  }
-  return false;
-}
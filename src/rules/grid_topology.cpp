@@ -0,0 +1,58 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "rules/grid_topology.h"
+
+namespace {
+const std::vector<NeighbourOffset> cSquareOffsets = {
+    {-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+
+// odd-r layout: even rows are shifted left of the rows around them
+const std::vector<NeighbourOffset> cHexagonalEvenRowOffsets = {
+    {-1, -1}, {-1, 0}, {0, -1}, {0, 1}, {1, -1}, {1, 0}};
+const std::vector<NeighbourOffset> cHexagonalOddRowOffsets = {
+    {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, 0}, {1, 1}};
+
+// the apex of an up triangle touches 3 cells of the row above, its base
+// touches 5 cells of the row below, down triangles are mirrored
+const std::vector<NeighbourOffset> cTriangularUpOffsets = {
+    {-1, -1}, {-1, 0}, {-1, 1}, {0, -2}, {0, -1}, {0, 1},
+    {0, 2},   {1, -2}, {1, -1}, {1, 0},  {1, 1},  {1, 2}};
+const std::vector<NeighbourOffset> cTriangularDownOffsets = {
+    {-1, -2}, {-1, -1}, {-1, 0}, {-1, 1}, {-1, 2}, {0, -2},
+    {0, -1},  {0, 1},   {0, 2},  {1, -1}, {1, 0},  {1, 1}};
+} // namespace
+
+const std::vector<NeighbourOffset> &
+GridNeighbourhood::GetOffsets(const GridTopology topology,
+                              const std::uint32_t row,
+                              const std::uint32_t column) {
+  switch (topology) {
+  case GridTopology::Hexagonal:
+    return (row % 2) ? cHexagonalOddRowOffsets : cHexagonalEvenRowOffsets;
+  case GridTopology::Triangular:
+    return ((row + column) % 2) ? cTriangularDownOffsets
+                                : cTriangularUpOffsets;
+  case GridTopology::Square:
+  default:
+    return cSquareOffsets;
+  }
+}
+
+std::uint32_t
+GridNeighbourhood::GetNeighboursCount(const GridTopology topology) {
+  return GetOffsets(topology, 0, 0).size();
+}
+
+const char *GridNeighbourhood::GetTopologyName(const GridTopology topology) {
+  switch (topology) {
+  case GridTopology::Hexagonal:
+    return "hexagonal";
+  case GridTopology::Triangular:
+    return "triangular";
+  case GridTopology::Square:
+  default:
+    return "square";
+  }
+}
@@ -0,0 +1,191 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "rules/isotropic_rules.h"
+
+#include <cctype>
+
+namespace {
+constexpr std::uint32_t cMaxNeighboursCount = 8;
+/// @brief bits of the 8 neighbours in the block index
+constexpr std::uint32_t cNeighboursMask =
+    0x1FF & ~(1U << NeighbourhoodRuleTable::cCellBit);
+
+/// @brief letters of arrangements of every count of neighbours, 5 to 7
+/// neighbours are the inverse of arrangements of 3 to 1 with the same letter
+const char *cLetters[cMaxNeighboursCount + 1] = {
+    "", "ce", "ceaikn", "ceaiknjqry", "ceaiknjqrytwz", "ceaiknjqry",
+    "ceaikn", "ce", ""};
+
+/// @brief one block of every arrangement of 1 to 4 neighbours, in order of
+/// the letters
+const std::uint32_t cArrangements[5][13] = {
+    {},
+    {1, 2},
+    {5, 10, 3, 40, 33, 68},
+    {69, 42, 11, 7, 98, 13, 14, 70, 41, 97},
+    {325, 170, 15, 45, 99, 71, 106, 102, 43, 101, 105, 78, 108}};
+
+/// @brief return block of the arrangement
+std::uint32_t GetArrangement(const std::uint32_t count,
+                             const std::uint32_t letter) {
+  if (count == 0 || count == cMaxNeighboursCount) {
+    return count ? cNeighboursMask : 0;
+  }
+  if (count > cMaxNeighboursCount / 2) {
+    return cArrangements[cMaxNeighboursCount - count][letter] ^
+           cNeighboursMask;
+  }
+  return cArrangements[count][letter];
+}
+
+/// @brief return block rotated by quarter turns and reflected
+std::uint32_t Transform(const std::uint32_t block,
+                        const std::uint32_t quarter_turns,
+                        const bool is_reflected) {
+  std::uint32_t result = 0;
+  for (std::uint32_t bit = 0; bit < 9; bit++) {
+    if (!((block >> bit) & 1)) {
+      continue;
+    }
+    std::uint32_t row = bit / 3;
+    std::uint32_t column = bit % 3;
+    for (std::uint32_t turn = 0; turn < quarter_turns; turn++) {
+      const std::uint32_t turned_row = column;
+      column = 2 - row;
+      row = turned_row;
+    }
+    if (is_reflected) {
+      column = 2 - column;
+    }
+    result |= 1U << (row * 3 + column);
+  }
+  return result;
+}
+
+/// @brief set next state of every rotation and reflection of the block
+void AddArrangement(const std::uint32_t block, const bool is_alive,
+                    std::bitset<512> &states) {
+  const std::uint32_t cell =
+      is_alive ? 1U << NeighbourhoodRuleTable::cCellBit : 0;
+  for (std::uint32_t quarter_turns = 0; quarter_turns < 4; quarter_turns++) {
+    states[Transform(block, quarter_turns, false) | cell] = true;
+    states[Transform(block, quarter_turns, true) | cell] = true;
+  }
+}
+} // namespace
+
+IsotropicRules::IsotropicRules(const std::bitset<512> &states,
+                               const CellBordersRule borders_rule)
+    : table(states, borders_rule), borders_rule(borders_rule) {}
+
+bool IsotropicRules::ParseRule(const std::string &rule,
+                               std::bitset<512> &states) {
+  const std::size_t separator = rule.find('/');
+  if (separator == std::string::npos) {
+    return false;
+  }
+
+  std::bitset<512> parsed_states;
+  bool is_parsed[2] = {false, false};
+  const std::string parts[2] = {rule.substr(0, separator),
+                                rule.substr(separator + 1)};
+  for (const auto &part : parts) {
+    if (part.empty()) {
+      return false;
+    }
+    const char prefix = std::toupper(static_cast<unsigned char>(part[0]));
+    if (prefix != 'B' && prefix != 'S') {
+      return false;
+    }
+    const bool is_alive = prefix == 'S';
+    if (is_parsed[is_alive]) {
+      return false;
+    }
+    is_parsed[is_alive] = true;
+
+    std::size_t position = 1;
+    while (position < part.size()) {
+      const char digit = part[position++];
+      if (digit < '0' || digit > '8') {
+        return false;
+      }
+      const std::uint32_t count = digit - '0';
+      const bool is_excluded = position < part.size() && part[position] == '-';
+      if (is_excluded) {
+        position++;
+      }
+      std::string letters;
+      while (position < part.size() &&
+             std::isalpha(static_cast<unsigned char>(part[position]))) {
+        letters += std::tolower(static_cast<unsigned char>(part[position++]));
+      }
+
+      const std::string count_letters = cLetters[count];
+      if (is_excluded && letters.empty()) {
+        return false;
+      }
+      for (const char letter : letters) {
+        if (count_letters.find(letter) == std::string::npos) {
+          return false;
+        }
+      }
+      if (count_letters.empty()) {
+        AddArrangement(GetArrangement(count, 0), is_alive, parsed_states);
+        continue;
+      }
+      for (std::uint32_t letter = 0; letter < count_letters.size(); letter++) {
+        const bool is_listed =
+            letters.find(count_letters[letter]) != std::string::npos;
+        if (letters.empty() || is_listed != is_excluded) {
+          AddArrangement(GetArrangement(count, letter), is_alive,
+                         parsed_states);
+        }
+      }
+    }
+  }
+
+  states = parsed_states;
+  return true;
+}
+
+bool IsotropicRules::GetNewCellState(const Cell &cell) const {
+  return GetNewCellState(cell.IsAlive(), cell.GetAliveNeighboursCount());
+}
+
+bool IsotropicRules::GetNewCellState(
+    const bool is_alive, const std::uint32_t alive_neighbours_count) const {
+  if (alive_neighbours_count > cMaxNeighboursCount) {
+    return false;
+  }
+  const std::uint32_t cell =
+      is_alive ? 1U << NeighbourhoodRuleTable::cCellBit : 0;
+  for (std::uint32_t block = 0; block <= cNeighboursMask; block++) {
+    if ((block & cNeighboursMask) == block &&
+        static_cast<std::uint32_t>(__builtin_popcount(block)) ==
+            alive_neighbours_count &&
+        !table.GetNewCellState(block | cell)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsotropicRules::GetNewCellState(const std::uint32_t neighbourhood) const {
+  return table.GetNewCellState(neighbourhood);
+}
+
+CellBordersRule IsotropicRules::GetBordersRule() const { return borders_rule; }
+
+GridTopology IsotropicRules::GetTopology() const {
+  return GridTopology::Square;
+}
+
+void IsotropicRules::GetCellIndex(std::int32_t &current_index,
+                                  const std::uint32_t &max_index) const {
+  if (current_index < 0) {
+    current_index += max_index;
+  }
+  current_index %= max_index;
+}
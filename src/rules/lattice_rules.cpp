@@ -0,0 +1,99 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "rules/lattice_rules.h"
+
+#include <cctype>
+
+namespace {
+/// @brief return count of neighbours written as the digit, -1 if it is not
+/// a count
+std::int32_t GetDigitCount(const char digit) {
+  if (std::isdigit(static_cast<unsigned char>(digit))) {
+    return digit - '0';
+  }
+  const char lower = std::tolower(static_cast<unsigned char>(digit));
+  if (lower >= 'a' && lower <= 'c') {
+    return 10 + lower - 'a';
+  }
+  return -1;
+}
+} // namespace
+
+LatticeRules::LatticeRules(const GridTopology topology,
+                           const std::uint32_t birth_mask,
+                           const std::uint32_t survival_mask,
+                           const CellBordersRule borders_rule)
+    : topology(topology), birth_mask(birth_mask), survival_mask(survival_mask),
+      borders_rule(borders_rule) {}
+
+bool LatticeRules::ParseRule(const std::string &rule,
+                             std::uint32_t &birth_mask,
+                             std::uint32_t &survival_mask) {
+  const std::size_t separator = rule.find('/');
+  if (separator == std::string::npos) {
+    return false;
+  }
+
+  std::uint32_t masks[2] = {0, 0};
+  bool is_parsed[2] = {false, false};
+  const std::string parts[2] = {rule.substr(0, separator),
+                                rule.substr(separator + 1)};
+  for (const auto &part : parts) {
+    if (part.empty()) {
+      return false;
+    }
+    const char prefix = std::toupper(static_cast<unsigned char>(part[0]));
+    if (prefix != 'B' && prefix != 'S') {
+      return false;
+    }
+    const std::uint32_t index = prefix == 'B' ? 0 : 1;
+    if (is_parsed[index]) {
+      return false;
+    }
+    is_parsed[index] = true;
+    for (std::size_t position = 1; position < part.size(); position++) {
+      const std::int32_t count = GetDigitCount(part[position]);
+      if (count < 0) {
+        return false;
+      }
+      masks[index] |= 1U << count;
+    }
+  }
+
+  birth_mask = masks[0];
+  survival_mask = masks[1];
+  return true;
+}
+
+bool LatticeRules::GetNewCellState(const Cell &cell) const {
+  return GetNewCellState(cell.IsAlive(), cell.GetAliveNeighboursCount());
+}
+
+bool LatticeRules::GetNewCellState(
+    const bool is_alive, const std::uint32_t alive_neighbours_count) const {
+  if (alive_neighbours_count >= 32) {
+    return false;
+  }
+  return ((is_alive ? survival_mask : birth_mask) >> alive_neighbours_count) &
+         1;
+}
+
+bool LatticeRules::GetNewCellState(const std::uint32_t neighbourhood) const {
+  constexpr std::uint32_t cell_bit = 4;
+  return GetNewCellState((neighbourhood >> cell_bit) & 1,
+                         __builtin_popcount(neighbourhood & ~(1U << cell_bit)));
+}
+
+CellBordersRule LatticeRules::GetBordersRule() const { return borders_rule; }
+
+GridTopology LatticeRules::GetTopology() const { return topology; }
+
+void LatticeRules::GetCellIndex(std::int32_t &current_index,
+                                const std::uint32_t &max_index) const {
+  if (current_index < 0) {
+    current_index += max_index;
+  }
+  current_index %= max_index;
+}
@@ -0,0 +1,73 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "rules/neighbourhood_table.h"
+
+constexpr std::uint32_t NeighbourhoodRuleTable::cTableSize;
+constexpr std::uint32_t NeighbourhoodRuleTable::cCellBit;
+
+namespace {
+std::uint32_t GetNeighboursCount(const std::uint32_t neighbourhood) {
+  return __builtin_popcount(neighbourhood &
+                            ~(1U << NeighbourhoodRuleTable::cCellBit));
+}
+
+bool IsCellAlive(const std::uint32_t neighbourhood) {
+  return (neighbourhood >> NeighbourhoodRuleTable::cCellBit) & 1;
+}
+} // namespace
+
+NeighbourhoodRuleTable::NeighbourhoodRuleTable(const GameRules &rules)
+    : borders_rule(rules.GetBordersRule()) {
+  for (std::uint32_t neighbourhood = 0; neighbourhood < cTableSize;
+       neighbourhood++) {
+    states[neighbourhood] = rules.GetNewCellState(neighbourhood);
+  }
+}
+
+NeighbourhoodRuleTable::NeighbourhoodRuleTable(
+    const TotalisticRuleTable &rule_table)
+    : borders_rule(rule_table.GetBordersRule()) {
+  for (std::uint32_t neighbourhood = 0; neighbourhood < cTableSize;
+       neighbourhood++) {
+    states[neighbourhood] = rule_table.GetNewCellState(
+        IsCellAlive(neighbourhood), GetNeighboursCount(neighbourhood));
+  }
+}
+
+NeighbourhoodRuleTable::NeighbourhoodRuleTable(
+    const std::bitset<512> &states, const CellBordersRule borders_rule)
+    : states(states), borders_rule(borders_rule) {}
+
+bool NeighbourhoodRuleTable::GetNewCellState(
+    const std::uint32_t neighbourhood) const {
+  return states[neighbourhood % cTableSize];
+}
+
+CellBordersRule NeighbourhoodRuleTable::GetBordersRule() const {
+  return borders_rule;
+}
+
+bool NeighbourhoodRuleTable::IsTotalistic() const {
+  // the first block of every cell state and count is compared with others
+  constexpr std::uint32_t max_neighbours_count = 8;
+  std::int32_t count_states[2][max_neighbours_count + 1];
+  for (auto &cell_states : count_states) {
+    for (auto &count_state : cell_states) {
+      count_state = -1;
+    }
+  }
+
+  for (std::uint32_t neighbourhood = 0; neighbourhood < cTableSize;
+       neighbourhood++) {
+    std::int32_t &count_state = count_states[IsCellAlive(neighbourhood)]
+                                            [GetNeighboursCount(neighbourhood)];
+    if (count_state < 0) {
+      count_state = states[neighbourhood];
+    } else if (count_state != states[neighbourhood]) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,49 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "rules/rule_table.h"
+
+constexpr std::uint32_t TotalisticRuleTable::cMaxNeighboursCount;
+
+TotalisticRuleTable::TotalisticRuleTable(const GameRules &rules)
+    : birth_mask(0), survival_mask(0), borders_rule(rules.GetBordersRule()),
+      topology(rules.GetTopology()) {
+  for (std::uint32_t neighbours = 0; neighbours <= cMaxNeighboursCount;
+       neighbours++) {
+    if (rules.GetNewCellState(false, neighbours)) {
+      birth_mask |= 1U << neighbours;
+    }
+    if (rules.GetNewCellState(true, neighbours)) {
+      survival_mask |= 1U << neighbours;
+    }
+  }
+}
+
+TotalisticRuleTable::TotalisticRuleTable(const std::uint32_t birth_mask,
+                                         const std::uint32_t survival_mask,
+                                         const CellBordersRule borders_rule,
+                                         const GridTopology topology)
+    : birth_mask(birth_mask), survival_mask(survival_mask),
+      borders_rule(borders_rule), topology(topology) {}
+
+std::uint32_t TotalisticRuleTable::GetBirthMask() const { return birth_mask; }
+
+std::uint32_t TotalisticRuleTable::GetSurvivalMask() const {
+  return survival_mask;
+}
+
+CellBordersRule TotalisticRuleTable::GetBordersRule() const {
+  return borders_rule;
+}
+
+GridTopology TotalisticRuleTable::GetTopology() const { return topology; }
+
+bool TotalisticRuleTable::GetNewCellState(
+    const bool is_alive, const std::uint32_t alive_neighbours_count) const {
+  if (alive_neighbours_count > cMaxNeighboursCount) {
+    return false;
+  }
+  return ((is_alive ? survival_mask : birth_mask) >> alive_neighbours_count) &
+         1;
+}
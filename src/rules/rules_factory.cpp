@@ -4,7 +4,57 @@
 ///
 #include "rules/rules_factory.h"
 #include "rules/conway_rules.h"
+#include "rules/isotropic_rules.h"
+#include "rules/lattice_rules.h"
+
+#include <iostream>
+
+namespace {
+const char *GetDefaultRule(const GridTopology topology) {
+  switch (topology) {
+  case GridTopology::Hexagonal:
+    return "B2/S34";
+  case GridTopology::Triangular:
+    return "B4/S345";
+  case GridTopology::Square:
+  default:
+    return "B3/S23";
+  }
+}
+} // namespace
 
 std::unique_ptr<GameRules> GameRulesFactory::MakeGameRules() {
   return std::unique_ptr<GameRules>(new ConwayRules());
 }
+
+std::unique_ptr<GameRules>
+GameRulesFactory::MakeGameRules(const GridTopology topology,
+                                const std::string &rule) {
+  // rules of square cells could depend on the arrangement of neighbours
+  std::bitset<512> states;
+  if (topology == GridTopology::Square && !rule.empty() &&
+      IsotropicRules::ParseRule(rule, states) &&
+      !NeighbourhoodRuleTable(states, CellBordersRule::RingBorders)
+           .IsTotalistic()) {
+    return std::unique_ptr<GameRules>(new IsotropicRules(states));
+  }
+
+  std::uint32_t birth_mask = 0;
+  std::uint32_t survival_mask = 0;
+  if (!rule.empty() &&
+      !LatticeRules::ParseRule(rule, birth_mask, survival_mask)) {
+    std::cerr << "Can't parse rule " << rule << ", using default rule"
+              << std::endl;
+  } else if (!rule.empty()) {
+    return std::unique_ptr<GameRules>(
+        new LatticeRules(topology, birth_mask, survival_mask));
+  }
+
+  if (topology == GridTopology::Square) {
+    return MakeGameRules();
+  }
+  LatticeRules::ParseRule(GetDefaultRule(topology), birth_mask,
+                          survival_mask);
+  return std::unique_ptr<GameRules>(
+      new LatticeRules(topology, birth_mask, survival_mask));
+}
@@ -0,0 +1,249 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "snapshot/world_snapshot.h"
+#include "region/region_query.h"
+
+#include <algorithm>
+#include <thread>
+
+constexpr std::uint32_t WorldSnapshot::cTileRows;
+constexpr std::uint32_t WorldSnapshot::cTileWords;
+constexpr std::uint32_t SnapshotPublisher::cReaderSlotsCount;
+
+WorldSnapshot::WorldSnapshot(const std::uint32_t generation,
+                             const StatisticsSummary &summary,
+                             const PackedGrid &cells)
+    : WorldSnapshot(generation, summary, cells, nullptr,
+                    std::vector<bool>()) {}
+
+WorldSnapshot::WorldSnapshot(const std::uint32_t generation,
+                             const StatisticsSummary &summary,
+                             const PackedGrid &cells,
+                             const WorldSnapshot *previous,
+                             const std::vector<bool> &changed_tiles)
+    : generation(generation), summary(summary), rows(cells.GetRowCount()),
+      columns(cells.GetColumnCount()), words_per_row(cells.GetWordsPerRow()),
+      tile_rows((rows + cTileRows - 1) / cTileRows),
+      tile_columns((words_per_row + cTileWords - 1) / cTileWords) {
+  tiles.reserve(static_cast<std::size_t>(tile_rows) * tile_columns);
+  for (std::uint32_t tile_row = 0; tile_row < tile_rows; tile_row++) {
+    const std::uint32_t first_row = tile_row * cTileRows;
+    const std::uint32_t last_row = std::min(first_row + cTileRows, rows);
+    for (std::uint32_t tile_column = 0; tile_column < tile_columns;
+         tile_column++) {
+      if (previous && !changed_tiles[tiles.size()]) {
+        tiles.push_back(previous->tiles[tiles.size()]);
+        continue;
+      }
+      const std::uint32_t tile_words = GetTileWords(tile_column);
+      std::vector<std::uint64_t> tile;
+      tile.reserve(static_cast<std::size_t>(last_row - first_row) *
+                   tile_words);
+      for (std::uint32_t row = first_row; row < last_row; row++) {
+        const std::uint64_t *begin =
+            cells.GetRow(row) + tile_column * cTileWords;
+        tile.insert(tile.end(), begin, begin + tile_words);
+      }
+      tiles.push_back(
+          std::make_shared<const std::vector<std::uint64_t>>(std::move(tile)));
+    }
+  }
+}
+
+std::uint32_t WorldSnapshot::GetGeneration() const { return generation; }
+
+const StatisticsSummary &WorldSnapshot::GetSummary() const { return summary; }
+
+std::uint32_t WorldSnapshot::GetRowCount() const { return rows; }
+
+std::uint32_t WorldSnapshot::GetColumnCount() const { return columns; }
+
+bool WorldSnapshot::Get(const std::uint32_t row,
+                        const std::uint32_t column) const {
+  if (row >= rows || column >= columns) {
+    return false;
+  }
+  const std::uint32_t word = column / 64;
+  return (GetTileRow(row, word / cTileWords)[word % cTileWords] >>
+          (column % 64)) &
+         1;
+}
+
+void WorldSnapshot::CopyBits(const std::uint32_t row,
+                             const std::uint32_t column,
+                             std::uint64_t *destination,
+                             const std::uint64_t destination_bit,
+                             const std::uint32_t count) const {
+  const std::uint32_t tile_bits = cTileWords * 64;
+  std::uint32_t copied = 0;
+  while (copied < count) {
+    const std::uint32_t source_column = column + copied;
+    const std::uint32_t tile_column = source_column / tile_bits;
+    const std::uint32_t tile_bit = source_column % tile_bits;
+    // bits are copied by parts which do not cross tiles
+    const std::uint32_t length = std::min(count - copied, tile_bits - tile_bit);
+    RegionQuery::CopyBits(GetTileRow(row, tile_column), tile_bit, destination,
+                          destination_bit + copied, length);
+    copied += length;
+  }
+}
+
+std::uint32_t WorldSnapshot::GetTileRowsCount() const { return tile_rows; }
+
+std::uint32_t WorldSnapshot::GetTileColumnsCount() const {
+  return tile_columns;
+}
+
+const std::uint64_t *
+WorldSnapshot::GetTile(const std::uint32_t tile_row,
+                       const std::uint32_t tile_column) const {
+  return tiles[tile_row * tile_columns + tile_column]->data();
+}
+
+PackedGrid WorldSnapshot::ToPackedGrid() const {
+  PackedGrid cells(rows, columns);
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t tile_column = 0; tile_column < tile_columns;
+         tile_column++) {
+      const std::uint64_t *begin = GetTileRow(row, tile_column);
+      std::copy(begin, begin + GetTileWords(tile_column),
+                cells.GetRow(row) + tile_column * cTileWords);
+    }
+  }
+  return cells;
+}
+
+std::uint32_t
+WorldSnapshot::GetTileWords(const std::uint32_t tile_column) const {
+  return std::min(cTileWords, words_per_row - tile_column * cTileWords);
+}
+
+const std::uint64_t *
+WorldSnapshot::GetTileRow(const std::uint32_t row,
+                          const std::uint32_t tile_column) const {
+  return tiles[(row / cTileRows) * tile_columns + tile_column]->data() +
+         static_cast<std::size_t>(row % cTileRows) * GetTileWords(tile_column);
+}
+
+SnapshotGuard::SnapshotGuard() : reader_epoch(nullptr), snapshot(nullptr) {}
+
+SnapshotGuard::SnapshotGuard(std::atomic<std::uint64_t> *reader_epoch,
+                             const WorldSnapshot *snapshot)
+    : reader_epoch(reader_epoch), snapshot(snapshot) {}
+
+SnapshotGuard::SnapshotGuard(SnapshotGuard &&other)
+    : reader_epoch(other.reader_epoch), snapshot(other.snapshot) {
+  other.reader_epoch = nullptr;
+  other.snapshot = nullptr;
+}
+
+SnapshotGuard::~SnapshotGuard() {
+  if (reader_epoch) {
+    reader_epoch->store(0, std::memory_order_release);
+  }
+}
+
+const WorldSnapshot *SnapshotGuard::Get() const { return snapshot; }
+
+const WorldSnapshot &SnapshotGuard::operator*() const { return *snapshot; }
+
+const WorldSnapshot *SnapshotGuard::operator->() const { return snapshot; }
+
+SnapshotPublisher::SnapshotPublisher(WorldStatistics &statistics)
+    : current(nullptr), epoch(1), slots(cReaderSlotsCount),
+      changes_reader(statistics.AddChangedTilesReader()) {
+  for (ReaderSlot &slot : slots) {
+    slot.epoch.store(0);
+  }
+}
+
+SnapshotPublisher::~SnapshotPublisher() { delete current.load(); }
+
+void SnapshotPublisher::Publish(const std::uint32_t generation,
+                                const PackedGrid &cells,
+                                WorldStatistics &statistics) {
+  // only the publisher replaces the current snapshot, so it could be read
+  // without a guard here
+  const WorldSnapshot *previous = current.load(std::memory_order_relaxed);
+  if (previous && (previous->rows != cells.GetRowCount() ||
+                   previous->columns != cells.GetColumnCount())) {
+    previous = nullptr;
+  }
+  std::vector<bool> changed_tiles;
+  const std::vector<std::uint32_t> changed_statistics_tiles =
+      statistics.TakeChangedTiles(changes_reader);
+  if (previous) {
+    changed_tiles.resize(previous->tiles.size());
+    const std::uint32_t tile_size = statistics.GetTileSize();
+    const std::uint32_t tile_bits = WorldSnapshot::cTileWords * 64;
+    for (const std::uint32_t tile : changed_statistics_tiles) {
+      // cells of the statistics tile are copied with all snapshot tiles
+      // which overlap it
+      const std::uint32_t first_row =
+          tile / statistics.GetTileColumnsCount() * tile_size;
+      const std::uint32_t first_column =
+          tile % statistics.GetTileColumnsCount() * tile_size;
+      const std::uint32_t last_row =
+          std::min(first_row + tile_size, previous->rows) - 1;
+      const std::uint32_t last_column =
+          std::min(first_column + tile_size, previous->columns) - 1;
+      for (std::uint32_t tile_row = first_row / WorldSnapshot::cTileRows;
+           tile_row <= last_row / WorldSnapshot::cTileRows; tile_row++) {
+        for (std::uint32_t tile_column = first_column / tile_bits;
+             tile_column <= last_column / tile_bits; tile_column++) {
+          changed_tiles[tile_row * previous->tile_columns + tile_column] =
+              true;
+        }
+      }
+    }
+  }
+  const WorldSnapshot *snapshot =
+      new WorldSnapshot(generation, statistics.GetSummary(), cells, previous,
+                        changed_tiles);
+  previous = current.exchange(snapshot);
+  if (previous) {
+    // readers which took the previous snapshot have epoch of the exchange
+    // or older, readers of later epochs see the new one
+    retired.push_back({std::unique_ptr<const WorldSnapshot>(previous),
+                       epoch.fetch_add(1)});
+  }
+  FreeRetired();
+}
+
+SnapshotGuard SnapshotPublisher::Read() const {
+  while (true) {
+    const std::uint64_t reader_epoch = epoch.load();
+    for (ReaderSlot &slot : slots) {
+      std::uint64_t free_epoch = 0;
+      // the epoch is visible to the publisher before the snapshot is taken,
+      // so the publisher can't free a snapshot the reader could take
+      if (slot.epoch.load(std::memory_order_relaxed) == 0 &&
+          slot.epoch.compare_exchange_strong(free_epoch, reader_epoch)) {
+        return SnapshotGuard(&slot.epoch, current.load());
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+std::size_t SnapshotPublisher::GetRetiredCount() const {
+  return retired.size();
+}
+
+void SnapshotPublisher::FreeRetired() {
+  std::uint64_t oldest_epoch = epoch.load();
+  for (const ReaderSlot &slot : slots) {
+    const std::uint64_t reader_epoch = slot.epoch.load();
+    if (reader_epoch) {
+      oldest_epoch = std::min(oldest_epoch, reader_epoch);
+    }
+  }
+  const auto in_use =
+      std::find_if(retired.begin(), retired.end(),
+                   [oldest_epoch](const RetiredSnapshot &snapshot) {
+                     return snapshot.epoch >= oldest_epoch;
+                   });
+  retired.erase(retired.begin(), in_use);
+}
@@ -0,0 +1,121 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "statistics/population_pyramid.h"
+
+PopulationPyramid::PopulationPyramid(WorldStatistics &statistics)
+    : cTileSize(statistics.GetTileSize()) {
+  std::uint32_t rows = statistics.GetTileRowsCount();
+  std::uint32_t columns = statistics.GetTileColumnsCount();
+  levels.push_back(
+      {rows, columns,
+       std::vector<std::uint64_t>(static_cast<std::size_t>(rows) * columns)});
+  while (rows > 1 || columns > 1) {
+    rows = (rows + 1) / 2;
+    columns = (columns + 1) / 2;
+    levels.push_back({rows, columns,
+                      std::vector<std::uint64_t>(
+                          static_cast<std::size_t>(rows) * columns)});
+  }
+
+  // changes before the pyramid are already in the tiles
+  changes_reader = statistics.AddChangedTilesReader();
+  for (std::uint32_t tile_row = 0; tile_row < levels[0].rows; tile_row++) {
+    for (std::uint32_t tile_column = 0; tile_column < levels[0].columns;
+         tile_column++) {
+      SetTilePopulation(tile_row, tile_column,
+                        statistics.GetTile(tile_row, tile_column).population);
+    }
+  }
+}
+
+void PopulationPyramid::Update(WorldStatistics &statistics) {
+  const std::uint32_t tile_columns = levels[0].columns;
+  for (const std::uint32_t tile :
+       statistics.TakeChangedTiles(changes_reader)) {
+    const std::uint32_t tile_row = tile / tile_columns;
+    const std::uint32_t tile_column = tile % tile_columns;
+    SetTilePopulation(tile_row, tile_column,
+                      statistics.GetTile(tile_row, tile_column).population);
+  }
+}
+
+void PopulationPyramid::SetTilePopulation(const std::uint32_t tile_row,
+                                          const std::uint32_t tile_column,
+                                          const std::uint64_t population) {
+  const std::size_t tile =
+      static_cast<std::size_t>(tile_row) * levels[0].columns + tile_column;
+  // populations are unsigned, the difference wraps around and is added
+  // back correctly
+  const std::uint64_t difference = population - levels[0].populations[tile];
+  if (!difference) {
+    return;
+  }
+  for (std::uint32_t level = 0; level < levels.size(); level++) {
+    Level &blocks = levels[level];
+    blocks.populations[static_cast<std::size_t>(tile_row >> level) *
+                           blocks.columns +
+                       (tile_column >> level)] += difference;
+  }
+}
+
+std::uint32_t PopulationPyramid::GetLevelsCount() const {
+  return levels.size();
+}
+
+std::uint32_t
+PopulationPyramid::GetBlockSize(const std::uint32_t level) const {
+  return cTileSize << level;
+}
+
+std::uint32_t PopulationPyramid::GetRowCount(const std::uint32_t level) const {
+  return level < levels.size() ? levels[level].rows : 0;
+}
+
+std::uint32_t
+PopulationPyramid::GetColumnCount(const std::uint32_t level) const {
+  return level < levels.size() ? levels[level].columns : 0;
+}
+
+std::uint64_t PopulationPyramid::Get(const std::uint32_t level,
+                                     const std::uint32_t row,
+                                     const std::uint32_t column) const {
+  if (level >= levels.size() || row >= levels[level].rows ||
+      column >= levels[level].columns) {
+    return 0;
+  }
+  return levels[level]
+      .populations[static_cast<std::size_t>(row) * levels[level].columns +
+                   column];
+}
+
+std::vector<std::uint64_t>
+PopulationPyramid::ReadBlocks(const std::uint32_t level,
+                              const std::uint32_t top_row,
+                              const std::uint32_t left_column,
+                              const std::uint32_t rows,
+                              const std::uint32_t columns) const {
+  std::vector<std::uint64_t> blocks(static_cast<std::size_t>(rows) * columns,
+                                    0);
+  if (level >= levels.size()) {
+    return blocks;
+  }
+  const Level &source = levels[level];
+  for (std::uint32_t row = 0; row < rows; row++) {
+    const std::uint64_t source_row = static_cast<std::uint64_t>(top_row) + row;
+    if (source_row >= source.rows) {
+      break;
+    }
+    for (std::uint32_t column = 0; column < columns; column++) {
+      const std::uint64_t source_column =
+          static_cast<std::uint64_t>(left_column) + column;
+      if (source_column >= source.columns) {
+        break;
+      }
+      blocks[static_cast<std::size_t>(row) * columns + column] =
+          source.populations[source_row * source.columns + source_column];
+    }
+  }
+  return blocks;
+}
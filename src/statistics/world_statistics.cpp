@@ -0,0 +1,266 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "statistics/world_statistics.h"
+
+#include <algorithm>
+
+constexpr std::uint32_t WorldStatistics::cDefaultTileSize;
+
+WorldStatistics::TileCounters::TileCounters()
+    : population(0), births(0), deaths(0), row_sum(0), column_sum(0) {}
+
+WorldStatistics::WorldStatistics(const std::uint32_t rows,
+                                 const std::uint32_t columns,
+                                 const std::uint32_t tile_size)
+    : cRowsCount(rows), cColumnsCount(columns),
+      cTileSize(tile_size ? tile_size : cDefaultTileSize),
+      cTileRowsCount((rows + cTileSize - 1) / cTileSize),
+      cTileColumnsCount((columns + cTileSize - 1) / cTileSize),
+      tiles(static_cast<std::size_t>(cTileRowsCount) * cTileColumnsCount),
+      changed_tiles((tiles.size() + 63) / 64),
+      row_population(rows),
+      column_population(static_cast<std::size_t>(cTileRowsCount) * columns) {
+}
+
+WorldStatistics::TileCounters &
+WorldStatistics::GetTileCounters(const std::uint32_t row,
+                                 const std::uint32_t column) {
+  return tiles[static_cast<std::size_t>(row / cTileSize) * cTileColumnsCount +
+               column / cTileSize];
+}
+
+void WorldStatistics::MarkTileChanged(const std::uint32_t row,
+                                      const std::uint32_t column) {
+  const std::size_t tile =
+      static_cast<std::size_t>(row / cTileSize) * cTileColumnsCount +
+      column / cTileSize;
+  const std::uint64_t bit = 1ULL << (tile % 64);
+  std::atomic<std::uint64_t> &word = changed_tiles[tile / 64];
+  // most changes are in tiles which are already marked, a load keeps the
+  // cache line shared between threads
+  if (!(word.load(std::memory_order_relaxed) & bit)) {
+    word.fetch_or(bit, std::memory_order_relaxed);
+  }
+}
+
+void WorldStatistics::AddBirth(const std::uint32_t row,
+                               const std::uint32_t column) {
+  MarkTileChanged(row, column);
+  TileCounters &tile = GetTileCounters(row, column);
+  tile.population.fetch_add(1, std::memory_order_relaxed);
+  tile.births.fetch_add(1, std::memory_order_relaxed);
+  tile.row_sum.fetch_add(row, std::memory_order_relaxed);
+  tile.column_sum.fetch_add(column, std::memory_order_relaxed);
+  row_population[row].fetch_add(1, std::memory_order_relaxed);
+  column_population[static_cast<std::size_t>(row / cTileSize) *
+                        cColumnsCount +
+                    column]
+      .fetch_add(1, std::memory_order_relaxed);
+}
+
+void WorldStatistics::AddDeath(const std::uint32_t row,
+                               const std::uint32_t column) {
+  MarkTileChanged(row, column);
+  TileCounters &tile = GetTileCounters(row, column);
+  tile.population.fetch_sub(1, std::memory_order_relaxed);
+  tile.deaths.fetch_add(1, std::memory_order_relaxed);
+  tile.row_sum.fetch_sub(row, std::memory_order_relaxed);
+  tile.column_sum.fetch_sub(column, std::memory_order_relaxed);
+  row_population[row].fetch_sub(1, std::memory_order_relaxed);
+  column_population[static_cast<std::size_t>(row / cTileSize) *
+                        cColumnsCount +
+                    column]
+      .fetch_sub(1, std::memory_order_relaxed);
+}
+
+void WorldStatistics::StartGeneration() {
+  for (auto &tile : tiles) {
+    tile.births.store(0, std::memory_order_relaxed);
+    tile.deaths.store(0, std::memory_order_relaxed);
+  }
+}
+
+bool WorldStatistics::FindOccupiedTiles(const bool by_rows,
+                                        std::uint32_t &first_tile,
+                                        std::uint32_t &last_tile) const {
+  const std::uint32_t outer_count =
+      by_rows ? cTileRowsCount : cTileColumnsCount;
+  const std::uint32_t inner_count =
+      by_rows ? cTileColumnsCount : cTileRowsCount;
+  bool found = false;
+  for (std::uint32_t outer = 0; outer < outer_count; outer++) {
+    for (std::uint32_t inner = 0; inner < inner_count; inner++) {
+      const std::size_t index =
+          by_rows ? static_cast<std::size_t>(outer) * cTileColumnsCount + inner
+                  : static_cast<std::size_t>(inner) * cTileColumnsCount +
+                        outer;
+      if (tiles[index].population.load(std::memory_order_relaxed)) {
+        if (!found) {
+          first_tile = outer;
+          found = true;
+        }
+        last_tile = outer;
+        break;
+      }
+    }
+  }
+  return found;
+}
+
+bool WorldStatistics::IsLineOccupied(const bool by_rows,
+                                     const std::uint32_t line) const {
+  if (by_rows) {
+    return row_population[line].load(std::memory_order_relaxed);
+  }
+  for (std::uint32_t tile_row = 0; tile_row < cTileRowsCount; tile_row++) {
+    if (column_population[static_cast<std::size_t>(tile_row) * cColumnsCount +
+                          line]
+            .load(std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorldStatistics::FindOccupiedLines(const bool by_rows,
+                                        const std::uint32_t first_tile,
+                                        const std::uint32_t last_tile,
+                                        std::uint32_t &first_line,
+                                        std::uint32_t &last_line) const {
+  const std::uint32_t lines_count = by_rows ? cRowsCount : cColumnsCount;
+  first_line = first_tile * cTileSize;
+  const std::uint32_t first_end =
+      std::min(lines_count, (first_tile + 1) * cTileSize);
+  while (first_line + 1 < first_end && !IsLineOccupied(by_rows, first_line)) {
+    first_line++;
+  }
+
+  last_line = std::min(lines_count, (last_tile + 1) * cTileSize) - 1;
+  const std::uint32_t last_begin = last_tile * cTileSize;
+  while (last_line > last_begin && !IsLineOccupied(by_rows, last_line)) {
+    last_line--;
+  }
+}
+
+StatisticsSummary WorldStatistics::GetSummary() const {
+  StatisticsSummary summary{};
+  std::uint64_t row_sum = 0, column_sum = 0;
+  for (const auto &tile : tiles) {
+    summary.population += tile.population.load(std::memory_order_relaxed);
+    summary.births += tile.births.load(std::memory_order_relaxed);
+    summary.deaths += tile.deaths.load(std::memory_order_relaxed);
+    row_sum += tile.row_sum.load(std::memory_order_relaxed);
+    column_sum += tile.column_sum.load(std::memory_order_relaxed);
+  }
+  if (summary.population == 0) {
+    return summary;
+  }
+
+  summary.centroid_row = static_cast<double>(row_sum) / summary.population;
+  summary.centroid_column =
+      static_cast<double>(column_sum) / summary.population;
+
+  std::uint32_t first_tile = 0, last_tile = 0;
+  if (FindOccupiedTiles(true, first_tile, last_tile)) {
+    FindOccupiedLines(true, first_tile, last_tile,
+                      summary.bounding_box.top_row,
+                      summary.bounding_box.bottom_row);
+  }
+  if (FindOccupiedTiles(false, first_tile, last_tile)) {
+    FindOccupiedLines(false, first_tile, last_tile,
+                      summary.bounding_box.left_column,
+                      summary.bounding_box.right_column);
+  }
+  return summary;
+}
+
+TileStatistics WorldStatistics::GetTile(const std::uint32_t tile_row,
+                                        const std::uint32_t tile_column) const {
+  if (tile_row >= cTileRowsCount || tile_column >= cTileColumnsCount) {
+    return TileStatistics{};
+  }
+  const TileCounters &tile =
+      tiles[static_cast<std::size_t>(tile_row) * cTileColumnsCount +
+            tile_column];
+  return TileStatistics{tile.population.load(std::memory_order_relaxed),
+                        tile.births.load(std::memory_order_relaxed),
+                        tile.deaths.load(std::memory_order_relaxed)};
+}
+
+std::uint32_t WorldStatistics::GetTileRowsCount() const {
+  return cTileRowsCount;
+}
+
+std::uint32_t WorldStatistics::GetTileColumnsCount() const {
+  return cTileColumnsCount;
+}
+
+std::uint32_t WorldStatistics::GetTileSize() const { return cTileSize; }
+
+void WorldStatistics::WriteJson(std::ostream &stream) const {
+  const StatisticsSummary summary = GetSummary();
+  stream << "{\"population\":" << summary.population
+         << ",\"births\":" << summary.births
+         << ",\"deaths\":" << summary.deaths;
+  if (summary.population) {
+    stream << ",\"bounding_box\":[" << summary.bounding_box.top_row << ","
+           << summary.bounding_box.left_column << ","
+           << summary.bounding_box.bottom_row << ","
+           << summary.bounding_box.right_column << "]"
+           << ",\"centroid\":[" << summary.centroid_row << ","
+           << summary.centroid_column << "]";
+  }
+  stream << ",\"tile_size\":" << cTileSize << ",\"tiles\":[";
+  for (std::uint32_t tile_row = 0; tile_row < cTileRowsCount; tile_row++) {
+    stream << (tile_row ? "," : "") << "[";
+    for (std::uint32_t tile_column = 0; tile_column < cTileColumnsCount;
+         tile_column++) {
+      stream << (tile_column ? "," : "")
+             << GetTile(tile_row, tile_column).population;
+    }
+    stream << "]";
+  }
+  stream << "]}";
+}
+
+std::uint32_t WorldStatistics::AddChangedTilesReader() {
+  // earlier changes belong to the readers which are already added
+  CollectChangedTiles();
+  reader_changed_tiles.emplace_back(changed_tiles.size(), 0);
+  return reader_changed_tiles.size() - 1;
+}
+
+void WorldStatistics::CollectChangedTiles() {
+  for (std::size_t word = 0; word < changed_tiles.size(); word++) {
+    if (!changed_tiles[word].load(std::memory_order_relaxed)) {
+      continue;
+    }
+    const std::uint64_t bits =
+        changed_tiles[word].exchange(0, std::memory_order_relaxed);
+    for (auto &reader_bits : reader_changed_tiles) {
+      reader_bits[word] |= bits;
+    }
+  }
+}
+
+std::vector<std::uint32_t>
+WorldStatistics::TakeChangedTiles(const std::uint32_t reader) {
+  std::vector<std::uint32_t> changed;
+  if (reader >= reader_changed_tiles.size()) {
+    return changed;
+  }
+  CollectChangedTiles();
+  std::vector<std::uint64_t> &reader_bits = reader_changed_tiles[reader];
+  for (std::size_t word = 0; word < reader_bits.size(); word++) {
+    std::uint64_t bits = reader_bits[word];
+    reader_bits[word] = 0;
+    while (bits) {
+      changed.push_back(static_cast<std::uint32_t>(
+          word * 64 + __builtin_ctzll(bits)));
+      bits &= bits - 1;
+    }
+  }
+  return changed;
+}
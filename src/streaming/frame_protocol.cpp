@@ -0,0 +1,88 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "streaming/frame_protocol.h"
+#include "history/zero_run_codec.h"
+
+#include <algorithm>
+
+constexpr std::uint32_t FrameCodec::cTileRows;
+constexpr std::uint32_t FrameCodec::cTileWords;
+
+std::uint32_t FrameCodec::GetTileRowsCount(const PackedGrid &cells) {
+  return (cells.GetRowCount() + cTileRows - 1) / cTileRows;
+}
+
+std::uint32_t FrameCodec::GetTileColumnsCount(const PackedGrid &cells) {
+  return (cells.GetWordsPerRow() + cTileWords - 1) / cTileWords;
+}
+
+bool FrameCodec::EncodeTile(const PackedGrid &cells, const PackedGrid *previous,
+                            const std::uint32_t tile_row,
+                            const std::uint32_t tile_column,
+                            std::vector<std::uint8_t> &data) {
+  data.clear();
+  const std::uint32_t first_row = tile_row * cTileRows;
+  const std::uint32_t end_row =
+      std::min(first_row + cTileRows, cells.GetRowCount());
+  const std::uint32_t first_word = tile_column * cTileWords;
+  const std::uint32_t end_word =
+      std::min(first_word + cTileWords, cells.GetWordsPerRow());
+
+  std::uint64_t words[cTileRows * cTileWords];
+  std::size_t count = 0;
+  std::uint64_t any_bits = 0;
+  for (std::uint32_t row = first_row; row < end_row; row++) {
+    const std::uint64_t *cells_row = cells.GetRow(row);
+    const std::uint64_t *previous_row =
+        previous ? previous->GetRow(row) : nullptr;
+    for (std::uint32_t word = first_word; word < end_word; word++) {
+      words[count] = cells_row[word] ^ (previous_row ? previous_row[word] : 0);
+      any_bits |= words[count++];
+    }
+  }
+  if (!any_bits) {
+    return false;
+  }
+  ZeroRunCodec::Encode(words, count, data);
+  return true;
+}
+
+bool FrameCodec::DecodeTile(const std::vector<std::uint8_t> &data,
+                            const std::uint32_t tile_row,
+                            const std::uint32_t tile_column,
+                            PackedGrid &cells) {
+  if (tile_row >= GetTileRowsCount(cells) ||
+      tile_column >= GetTileColumnsCount(cells)) {
+    return false;
+  }
+  const std::uint32_t first_row = tile_row * cTileRows;
+  const std::uint32_t end_row =
+      std::min(first_row + cTileRows, cells.GetRowCount());
+  const std::uint32_t first_word = tile_column * cTileWords;
+  const std::uint32_t end_word =
+      std::min(first_word + cTileWords, cells.GetWordsPerRow());
+
+  std::uint64_t words[cTileRows * cTileWords] = {};
+  const std::size_t words_per_row = end_word - first_word;
+  if (!ZeroRunCodec::DecodeXor(data, words,
+                               (end_row - first_row) * words_per_row)) {
+    return false;
+  }
+  std::size_t index = 0;
+  for (std::uint32_t row = first_row; row < end_row; row++) {
+    std::uint64_t *cells_row = cells.GetRow(row);
+    for (std::uint32_t word = first_word; word < end_word; word++) {
+      cells_row[word] ^= words[index++];
+    }
+  }
+  // bits after the last column must stay 0
+  const std::uint32_t last_word = cells.GetWordsPerRow() - 1;
+  if (end_word - 1 == last_word) {
+    for (std::uint32_t row = first_row; row < end_row; row++) {
+      cells.GetRow(row)[last_word] &= cells.GetLastWordMask();
+    }
+  }
+  return true;
+}
@@ -0,0 +1,404 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "streaming/frame_server.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace {
+/// @brief maximum count of connections waiting for accept
+constexpr int cListenBacklog = 16;
+
+/// @brief append bytes of value to data
+template <typename T>
+void AppendBytes(std::vector<std::uint8_t> &data, const T &value) {
+  const std::uint8_t *bytes = reinterpret_cast<const std::uint8_t *>(&value);
+  data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+/// @brief return first and end tile of a viewport range
+void GetTileRange(const std::uint32_t first, const std::uint32_t size,
+                  const std::uint32_t world_size,
+                  const std::uint32_t tile_size,
+                  const std::uint32_t tiles_count, std::uint32_t &first_tile,
+                  std::uint32_t &end_tile) {
+  if (first >= world_size) {
+    first_tile = end_tile = 0;
+    return;
+  }
+  const std::uint32_t last =
+      size ? std::min(world_size, first + size) - 1 : world_size - 1;
+  first_tile = first / tile_size;
+  end_tile = std::min(tiles_count, last / tile_size + 1);
+}
+} // namespace
+
+FrameServerSettings::FrameServerSettings() : slow_subscriber_timeout(2000) {}
+
+FrameServer::FrameServer(const std::string &socket_path,
+                         const FrameServerSettings &settings)
+    : cSocketPath(socket_path), settings(settings), listen_socket(-1),
+      wake_pipe{-1, -1}, is_running(false), published_generation(0),
+      subscribers_count(0), current() {}
+
+FrameServer::~FrameServer() { Stop(); }
+
+bool FrameServer::Start() {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (cSocketPath.empty() || cSocketPath.size() >= sizeof(address.sun_path)) {
+    std::cerr << "Incorrect socket path " << cSocketPath << std::endl;
+    return false;
+  }
+  std::strncpy(address.sun_path, cSocketPath.c_str(),
+               sizeof(address.sun_path) - 1);
+
+  listen_socket =
+      socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listen_socket < 0) {
+    std::cerr << "Can't create socket: " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  unlink(cSocketPath.c_str());
+  if (bind(listen_socket, reinterpret_cast<const sockaddr *>(&address),
+           sizeof(address)) ||
+      listen(listen_socket, cListenBacklog) ||
+      pipe2(wake_pipe, O_NONBLOCK | O_CLOEXEC)) {
+    std::cerr << "Can't listen on " << cSocketPath << ": "
+              << std::strerror(errno) << std::endl;
+    close(listen_socket);
+    listen_socket = -1;
+    return false;
+  }
+
+  is_running = true;
+  thread = std::thread(&FrameServer::RunThread, this);
+  return true;
+}
+
+void FrameServer::Stop() {
+  if (!is_running.exchange(false)) {
+    return;
+  }
+  Wake();
+  thread.join();
+  for (auto &subscriber : subscribers) {
+    close(subscriber.socket);
+  }
+  subscribers.clear();
+  subscribers_count = 0;
+  close(listen_socket);
+  close(wake_pipe[0]);
+  close(wake_pipe[1]);
+  listen_socket = wake_pipe[0] = wake_pipe[1] = -1;
+  unlink(cSocketPath.c_str());
+}
+
+void FrameServer::Publish(const std::uint32_t generation,
+                          const PackedGrid &cells) {
+  if (!subscribers_count.load()) {
+    return;
+  }
+  std::shared_ptr<const PackedGrid> copy(new PackedGrid(cells));
+  {
+    std::lock_guard<std::mutex> lock(published_mutex);
+    published.swap(copy);
+    published_generation = generation;
+  }
+  Wake();
+}
+
+std::size_t FrameServer::GetSubscribersCount() const {
+  return subscribers_count.load();
+}
+
+void FrameServer::RunThread() {
+  std::vector<pollfd> descriptors;
+  while (is_running) {
+    descriptors.clear();
+    descriptors.push_back({wake_pipe[0], POLLIN, 0});
+    descriptors.push_back({listen_socket, POLLIN, 0});
+    for (const auto &subscriber : subscribers) {
+      const bool has_output = subscriber.output_sent < subscriber.output.size();
+      descriptors.push_back(
+          {subscriber.socket,
+           static_cast<short>(POLLIN | (has_output ? POLLOUT : 0)), 0});
+    }
+
+    if (poll(descriptors.data(), descriptors.size(),
+             GetPollTimeout(std::chrono::steady_clock::now())) < 0 &&
+        errno != EINTR) {
+      std::cerr << "Frame server poll failed: " << std::strerror(errno)
+                << std::endl;
+      break;
+    }
+
+    if (descriptors[0].revents & POLLIN) {
+      char buffer[64];
+      while (read(wake_pipe[0], buffer, sizeof(buffer)) > 0) {
+      }
+    }
+    for (std::size_t index = 0; index < subscribers.size(); index++) {
+      const short events = descriptors[index + 2].revents;
+      if (events & (POLLIN | POLLHUP | POLLERR)) {
+        ReadSubscriber(subscribers[index]);
+      }
+    }
+    if (descriptors[1].revents & POLLIN) {
+      AcceptSubscribers();
+    }
+
+    TakePublished();
+    SendFrames(std::chrono::steady_clock::now());
+
+    const auto disconnected =
+        std::remove_if(subscribers.begin(), subscribers.end(),
+                       [](const Subscriber &subscriber) {
+                         if (!subscriber.is_connected) {
+                           close(subscriber.socket);
+                         }
+                         return !subscriber.is_connected;
+                       });
+    subscribers.erase(disconnected, subscribers.end());
+    subscribers_count = subscribers.size();
+  }
+}
+
+void FrameServer::AcceptSubscribers() {
+  while (true) {
+    const int socket =
+        accept4(listen_socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (socket < 0) {
+      return;
+    }
+    Subscriber subscriber{};
+    subscriber.socket = socket;
+    subscriber.is_connected = true;
+    subscribers.push_back(std::move(subscriber));
+  }
+}
+
+void FrameServer::ReadSubscriber(Subscriber &subscriber) {
+  std::uint8_t buffer[256];
+  while (true) {
+    const ssize_t received = recv(subscriber.socket, buffer, sizeof(buffer), 0);
+    if (received == 0 ||
+        (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+      subscriber.is_connected = false;
+      return;
+    }
+    if (received < 0) {
+      return;
+    }
+    if (subscriber.is_subscribed) {
+      // nothing is expected after the request
+      continue;
+    }
+
+    const std::size_t needed =
+        sizeof(SubscribeRequest) - subscriber.request_bytes.size();
+    subscriber.request_bytes.insert(
+        subscriber.request_bytes.end(), buffer,
+        buffer + std::min<std::size_t>(needed, received));
+    if (subscriber.request_bytes.size() == sizeof(SubscribeRequest)) {
+      std::memcpy(&subscriber.request, subscriber.request_bytes.data(),
+                  sizeof(SubscribeRequest));
+      if (subscriber.request.magic != cSubscribeMagic) {
+        std::cerr << "Incorrect subscription request" << std::endl;
+        subscriber.is_connected = false;
+        return;
+      }
+      subscriber.is_subscribed = true;
+    }
+  }
+}
+
+void FrameServer::TakePublished() {
+  std::shared_ptr<const PackedGrid> cells;
+  std::uint32_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(published_mutex);
+    if (!published) {
+      return;
+    }
+    cells.swap(published);
+    generation = published_generation;
+  }
+
+  EncodedFrame frame;
+  frame.sequence = current.sequence + 1;
+  frame.generation = generation;
+  frame.has_delta = current.cells &&
+                    current.cells->GetRowCount() == cells->GetRowCount() &&
+                    current.cells->GetColumnCount() == cells->GetColumnCount();
+  const std::size_t tiles_count =
+      static_cast<std::size_t>(FrameCodec::GetTileRowsCount(*cells)) *
+      FrameCodec::GetTileColumnsCount(*cells);
+  frame.delta_tiles.resize(tiles_count);
+  frame.keyframe_tiles.resize(tiles_count);
+  frame.is_keyframe_tile_encoded.assign(tiles_count, false);
+  if (frame.has_delta) {
+    const std::uint32_t tile_columns = FrameCodec::GetTileColumnsCount(*cells);
+    for (std::size_t tile = 0; tile < tiles_count; tile++) {
+      FrameCodec::EncodeTile(*cells, current.cells.get(), tile / tile_columns,
+                             tile % tile_columns, frame.delta_tiles[tile]);
+    }
+  }
+  frame.cells = std::move(cells);
+  current = std::move(frame);
+}
+
+void FrameServer::SendFrames(const std::chrono::steady_clock::time_point now) {
+  for (auto &subscriber : subscribers) {
+    if (!subscriber.is_connected || !subscriber.is_subscribed) {
+      continue;
+    }
+    if (subscriber.output_sent < subscriber.output.size()) {
+      Flush(subscriber);
+      if (subscriber.output_sent < subscriber.output.size() &&
+          now - subscriber.output_time > settings.slow_subscriber_timeout) {
+        std::cerr << "Frame subscriber is too slow, disconnecting"
+                  << std::endl;
+        subscriber.is_connected = false;
+      }
+      continue;
+    }
+    if (!current.cells || (subscriber.has_frame &&
+                           subscriber.frame_sequence == current.sequence)) {
+      continue;
+    }
+    if (subscriber.has_frame &&
+        now - subscriber.frame_time < GetFrameInterval(subscriber)) {
+      continue;
+    }
+
+    const bool is_delta = subscriber.has_frame && current.has_delta &&
+                          subscriber.frame_sequence + 1 == current.sequence;
+    QueueFrame(subscriber, is_delta);
+    subscriber.has_frame = true;
+    subscriber.frame_sequence = current.sequence;
+    subscriber.frame_time = subscriber.output_time = now;
+    Flush(subscriber);
+  }
+}
+
+void FrameServer::QueueFrame(Subscriber &subscriber, const bool is_delta) {
+  const PackedGrid &cells = *current.cells;
+  const SubscribeRequest &request = subscriber.request;
+  const std::uint32_t tile_columns = FrameCodec::GetTileColumnsCount(cells);
+  std::uint32_t first_tile_row, end_tile_row, first_tile_column,
+      end_tile_column;
+  GetTileRange(request.top_row, request.rows, cells.GetRowCount(),
+               FrameCodec::cTileRows, FrameCodec::GetTileRowsCount(cells),
+               first_tile_row, end_tile_row);
+  GetTileRange(request.left_column, request.columns, cells.GetColumnCount(),
+               FrameCodec::cTileWords * 64, tile_columns, first_tile_column,
+               end_tile_column);
+
+  subscriber.output.clear();
+  subscriber.output_sent = 0;
+  FrameHeader header{cFrameMagic,
+                     static_cast<std::uint32_t>(is_delta ? FrameType::Delta
+                                                         : FrameType::Keyframe),
+                     current.generation,
+                     cells.GetRowCount(),
+                     cells.GetColumnCount(),
+                     0};
+  AppendBytes(subscriber.output, header);
+
+  for (std::uint32_t tile_row = first_tile_row; tile_row < end_tile_row;
+       tile_row++) {
+    for (std::uint32_t tile_column = first_tile_column;
+         tile_column < end_tile_column; tile_column++) {
+      const std::size_t tile =
+          static_cast<std::size_t>(tile_row) * tile_columns + tile_column;
+      if (!is_delta && !current.is_keyframe_tile_encoded[tile]) {
+        FrameCodec::EncodeTile(cells, nullptr, tile_row, tile_column,
+                               current.keyframe_tiles[tile]);
+        current.is_keyframe_tile_encoded[tile] = true;
+      }
+      const std::vector<std::uint8_t> &data =
+          is_delta ? current.delta_tiles[tile] : current.keyframe_tiles[tile];
+      if (data.empty()) {
+        continue;
+      }
+      AppendBytes(subscriber.output,
+                  TileHeader{tile_row, tile_column,
+                             static_cast<std::uint32_t>(data.size())});
+      subscriber.output.insert(subscriber.output.end(), data.begin(),
+                               data.end());
+      header.tiles_count++;
+    }
+  }
+  std::memcpy(subscriber.output.data(), &header, sizeof(header));
+}
+
+void FrameServer::Flush(Subscriber &subscriber) {
+  while (subscriber.output_sent < subscriber.output.size()) {
+    const ssize_t sent = send(
+        subscriber.socket, subscriber.output.data() + subscriber.output_sent,
+        subscriber.output.size() - subscriber.output_sent,
+        MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (sent < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        subscriber.is_connected = false;
+      }
+      return;
+    }
+    subscriber.output_sent += sent;
+  }
+}
+
+int FrameServer::GetPollTimeout(
+    const std::chrono::steady_clock::time_point now) const {
+  auto timeout = std::chrono::steady_clock::duration::max();
+  for (const auto &subscriber : subscribers) {
+    if (!subscriber.is_subscribed) {
+      continue;
+    }
+    if (subscriber.output_sent < subscriber.output.size()) {
+      timeout = std::min(timeout, subscriber.output_time +
+                                      settings.slow_subscriber_timeout - now);
+    } else if (current.cells && subscriber.has_frame &&
+               subscriber.frame_sequence != current.sequence) {
+      timeout = std::min(
+          timeout, subscriber.frame_time + GetFrameInterval(subscriber) - now);
+    }
+  }
+  if (timeout == std::chrono::steady_clock::duration::max()) {
+    return -1;
+  }
+  // round up, so the frame interval is elapsed after the wait
+  const auto milliseconds =
+      std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count() +
+      1;
+  return static_cast<int>(std::max<std::int64_t>(0, milliseconds));
+}
+
+std::chrono::steady_clock::duration
+FrameServer::GetFrameInterval(const Subscriber &subscriber) {
+  if (!subscriber.request.max_fps) {
+    return std::chrono::steady_clock::duration::zero();
+  }
+  return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+             std::chrono::seconds(1)) /
+         subscriber.request.max_fps;
+}
+
+void FrameServer::Wake() {
+  const char signal = 0;
+  if (write(wake_pipe[1], &signal, sizeof(signal)) < 0 && errno != EAGAIN) {
+    std::cerr << "Can't wake frame server: " << std::strerror(errno)
+              << std::endl;
+  }
+}
@@ -0,0 +1,131 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "streaming/frame_subscriber.h"
+#include "region/region_query.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+FrameSubscriber::FrameSubscriber() : socket_fd(-1), request{} {}
+
+FrameSubscriber::~FrameSubscriber() {
+  if (socket_fd >= 0) {
+    close(socket_fd);
+  }
+}
+
+bool FrameSubscriber::Connect(const std::string &socket_path,
+                              SubscribeRequest request) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path)) {
+    std::cerr << "Incorrect socket path " << socket_path << std::endl;
+    return false;
+  }
+  std::strncpy(address.sun_path, socket_path.c_str(),
+               sizeof(address.sun_path) - 1);
+
+  socket_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  request.magic = cSubscribeMagic;
+  if (socket_fd < 0 ||
+      connect(socket_fd, reinterpret_cast<const sockaddr *>(&address),
+              sizeof(address)) ||
+      send(socket_fd, &request, sizeof(request), MSG_NOSIGNAL) !=
+          sizeof(request)) {
+    std::cerr << "Can't subscribe to " << socket_path << ": "
+              << std::strerror(errno) << std::endl;
+    if (socket_fd >= 0) {
+      close(socket_fd);
+      socket_fd = -1;
+    }
+    return false;
+  }
+  this->request = request;
+  return true;
+}
+
+bool FrameSubscriber::ReceiveFrame(const std::chrono::milliseconds timeout,
+                                   StreamFrame &frame) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  FrameHeader header;
+  if (!Read(&header, sizeof(header), deadline) || header.magic != cFrameMagic) {
+    return false;
+  }
+  const bool is_keyframe =
+      header.type == static_cast<std::uint32_t>(FrameType::Keyframe);
+  if (world.GetRowCount() != header.world_rows ||
+      world.GetColumnCount() != header.world_columns) {
+    if (!is_keyframe) {
+      return false;
+    }
+    world = PackedGrid(header.world_rows, header.world_columns);
+  } else if (is_keyframe) {
+    world.Clear();
+  }
+
+  for (std::uint32_t tile = 0; tile < header.tiles_count; tile++) {
+    TileHeader tile_header;
+    if (!Read(&tile_header, sizeof(tile_header), deadline)) {
+      return false;
+    }
+    tile_data.resize(tile_header.bytes);
+    if (!Read(tile_data.data(), tile_data.size(), deadline) ||
+        !FrameCodec::DecodeTile(tile_data, tile_header.tile_row,
+                                tile_header.tile_column, world)) {
+      return false;
+    }
+  }
+
+  const std::uint32_t rows =
+      request.rows ? request.rows
+                   : world.GetRowCount() -
+                         std::min(request.top_row, world.GetRowCount());
+  const std::uint32_t columns =
+      request.columns ? request.columns
+                      : world.GetColumnCount() -
+                            std::min(request.left_column,
+                                     world.GetColumnCount());
+  frame.generation = header.generation;
+  frame.is_keyframe = is_keyframe;
+  frame.cells = RegionQuery::ReadCells(
+      world, Region{request.top_row, request.left_column, rows, columns},
+      CellBordersRule::LimitedBorders);
+  return true;
+}
+
+bool FrameSubscriber::Read(
+    void *buffer, const std::size_t size,
+    const std::chrono::steady_clock::time_point deadline) {
+  if (socket_fd < 0) {
+    return false;
+  }
+  std::uint8_t *bytes = static_cast<std::uint8_t *>(buffer);
+  std::size_t received = 0;
+  while (received < size) {
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+            .count();
+    pollfd descriptor{socket_fd, POLLIN, 0};
+    if (remaining <= 0 ||
+        poll(&descriptor, 1, static_cast<int>(remaining)) <= 0) {
+      return false;
+    }
+    const ssize_t result =
+        recv(socket_fd, bytes + received, size - received, 0);
+    if (result <= 0) {
+      return false;
+    }
+    received += result;
+  }
+  return true;
+}
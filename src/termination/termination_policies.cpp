@@ -0,0 +1,204 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "termination/termination_policies.h"
+
+#include <algorithm>
+#include <limits>
+
+const char *GetTerminationReasonName(const TerminationReason reason) {
+  switch (reason) {
+  case TerminationReason::Extinct:
+    return "extinct";
+  case TerminationReason::Repeated:
+    return "repeated";
+  case TerminationReason::GenerationLimit:
+    return "generation_limit";
+  case TerminationReason::TimeBudget:
+    return "time_budget";
+  case TerminationReason::PopulationPlateau:
+    return "population_plateau";
+  case TerminationReason::UnboundedGrowth:
+    return "unbounded_growth";
+  case TerminationReason::BoundingBoxStable:
+    return "bounding_box_stable";
+  case TerminationReason::None:
+  default:
+    return "none";
+  }
+}
+
+std::uint32_t TerminationPolicy::GetStride(const std::uint32_t) const {
+  return 1;
+}
+
+ExtinctionPolicy::ExtinctionPolicy(const std::uint64_t min_alive_cells_count)
+    : cMinAliveCellsCount(min_alive_cells_count) {}
+
+void ExtinctionPolicy::Reset() {}
+
+TerminationReason
+ExtinctionPolicy::Update(const TerminationCounters &counters) {
+  return counters.summary.population < cMinAliveCellsCount
+             ? TerminationReason::Extinct
+             : TerminationReason::None;
+}
+
+RepetitionPolicy::RepetitionPolicy(const std::uint32_t max_equal_worlds_count)
+    : cMaxEqualWorldsCount(max_equal_worlds_count) {}
+
+void RepetitionPolicy::Reset() {}
+
+TerminationReason
+RepetitionPolicy::Update(const TerminationCounters &counters) {
+  return counters.equal_worlds_count > cMaxEqualWorldsCount
+             ? TerminationReason::Repeated
+             : TerminationReason::None;
+}
+
+GenerationLimitPolicy::GenerationLimitPolicy(
+    const std::uint32_t max_generations)
+    : cMaxGenerations(max_generations) {}
+
+void GenerationLimitPolicy::Reset() {}
+
+TerminationReason
+GenerationLimitPolicy::Update(const TerminationCounters &counters) {
+  return counters.generations_count > cMaxGenerations
+             ? TerminationReason::GenerationLimit
+             : TerminationReason::None;
+}
+
+std::uint32_t GenerationLimitPolicy::GetStride(
+    const std::uint32_t generations_count) const {
+  if (generations_count > cMaxGenerations) {
+    // the limit stays exceeded
+    return std::numeric_limits<std::uint32_t>::max();
+  }
+  const std::uint64_t stride =
+      static_cast<std::uint64_t>(cMaxGenerations) - generations_count + 1;
+  return static_cast<std::uint32_t>(std::min<std::uint64_t>(
+      stride, std::numeric_limits<std::uint32_t>::max()));
+}
+
+TimeBudgetPolicy::TimeBudgetPolicy(const std::chrono::milliseconds budget)
+    : cBudget(budget), start(std::chrono::steady_clock::now()) {}
+
+void TimeBudgetPolicy::Reset() { start = std::chrono::steady_clock::now(); }
+
+TerminationReason TimeBudgetPolicy::Update(const TerminationCounters &) {
+  return std::chrono::steady_clock::now() - start >= cBudget
+             ? TerminationReason::TimeBudget
+             : TerminationReason::None;
+}
+
+PopulationPlateauPolicy::PopulationPlateauPolicy(
+    const std::uint32_t generations, const std::uint64_t tolerance)
+    : cGenerations(generations), cTolerance(tolerance), run_start(0),
+      run_min(0), run_max(0), is_started(false) {}
+
+void PopulationPlateauPolicy::Reset() { is_started = false; }
+
+TerminationReason
+PopulationPlateauPolicy::Update(const TerminationCounters &counters) {
+  const std::uint64_t population = counters.summary.population;
+  const std::uint64_t new_min = std::min(run_min, population);
+  const std::uint64_t new_max = std::max(run_max, population);
+  if (!is_started || new_max - new_min > cTolerance) {
+    is_started = true;
+    run_start = counters.generations_count;
+    run_min = run_max = population;
+    return TerminationReason::None;
+  }
+
+  run_min = new_min;
+  run_max = new_max;
+  return counters.generations_count - run_start >= cGenerations
+             ? TerminationReason::PopulationPlateau
+             : TerminationReason::None;
+}
+
+UnboundedGrowthPolicy::UnboundedGrowthPolicy(
+    const std::uint32_t window, const std::uint32_t growing_windows)
+    : cWindow(std::max(1U, window)), cGrowingWindows(growing_windows),
+      window_start(0), window_population(0), growing_count(0),
+      is_started(false) {}
+
+void UnboundedGrowthPolicy::Reset() { is_started = false; }
+
+TerminationReason
+UnboundedGrowthPolicy::Update(const TerminationCounters &counters) {
+  const std::uint64_t population = counters.summary.population;
+  if (!is_started) {
+    is_started = true;
+    window_start = counters.generations_count;
+    window_population = population;
+    growing_count = 0;
+    return TerminationReason::None;
+  }
+  if (counters.generations_count - window_start < cWindow) {
+    return TerminationReason::None;
+  }
+
+  growing_count = population > window_population ? growing_count + 1 : 0;
+  window_start = counters.generations_count;
+  window_population = population;
+  return growing_count >= cGrowingWindows ? TerminationReason::UnboundedGrowth
+                                          : TerminationReason::None;
+}
+
+BoundingBoxStablePolicy::BoundingBoxStablePolicy(
+    const std::uint32_t generations)
+    : cGenerations(generations), box{}, box_since(0), is_started(false) {}
+
+void BoundingBoxStablePolicy::Reset() { is_started = false; }
+
+TerminationReason
+BoundingBoxStablePolicy::Update(const TerminationCounters &counters) {
+  const BoundingBox &new_box = counters.summary.bounding_box;
+  const bool is_same = new_box.top_row == box.top_row &&
+                       new_box.left_column == box.left_column &&
+                       new_box.bottom_row == box.bottom_row &&
+                       new_box.right_column == box.right_column;
+  if (!is_started || !is_same) {
+    is_started = true;
+    box = new_box;
+    box_since = counters.generations_count;
+    return TerminationReason::None;
+  }
+  return counters.generations_count - box_since >= cGenerations
+             ? TerminationReason::BoundingBoxStable
+             : TerminationReason::None;
+}
+
+void AnyTerminationPolicy::Add(std::unique_ptr<TerminationPolicy> policy) {
+  policies.push_back(std::move(policy));
+}
+
+void AnyTerminationPolicy::Reset() {
+  for (auto &policy : policies) {
+    policy->Reset();
+  }
+}
+
+TerminationReason
+AnyTerminationPolicy::Update(const TerminationCounters &counters) {
+  TerminationReason result = TerminationReason::None;
+  for (auto &policy : policies) {
+    const TerminationReason reason = policy->Update(counters);
+    if (result == TerminationReason::None) {
+      result = reason;
+    }
+  }
+  return result;
+}
+
+std::uint32_t
+AnyTerminationPolicy::GetStride(const std::uint32_t generations_count) const {
+  std::uint32_t stride = std::numeric_limits<std::uint32_t>::max();
+  for (const auto &policy : policies) {
+    stride = std::min(stride, policy->GetStride(generations_count));
+  }
+  return stride;
+}
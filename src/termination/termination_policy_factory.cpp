@@ -0,0 +1,48 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "termination/termination_policy_factory.h"
+#include "termination/termination_policies.h"
+
+namespace {
+/// @brief generations of a population plateau and of a stable bounding box
+/// in batch runs, longer than periods of common oscillators
+constexpr std::uint32_t cBatchStableGenerations = 120;
+/// @brief population difference which is still a plateau
+constexpr std::uint64_t cBatchPlateauTolerance = 0;
+/// @brief window of the growth detection and count of growing windows
+constexpr std::uint32_t cBatchGrowthWindow = 60;
+constexpr std::uint32_t cBatchGrowingWindows = 5;
+} // namespace
+
+std::unique_ptr<TerminationPolicy>
+TerminationPolicyFactory::MakeDefaultPolicy() {
+  std::unique_ptr<AnyTerminationPolicy> policy(new AnyTerminationPolicy());
+  policy->Add(std::unique_ptr<TerminationPolicy>(new ExtinctionPolicy(1)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(new RepetitionPolicy(0)));
+  policy->Add(
+      std::unique_ptr<TerminationPolicy>(new GenerationLimitPolicy(20)));
+  return policy;
+}
+
+std::unique_ptr<TerminationPolicy> TerminationPolicyFactory::MakeBatchPolicy(
+    const std::uint32_t max_generations,
+    const std::chrono::milliseconds time_budget) {
+  std::unique_ptr<AnyTerminationPolicy> policy(new AnyTerminationPolicy());
+  policy->Add(std::unique_ptr<TerminationPolicy>(new ExtinctionPolicy(1)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(new RepetitionPolicy(0)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(
+      new BoundingBoxStablePolicy(cBatchStableGenerations)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(new PopulationPlateauPolicy(
+      cBatchStableGenerations, cBatchPlateauTolerance)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(
+      new UnboundedGrowthPolicy(cBatchGrowthWindow, cBatchGrowingWindows)));
+  policy->Add(std::unique_ptr<TerminationPolicy>(
+      new GenerationLimitPolicy(max_generations)));
+  if (time_budget.count() > 0) {
+    policy->Add(
+        std::unique_ptr<TerminationPolicy>(new TimeBudgetPolicy(time_budget)));
+  }
+  return policy;
+}
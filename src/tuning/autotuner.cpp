@@ -0,0 +1,235 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "tuning/autotuner.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace {
+const char *GetEngineName(const GenerationEngineType engine) {
+  switch (engine) {
+  case GenerationEngineType::TemporalBlocking:
+    return "temporal_blocking";
+  case GenerationEngineType::LookupTable:
+    return "lookup_table";
+  case GenerationEngineType::Continuous:
+    return "continuous";
+  case GenerationEngineType::PerCell:
+  default:
+    return "per_cell";
+  }
+}
+} // namespace
+
+AutotuneSettings::AutotuneSettings()
+    : budget(200), profile_path(), log(&std::clog), game() {}
+
+Autotuner::Autotuner(const std::uint32_t rows, const std::uint32_t columns,
+                     const AutotuneSettings &settings)
+    : cRowsCount(rows), cColumnsCount(columns), settings(settings) {}
+
+const std::vector<TuningResult> &Autotuner::GetResults() const {
+  return results;
+}
+
+std::vector<GameOfLifeSettings> Autotuner::GetCandidates() const {
+  std::vector<GameOfLifeSettings> candidates;
+  const std::uint32_t hardware_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+
+  GameOfLifeSettings per_cell = settings.game;
+  per_cell.engine = GenerationEngineType::PerCell;
+  for (std::uint32_t threads = 1; threads < hardware_threads; threads *= 2) {
+    GameOfLifeSettings candidate = per_cell;
+    candidate.threads_count = threads;
+    candidates.push_back(candidate);
+  }
+  GameOfLifeSettings all_threads = per_cell;
+  all_threads.threads_count = hardware_threads;
+  candidates.push_back(all_threads);
+
+  // packed engines run in the calling thread. Generations are stepped one
+  // by one, so only tiles are measured, the depth never exceeds 1
+  for (const std::uint32_t tile_rows : cTileRows) {
+    GameOfLifeSettings candidate = settings.game;
+    candidate.threads_count = 1;
+    candidate.engine = GenerationEngineType::TemporalBlocking;
+    candidate.temporal_tile_rows = tile_rows;
+    candidates.push_back(candidate);
+    // bigger tiles are the same for the world
+    if (tile_rows >= cRowsCount) {
+      break;
+    }
+  }
+
+  GameOfLifeSettings lookup_table = settings.game;
+  lookup_table.threads_count = 1;
+  lookup_table.engine = GenerationEngineType::LookupTable;
+  candidates.push_back(lookup_table);
+  return candidates;
+}
+
+double Autotuner::Measure(const GameOfLifeSettings &candidate,
+                          const std::vector<Point> &alive_cells,
+                          const std::chrono::nanoseconds budget) const {
+  GameOfLife game(cRowsCount, cColumnsCount, candidate);
+  game.FillInitialPicture(alive_cells);
+  // the first generation touches memory and starts threads
+  game.ExecuteNextGeneration();
+
+  // the tuned settings are used by ExecuteNextGeneration, so every variant
+  // is measured by it
+  std::uint64_t generations = 0;
+  const auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  while (generations < cMinGenerations || elapsed < budget) {
+    game.ExecuteNextGeneration();
+    generations++;
+    elapsed = std::chrono::steady_clock::now() - start;
+  }
+
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  const double cells = static_cast<double>(cRowsCount) * cColumnsCount;
+  return seconds > 0 ? cells * generations / seconds : 0;
+}
+
+GameOfLifeSettings Autotuner::Tune(const std::vector<Point> &alive_cells) {
+  results.clear();
+  const std::string key = GetProfileKey(alive_cells);
+  TuningResult best{settings.game, 0};
+  if (!settings.profile_path.empty() && ReadProfile(key, best)) {
+    Log("Autotuner profile", best);
+    return best.settings;
+  }
+
+  const std::vector<GameOfLifeSettings> candidates = GetCandidates();
+  const std::chrono::nanoseconds candidate_budget =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(settings.budget) /
+      candidates.size();
+  for (const auto &candidate : candidates) {
+    results.push_back(
+        {candidate, Measure(candidate, alive_cells, candidate_budget)});
+    Log("Autotuner measured", results.back());
+    if (results.back().cells_per_second > best.cells_per_second) {
+      best = results.back();
+    }
+  }
+
+  Log("Autotuner chose", best);
+  if (!settings.profile_path.empty()) {
+    WriteProfile(key, best);
+  }
+  return best.settings;
+}
+
+std::string
+Autotuner::GetProfileKey(const std::vector<Point> &alive_cells) const {
+  char host_name[256] = {};
+  if (gethostname(host_name, sizeof(host_name) - 1)) {
+    std::snprintf(host_name, sizeof(host_name), "unknown");
+  }
+  const double cells = static_cast<double>(cRowsCount) * cColumnsCount;
+  const std::uint32_t density_percent = static_cast<std::uint32_t>(
+      std::lround(cells > 0 ? 100.0 * alive_cells.size() / cells : 0));
+
+  // keys are separated from settings by spaces in the profile file
+  std::string rule =
+      settings.game.rule.empty() ? "default" : settings.game.rule;
+  std::replace(rule.begin(), rule.end(), ' ', '_');
+
+  std::ostringstream key;
+  key << host_name << "/" << std::thread::hardware_concurrency() << "/"
+      << cRowsCount << "x" << cColumnsCount << "/" << density_percent << "/"
+      << GridNeighbourhood::GetTopologyName(settings.game.topology) << "/"
+      << rule << "/" << settings.game.birth_probability << "/"
+      << settings.game.survival_probability;
+  return key.str();
+}
+
+bool Autotuner::ReadProfile(const std::string &key,
+                            TuningResult &result) const {
+  std::ifstream stream(settings.profile_path);
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::istringstream line_stream(line);
+    std::string line_key;
+    std::uint32_t engine = 0;
+    GameOfLifeSettings profile_settings = settings.game;
+    double cells_per_second = 0;
+    if (!(line_stream >> line_key >> engine >> profile_settings.threads_count >>
+          profile_settings.temporal_tile_rows >>
+          profile_settings.temporal_depth >> cells_per_second)) {
+      continue;
+    }
+    constexpr std::uint32_t last_engine =
+        static_cast<std::uint32_t>(GenerationEngineType::LookupTable);
+    if (line_key != key || engine > last_engine) {
+      continue;
+    }
+    profile_settings.engine = static_cast<GenerationEngineType>(engine);
+    result = TuningResult{profile_settings, cells_per_second};
+    return true;
+  }
+  return false;
+}
+
+bool Autotuner::WriteProfile(const std::string &key,
+                             const TuningResult &result) const {
+  std::vector<std::string> lines;
+  {
+    std::ifstream stream(settings.profile_path);
+    std::string line;
+    while (std::getline(stream, line)) {
+      if (line.compare(0, key.size() + 1, key + " ") != 0) {
+        lines.push_back(line);
+      }
+    }
+  }
+
+  const std::string temporary_path = settings.profile_path + ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::trunc);
+    if (!stream) {
+      std::cerr << "Can't open profile file " << temporary_path << std::endl;
+      return false;
+    }
+    for (const auto &line : lines) {
+      stream << line << "\n";
+    }
+    stream << key << " " << static_cast<std::uint32_t>(result.settings.engine)
+           << " " << result.settings.threads_count << " "
+           << result.settings.temporal_tile_rows << " "
+           << result.settings.temporal_depth << " " << result.cells_per_second
+           << "\n";
+  }
+
+  if (std::rename(temporary_path.c_str(), settings.profile_path.c_str())) {
+    std::cerr << "Can't write profile file " << settings.profile_path
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void Autotuner::Log(const char *prefix, const TuningResult &result) const {
+  if (!settings.log) {
+    return;
+  }
+  *settings.log << prefix << " engine=" << GetEngineName(result.settings.engine)
+                << " threads=" << result.settings.threads_count;
+  if (result.settings.engine == GenerationEngineType::TemporalBlocking) {
+    *settings.log << " tile_rows=" << result.settings.temporal_tile_rows
+                  << " depth=" << result.settings.temporal_depth;
+  }
+  *settings.log << " cells_per_second=" << result.cells_per_second
+                << std::endl;
+}
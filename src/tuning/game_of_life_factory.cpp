@@ -0,0 +1,32 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "tuning/game_of_life_factory.h"
+#include "tuning/autotuner.h"
+
+std::unique_ptr<GameOfLife> GameOfLifeFactory::MakeGameOfLife(
+    const std::uint32_t rows, const std::uint32_t columns,
+    const GameOfLifeSettings &settings, const std::vector<Point> &alive_cells,
+    std::ostream *log) {
+  std::unique_ptr<GameOfLife> game(new GameOfLife(
+      rows, columns, MakeSettings(rows, columns, settings, alive_cells, log)));
+  game->FillInitialPicture(alive_cells);
+  return game;
+}
+
+GameOfLifeSettings GameOfLifeFactory::MakeSettings(
+    const std::uint32_t rows, const std::uint32_t columns,
+    const GameOfLifeSettings &settings, const std::vector<Point> &alive_cells,
+    std::ostream *log) {
+  if (!settings.autotune) {
+    return settings;
+  }
+  AutotuneSettings tune_settings;
+  tune_settings.profile_path = settings.autotune_profile_path;
+  tune_settings.log = log;
+  tune_settings.game = settings;
+  // candidates are measured on games which are not tuned again
+  tune_settings.game.autotune = false;
+  return Autotuner(rows, columns, tune_settings).Tune(alive_cells);
+}
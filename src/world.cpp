@@ -6,15 +6,23 @@
 
 #include <iostream>
 
-World::World(const std::uint32_t rows, const std::uint32_t columns)
-    : cRowsCount(rows), cColumnsCount(columns), hasher(rows, columns) {
-  for (std::uint32_t row = 0; row < rows; row++) {
-    cells.push_back(std::vector<Cell>(columns));
+World::World(const std::uint32_t rows, const std::uint32_t columns,
+             const bool allocate_cells)
+    : cells(rows, columns), packed_cells(rows, columns), cRowsCount(rows),
+      cColumnsCount(columns), statistics(rows, columns),
+      hasher(rows, columns) {
+  if (allocate_cells) {
+    AllocateRows(0, rows);
   }
 
   alive_cells_count = 0;
 }
 
+void World::AllocateRows(const std::uint32_t begin_row,
+                         const std::uint32_t end_row) {
+  cells.AllocateRows(begin_row, end_row);
+}
+
 void World::SetInitialCells(const std::vector<Point> &alive_cells,
                             const GameRules &rules) {
   for (auto &alive_cell : alive_cells) {
@@ -49,8 +57,10 @@ void World::MakeCellAlive(const std::uint32_t row, const std::uint32_t column,
     return;
   }
   cells[row][column].MakeAlive();
+  packed_cells.Set(row, column, true);
   alive_cells_count++;
   hasher.UpdateCellAlive(row, column);
+  statistics.AddBirth(row, column);
   SetCellNeighbours(row, column, rules);
 }
 
@@ -66,32 +76,42 @@ void World::MakeCellDied(const std::uint32_t row, const std::uint32_t column,
   }
 
   cells[row][column].MakeDied();
+  packed_cells.Set(row, column, false);
   alive_cells_count--;
   hasher.UpdateCellDied(row, column);
+  statistics.AddDeath(row, column);
   SetCellNeighbours(row, column, rules);
 }
 
 void World::SetCellNeighbours(const std::uint32_t row,
                               const std::uint32_t column,
                               const GameRules &rules) {
-  for (std::int32_t neighbour_row = static_cast<std::int32_t>(row) - 1;
-       neighbour_row <= static_cast<std::int32_t>(row) + 1; ++neighbour_row) {
-    for (std::int32_t neighbour_column = static_cast<std::int32_t>(column) - 1;
-         neighbour_column <= static_cast<std::int32_t>(column) + 1;
-         ++neighbour_column) {
-      std::int32_t current_row = neighbour_row;
-      rules.GetCellIndex(current_row, cRowsCount);
-
-      std::int32_t current_column = neighbour_column;
-      rules.GetCellIndex(current_column, cColumnsCount);
-
-      if (current_row != row or current_column != column) {
-        if (cells[row][column].IsAlive()) {
-          cells[current_row][current_column].AddNeighbour();
-        } else {
-          cells[current_row][current_column].RemoveNeighbour();
-        }
-      }
+  const bool is_limited =
+      rules.GetBordersRule() == CellBordersRule::LimitedBorders;
+  const std::int32_t rows = cRowsCount, columns = cColumnsCount;
+  const auto &offsets =
+      GridNeighbourhood::GetOffsets(rules.GetTopology(), row, column);
+  for (const auto &offset : offsets) {
+    std::int32_t current_row = static_cast<std::int32_t>(row) + offset.row;
+    std::int32_t current_column =
+        static_cast<std::int32_t>(column) + offset.column;
+    // cells outside of limited borders are dead and are not updated
+    if (is_limited && (current_row < 0 || current_row >= rows ||
+                       current_column < 0 || current_column >= columns)) {
+      continue;
+    }
+    rules.GetCellIndex(current_row, cRowsCount);
+    rules.GetCellIndex(current_column, cColumnsCount);
+    // in tiny ring worlds a neighbour could be the cell itself
+    if (current_row == static_cast<std::int32_t>(row) &&
+        current_column == static_cast<std::int32_t>(column)) {
+      continue;
+    }
+
+    if (cells[row][column].IsAlive()) {
+      cells[current_row][current_column].AddNeighbour();
+    } else {
+      cells[current_row][current_column].RemoveNeighbour();
     }
   }
 }
@@ -100,6 +120,184 @@ void World::UpdateHash() { hasher.UpdateHash(); }
 
 std::uint32_t World::GetEqualWorldsCount() { return hasher.EqualHashCount(); }
 
+std::uint64_t World::GetHashesCount() { return hasher.HashesCount(); }
+
+void World::ResetHashes() { hasher.Reset(); }
+
 std::uint64_t World::GetAliveCellsCount() const {
   return alive_cells_count.load();
 }
+
+const WorldStatistics &World::GetStatistics() const { return statistics; }
+
+WorldStatistics &World::GetStatistics() { return statistics; }
+
+void World::StartGeneration() { statistics.StartGeneration(); }
+
+const PackedGrid &World::GetPackedCells() const { return packed_cells; }
+
+void World::ApplyPackedCells(const PackedGrid &new_cells,
+                             const GameRules &rules) {
+  if (new_cells.GetRowCount() != cRowsCount ||
+      new_cells.GetColumnCount() != cColumnsCount) {
+    std::cerr << "Incorrect size of packed cells" << std::endl;
+    return;
+  }
+
+  const std::uint32_t words_per_row = packed_cells.GetWordsPerRow();
+  for (std::uint32_t row = 0; row < cRowsCount; row++) {
+    const std::uint64_t *new_row = new_cells.GetRow(row);
+    const std::uint64_t *current_row = packed_cells.GetRow(row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      std::uint64_t changed = new_row[word] ^ current_row[word];
+      while (changed) {
+        const std::uint32_t column =
+            word * 64 + static_cast<std::uint32_t>(__builtin_ctzll(changed));
+        changed &= changed - 1;
+        if ((new_row[word] >> (column % 64)) & 1) {
+          MakeCellAlive(row, column, rules);
+        } else {
+          MakeCellDied(row, column, rules);
+        }
+      }
+    }
+  }
+}
+
+void World::ReplaceRows(const PackedGrid &new_rows,
+                        const std::uint32_t first_row,
+                        const GameRules &rules) {
+  const std::uint32_t rows = new_rows.GetRowCount();
+  if (rows > cRowsCount || new_rows.GetColumnCount() != cColumnsCount) {
+    std::cerr << "Incorrect size of packed rows" << std::endl;
+    return;
+  }
+  if (!rows || !cColumnsCount) {
+    return;
+  }
+
+  // changed cells and cells around them, cells of every topology have
+  // neighbours at most 1 row and 2 columns away, so the window has a row
+  // above and a row below the new rows
+  const std::uint32_t words_per_row = packed_cells.GetWordsPerRow();
+  PackedGrid touched(rows + 2, cColumnsCount);
+  std::vector<std::uint8_t> is_touched_row(rows + 2, 0);
+  std::vector<std::uint64_t> changed(words_per_row);
+  std::vector<std::uint64_t> around(words_per_row);
+  for (std::uint32_t index = 0; index < rows; index++) {
+    const std::uint32_t row = (first_row + index) % cRowsCount;
+    const std::uint64_t *new_row = new_rows.GetRow(index);
+    std::uint64_t *current_row = packed_cells.GetRow(row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      changed[word] = current_row[word] ^ new_row[word];
+      std::uint64_t bits = changed[word];
+      while (bits) {
+        const std::uint32_t column =
+            word * 64 + static_cast<std::uint32_t>(__builtin_ctzll(bits));
+        bits &= bits - 1;
+        if ((new_row[word] >> (column % 64)) & 1) {
+          cells[row][column].MakeAlive();
+          alive_cells_count++;
+          statistics.AddBirth(row, column);
+        } else {
+          cells[row][column].MakeDied();
+          alive_cells_count--;
+          statistics.AddDeath(row, column);
+        }
+      }
+      current_row[word] = new_row[word];
+    }
+
+    bool is_changed = false;
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      const std::uint64_t bits = changed[word];
+      const std::uint64_t previous = word ? changed[word - 1] : 0;
+      const std::uint64_t next =
+          word + 1 < words_per_row ? changed[word + 1] : 0;
+      around[word] = bits | bits << 1 | bits << 2 | bits >> 1 | bits >> 2 |
+                     previous >> 63 | previous >> 62 | next << 63 |
+                     next << 62;
+      is_changed = is_changed || bits;
+    }
+    if (!is_changed) {
+      continue;
+    }
+    // columns around changed cells at the first and last columns wrap
+    for (const std::uint32_t column : {0U, 1U}) {
+      for (const std::uint32_t edge : {column, cColumnsCount - 1 - column}) {
+        if (edge < cColumnsCount && ((changed[edge / 64] >> (edge % 64)) & 1)) {
+          for (std::int32_t offset = -2; offset <= 2; offset++) {
+            std::int32_t around_column =
+                static_cast<std::int32_t>(edge) + offset;
+            rules.GetCellIndex(around_column, cColumnsCount);
+            around[around_column / 64] |= 1ULL << (around_column % 64);
+          }
+        }
+      }
+    }
+    around[words_per_row - 1] &= packed_cells.GetLastWordMask();
+    for (std::uint32_t window_row = index; window_row <= index + 2;
+         window_row++) {
+      std::uint64_t *touched_row = touched.GetRow(window_row);
+      for (std::uint32_t word = 0; word < words_per_row; word++) {
+        touched_row[word] |= around[word];
+      }
+      is_touched_row[window_row] = 1;
+    }
+  }
+
+  hasher.UpdateRows(packed_cells, first_row % cRowsCount, rows);
+  if (first_row % cRowsCount + rows > cRowsCount) {
+    hasher.UpdateRows(packed_cells, 0,
+                      first_row % cRowsCount + rows - cRowsCount);
+  }
+
+  // window rows wrap around the world, a row could be in the window twice
+  // when the window is as high as the world
+  for (std::uint32_t window_row = 0; window_row < rows + 2; window_row++) {
+    if (!is_touched_row[window_row]) {
+      continue;
+    }
+    const std::uint32_t row =
+        (first_row % cRowsCount + window_row + cRowsCount - 1) % cRowsCount;
+    const std::uint64_t *touched_row = touched.GetRow(window_row);
+    for (std::uint32_t word = 0; word < words_per_row; word++) {
+      std::uint64_t bits = touched_row[word];
+      while (bits) {
+        const std::uint32_t column =
+            word * 64 + static_cast<std::uint32_t>(__builtin_ctzll(bits));
+        bits &= bits - 1;
+        cells[row][column].SetNeighboursCount(
+            CountNeighbours(row, column, rules));
+      }
+    }
+  }
+}
+
+std::uint8_t World::CountNeighbours(const std::uint32_t row,
+                                    const std::uint32_t column,
+                                    const GameRules &rules) const {
+  const bool is_limited =
+      rules.GetBordersRule() == CellBordersRule::LimitedBorders;
+  const std::int32_t rows = cRowsCount, columns = cColumnsCount;
+  std::uint8_t count = 0;
+  for (const auto &offset :
+       GridNeighbourhood::GetOffsets(rules.GetTopology(), row, column)) {
+    std::int32_t current_row = static_cast<std::int32_t>(row) + offset.row;
+    std::int32_t current_column =
+        static_cast<std::int32_t>(column) + offset.column;
+    if (is_limited && (current_row < 0 || current_row >= rows ||
+                       current_column < 0 || current_column >= columns)) {
+      continue;
+    }
+    rules.GetCellIndex(current_row, cRowsCount);
+    rules.GetCellIndex(current_column, cColumnsCount);
+    // same as SetCellNeighbours, a cell is never its own neighbour
+    if (current_row == static_cast<std::int32_t>(row) &&
+        current_column == static_cast<std::int32_t>(column)) {
+      continue;
+    }
+    count += packed_cells.Get(current_row, current_column);
+  }
+  return count;
+}
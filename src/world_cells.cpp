@@ -0,0 +1,62 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "world_cells.h"
+
+#include <new>
+
+WorldCells::WorldCells(const std::uint32_t rows, const std::uint32_t columns)
+    : buffer(static_cast<std::size_t>(rows) * columns * sizeof(Cell)),
+      cells(static_cast<Cell *>(buffer.GetData())), allocated_rows(rows, 0),
+      cRowsCount(rows), cColumnsCount(columns) {
+  if (!cells && rows && columns) {
+    throw std::bad_alloc();
+  }
+}
+
+WorldCells::~WorldCells() {
+  for (std::uint32_t row = 0; row < cRowsCount; row++) {
+    if (!allocated_rows[row]) {
+      continue;
+    }
+    Cell *row_cells = cells + static_cast<std::size_t>(row) * cColumnsCount;
+    for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+      row_cells[column].~Cell();
+    }
+  }
+}
+
+void WorldCells::AllocateRows(const std::uint32_t begin_row,
+                              const std::uint32_t end_row) {
+  if (!cells) {
+    return;
+  }
+  for (std::uint32_t row = begin_row; row < end_row && row < cRowsCount;
+       row++) {
+    if (allocated_rows[row]) {
+      continue;
+    }
+    Cell *row_cells = cells + static_cast<std::size_t>(row) * cColumnsCount;
+    for (std::uint32_t column = 0; column < cColumnsCount; column++) {
+      new (row_cells + column) Cell();
+    }
+    allocated_rows[row] = 1;
+  }
+}
+
+std::uint32_t WorldCells::size() const { return cRowsCount; }
+
+CellRow WorldCells::operator[](const std::uint32_t row) {
+  return CellRow(cells + static_cast<std::size_t>(row) * cColumnsCount,
+                 allocated_rows[row] ? cColumnsCount : 0);
+}
+
+ConstCellRow WorldCells::operator[](const std::uint32_t row) const {
+  return ConstCellRow(cells + static_cast<std::size_t>(row) * cColumnsCount,
+                      allocated_rows[row] ? cColumnsCount : 0);
+}
+
+HugePageMode WorldCells::GetHugePageMode() const {
+  return buffer.GetMode();
+}
@@ -3,7 +3,9 @@
 /// @copyright Copyright (C) 2020
 ///
 #include "world_hasher.h"
+#include "region/region_query.h"
 
+#include <algorithm>
 #include <iostream>
 #include <math.h>
 
@@ -47,6 +49,45 @@ void WorldHasher::UpdateCellDied(const std::uint32_t row,
       (0xFFFFFFFF ^ (1 << ((row * cColumns + column) % cCellsInOneHash)));
 }
 
+void WorldHasher::UpdateRows(const PackedGrid &cells,
+                             const std::uint32_t first_row,
+                             const std::uint32_t rows_count) {
+  if (!rows_count || !cColumns) {
+    return;
+  }
+  const std::uint64_t first_cell =
+      static_cast<std::uint64_t>(first_row) * cColumns;
+  const std::uint64_t end_cell = std::min<std::uint64_t>(
+      first_cell + static_cast<std::uint64_t>(rows_count) * cColumns,
+      static_cast<std::uint64_t>(cRows) * cColumns);
+  const std::uint64_t first_segment = first_cell / cCellsInOneHash;
+  const std::uint64_t end_segment = std::min<std::uint64_t>(
+      (end_cell + cCellsInOneHash - 1) / cCellsInOneHash, hash.size());
+
+  std::lock_guard<std::mutex> lock(hash_mutex);
+  for (std::uint64_t segment = first_segment; segment < end_segment;
+       segment++) {
+    // segments are continuous cells of rows one after another, so a segment
+    // could contain parts of several rows
+    const std::uint64_t segment_cell = segment * cCellsInOneHash;
+    const std::uint64_t segment_end = std::min<std::uint64_t>(
+        segment_cell + cCellsInOneHash,
+        static_cast<std::uint64_t>(cRows) * cColumns);
+    std::uint32_t value = 0;
+    for (std::uint64_t cell = segment_cell; cell < segment_end;) {
+      const std::uint32_t row = static_cast<std::uint32_t>(cell / cColumns);
+      const std::uint32_t column = static_cast<std::uint32_t>(cell % cColumns);
+      const std::uint32_t count = static_cast<std::uint32_t>(
+          std::min<std::uint64_t>(segment_end - cell, cColumns - column));
+      value |= static_cast<std::uint32_t>(
+                   RegionQuery::ReadBits(cells.GetRow(row), column, count))
+               << (cell - segment_cell);
+      cell += count;
+    }
+    hash[segment] = value;
+  }
+}
+
 void WorldHasher::UpdateHash() {
   if (hashes.find(hash) != hashes.end()) {
     equal_hash_count++;
@@ -56,3 +97,10 @@ void WorldHasher::UpdateHash() {
 }
 
 std::uint32_t WorldHasher::EqualHashCount() { return equal_hash_count; }
+
+std::uint64_t WorldHasher::HashesCount() { return hashes.size(); }
+
+void WorldHasher::Reset() {
+  hashes.clear();
+  equal_hash_count = 0;
+}
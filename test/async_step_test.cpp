@@ -0,0 +1,202 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace {
+/// glider moves forever on ring borders
+const std::vector<Point> cGlider{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}};
+/// blinker and block, the game is over after 2 generations
+const std::vector<Point> cBlinkerAndBlock{{5, 4},   {5, 5},   {5, 6}, {14, 14},
+                                          {14, 15}, {15, 14}, {15, 15}};
+
+GameOfLifeSettings MakeSingleThreadSettings() {
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  return settings;
+}
+} // namespace
+
+struct TestCase_StepAsync {
+  std::string name;
+  // set up inputs
+  std::uint32_t generations;
+  std::uint32_t progress_period;
+  // expected
+  std::uint32_t progress_calls;
+};
+
+class StepAsyncTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_StepAsync> {};
+
+INSTANTIATE_TEST_CASE_P(
+    StepAsyncTest, StepAsyncTestFixture,
+    ::testing::Values(TestCase_StepAsync{"NoGenerationsTest", 0, 1, 0},
+                      TestCase_StepAsync{"OneSliceTest", 5, 2, 2},
+                      TestCase_StepAsync{"SeveralSlicesTest", 100, 10, 10},
+                      TestCase_StepAsync{"NoProgressTest", 40, 0, 0}));
+
+TEST_P(StepAsyncTestFixture, StepAsyncTest) {
+  // Given
+  auto param{GetParam()};
+  StepExecutor executor(1);
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cGlider);
+  GameOfLife expected_game(20, 20, MakeSingleThreadSettings());
+  expected_game.FillInitialPicture(cGlider);
+  for (std::uint32_t generation = 0; generation < param.generations;
+       generation++) {
+    expected_game.ExecuteNextGeneration();
+  }
+  std::uint32_t progress_calls = 0;
+  AsyncStepOptions options;
+  options.executor = &executor;
+  options.progress_period = param.progress_period;
+  options.progress = [&progress_calls](const StepProgress &progress) {
+    progress_calls++;
+    EXPECT_EQ(progress.alive_cells_count, 5);
+  };
+
+  const StepResult result = game.StepAsync(param.generations, options).get();
+
+  // Expected
+  EXPECT_EQ(result.status, StepStatus::Completed);
+  EXPECT_EQ(result.generations, param.generations);
+  EXPECT_EQ(result.generations_count, param.generations);
+  EXPECT_EQ(progress_calls, param.progress_calls);
+  EXPECT_EQ(game.GetPackedCells(), expected_game.GetPackedCells());
+}
+
+TEST(StepAsyncTest, RunUntilGameOverTest) {
+  // Given
+  StepExecutor executor(1);
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cBlinkerAndBlock);
+  AsyncStepOptions options;
+  options.executor = &executor;
+
+  const StepResult result = game.RunUntilGameOver(options).get();
+
+  // Expected
+  EXPECT_EQ(result.status, StepStatus::GameOver);
+  EXPECT_EQ(result.generations, 2);
+  EXPECT_TRUE(game.IsGameOver());
+}
+
+TEST(StepAsyncTest, CancellationTest) {
+  // Given
+  StepExecutor executor(1);
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cGlider);
+  AsyncStepOptions options;
+  options.executor = &executor;
+  CancellationToken token = options.cancellation;
+  options.progress_period = 50;
+  options.progress = [token](const StepProgress &) mutable { token.Cancel(); };
+
+  const StepResult result = game.StepAsync(1000, options).get();
+
+  // Expected
+  EXPECT_EQ(result.status, StepStatus::Cancelled);
+  EXPECT_EQ(result.generations, 50);
+  EXPECT_EQ(game.GetGenerationsCount(), 50);
+}
+
+TEST(StepAsyncTest, TimeBudgetTest) {
+  // Given
+  StepExecutor executor(1);
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cGlider);
+  AsyncStepOptions options;
+  options.executor = &executor;
+  options.time_budget = std::chrono::milliseconds(20);
+  options.progress_period = 1;
+  options.progress = [](const StepProgress &) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  };
+
+  const StepResult result =
+      game.StepAsync(std::numeric_limits<std::uint32_t>::max(), options)
+          .get();
+
+  // Expected
+  EXPECT_EQ(result.status, StepStatus::BudgetExhausted);
+  EXPECT_GT(result.generations, 0);
+  EXPECT_LT(result.generations, 1000);
+}
+
+TEST(StepAsyncTest, RejectedWhileRunningTest) {
+  // Given
+  StepExecutor executor(1);
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cGlider);
+  AsyncStepOptions options;
+  options.executor = &executor;
+  CancellationToken token = options.cancellation;
+
+  std::future<StepResult> running = game.StepAsync(
+      std::numeric_limits<std::uint32_t>::max(), options);
+  const StepResult rejected = game.StepAsync(1, options).get();
+  token.Cancel();
+  const StepResult cancelled = running.get();
+  AsyncStepOptions next_options;
+  next_options.executor = &executor;
+  const StepResult next = game.StepAsync(1, next_options).get();
+
+  // Expected
+  EXPECT_EQ(rejected.status, StepStatus::Rejected);
+  EXPECT_EQ(rejected.generations, 0);
+  EXPECT_EQ(cancelled.status, StepStatus::Cancelled);
+  EXPECT_EQ(next.status, StepStatus::Completed);
+}
+
+TEST(StepAsyncTest, CancelledWhenExecutorDestroyedTest) {
+  // Given
+  GameOfLife game(20, 20, MakeSingleThreadSettings());
+  game.FillInitialPicture(cGlider);
+  std::future<StepResult> pending;
+  {
+    StepExecutor executor(1);
+    AsyncStepOptions options;
+    options.executor = &executor;
+    pending = game.StepAsync(std::numeric_limits<std::uint32_t>::max(),
+                             options);
+  }
+  const StepResult cancelled = pending.get();
+  StepExecutor next_executor(1);
+  AsyncStepOptions next_options;
+  next_options.executor = &next_executor;
+  const StepResult next = game.StepAsync(1, next_options).get();
+
+  // Expected
+  EXPECT_EQ(cancelled.status, StepStatus::Cancelled);
+  EXPECT_EQ(cancelled.generations_count, game.GetGenerationsCount() - 1);
+  EXPECT_EQ(next.status, StepStatus::Completed);
+}
+
+TEST(StepAsyncTest, ManyGamesOnOneThreadTest) {
+  // Given
+  StepExecutor executor(1);
+  std::vector<std::unique_ptr<GameOfLife>> games;
+  std::vector<std::future<StepResult>> results;
+  AsyncStepOptions options;
+  options.executor = &executor;
+  for (std::uint32_t game_num = 0; game_num < 10; game_num++) {
+    games.emplace_back(new GameOfLife(20, 20, MakeSingleThreadSettings()));
+    games.back()->FillInitialPicture(cGlider);
+    results.push_back(games.back()->StepAsync(100, options));
+  }
+
+  // Expected
+  for (auto &result : results) {
+    const StepResult step_result = result.get();
+    EXPECT_EQ(step_result.status, StepStatus::Completed);
+    EXPECT_EQ(step_result.generations_count, 100);
+  }
+}
@@ -0,0 +1,167 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "tuning/autotuner.h"
+#include "tuning/game_of_life_factory.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+TEST(AutotunerTest, CandidatesTest) {
+  // Given
+  Autotuner autotuner(20, 100);
+  const std::vector<GameOfLifeSettings> candidates =
+      autotuner.GetCandidates();
+
+  std::uint32_t per_cell_count = 0, temporal_blocking_count = 0,
+                lookup_table_count = 0;
+  for (const auto &candidate : candidates) {
+    switch (candidate.engine) {
+    case GenerationEngineType::PerCell:
+      per_cell_count++;
+      break;
+    case GenerationEngineType::TemporalBlocking:
+      temporal_blocking_count++;
+      EXPECT_EQ(candidate.threads_count, 1);
+      break;
+    case GenerationEngineType::LookupTable:
+      lookup_table_count++;
+      break;
+    case GenerationEngineType::Continuous:
+      ADD_FAILURE() << "continuous engine is not a candidate";
+      break;
+    }
+  }
+
+  // Expected
+  EXPECT_GE(per_cell_count, 1);
+  // tiles of 16 and 64 rows, 256 rows are the same as 64 for 20 rows
+  EXPECT_EQ(temporal_blocking_count, 2);
+  EXPECT_EQ(lookup_table_count, 1);
+}
+
+TEST(AutotunerTest, TuneAndProfileTest) {
+  // Given
+  constexpr std::uint32_t rows = 48;
+  constexpr std::uint32_t columns = 80;
+  const std::vector<Point> cells = MakeRandomCells(rows, columns);
+  const std::string profile_path =
+      "/tmp/game_of_life_profile_" + std::to_string(getpid());
+  std::remove(profile_path.c_str());
+
+  std::ostringstream log;
+  AutotuneSettings settings;
+  settings.budget = std::chrono::milliseconds(30);
+  settings.profile_path = profile_path;
+  settings.log = &log;
+
+  Autotuner autotuner(rows, columns, settings);
+  const GameOfLifeSettings tuned = autotuner.Tune(cells);
+
+  Autotuner cached_autotuner(rows, columns, settings);
+  const GameOfLifeSettings cached = cached_autotuner.Tune(cells);
+  std::remove(profile_path.c_str());
+
+  // Expected
+  ASSERT_EQ(autotuner.GetResults().size(), autotuner.GetCandidates().size());
+  double best_rate = 0;
+  for (const auto &result : autotuner.GetResults()) {
+    EXPECT_GT(result.cells_per_second, 0);
+    best_rate = std::max(best_rate, result.cells_per_second);
+  }
+  bool is_best_chosen = false;
+  for (const auto &result : autotuner.GetResults()) {
+    if (result.cells_per_second == best_rate) {
+      is_best_chosen = result.settings.engine == tuned.engine &&
+                       result.settings.threads_count == tuned.threads_count &&
+                       result.settings.temporal_tile_rows ==
+                           tuned.temporal_tile_rows &&
+                       result.settings.temporal_depth == tuned.temporal_depth;
+    }
+  }
+  EXPECT_TRUE(is_best_chosen);
+
+  // second run reads the profile instead of measuring
+  EXPECT_TRUE(cached_autotuner.GetResults().empty());
+  EXPECT_EQ(cached.engine, tuned.engine);
+  EXPECT_EQ(cached.threads_count, tuned.threads_count);
+  EXPECT_EQ(cached.temporal_tile_rows, tuned.temporal_tile_rows);
+  EXPECT_EQ(cached.temporal_depth, tuned.temporal_depth);
+  EXPECT_NE(log.str().find("Autotuner chose"), std::string::npos);
+  EXPECT_NE(log.str().find("Autotuner profile"), std::string::npos);
+}
+
+TEST(AutotunerTest, GameSettingsTest) {
+  // Given
+  constexpr std::uint32_t rows = 24;
+  constexpr std::uint32_t columns = 40;
+  const std::vector<Point> cells = MakeRandomCells(rows, columns);
+  const std::string profile_path =
+      "/tmp/game_of_life_rule_profile_" + std::to_string(getpid());
+  std::remove(profile_path.c_str());
+  AutotuneSettings settings;
+  settings.budget = std::chrono::milliseconds(10);
+  settings.profile_path = profile_path;
+  settings.log = nullptr;
+  Autotuner conway_autotuner(rows, columns, settings);
+  conway_autotuner.Tune(cells);
+
+  settings.game.topology = GridTopology::Hexagonal;
+  settings.game.rule = "B2/S34";
+  settings.game.survival_probability = 0.5;
+  Autotuner hexagonal_autotuner(rows, columns, settings);
+  const GameOfLifeSettings tuned = hexagonal_autotuner.Tune(cells);
+  std::remove(profile_path.c_str());
+
+  // Expected candidates keep the rule and the profile of another rule is
+  // not used
+  for (const auto &candidate : hexagonal_autotuner.GetCandidates()) {
+    EXPECT_EQ(candidate.topology, GridTopology::Hexagonal);
+    EXPECT_EQ(candidate.rule, "B2/S34");
+    EXPECT_EQ(candidate.survival_probability, 0.5);
+  }
+  EXPECT_FALSE(hexagonal_autotuner.GetResults().empty());
+  EXPECT_EQ(tuned.topology, GridTopology::Hexagonal);
+  EXPECT_EQ(tuned.rule, "B2/S34");
+}
+
+TEST(AutotunerTest, FactoryTest) {
+  // Given
+  constexpr std::uint32_t rows = 24;
+  constexpr std::uint32_t columns = 40;
+  const std::vector<Point> cells = MakeRandomCells(rows, columns);
+  const std::string profile_path =
+      "/tmp/game_of_life_factory_profile_" + std::to_string(getpid());
+  std::remove(profile_path.c_str());
+  GameOfLifeSettings settings;
+  settings.rule = "B36/S23";
+  std::ostringstream log;
+  const std::unique_ptr<GameOfLife> plain_game =
+      GameOfLifeFactory::MakeGameOfLife(rows, columns, settings, cells, &log);
+  settings.autotune = true;
+  settings.autotune_profile_path = profile_path;
+  const std::unique_ptr<GameOfLife> tuned_game =
+      GameOfLifeFactory::MakeGameOfLife(rows, columns, settings, cells, &log);
+  const GameOfLifeSettings cached =
+      GameOfLifeFactory::MakeSettings(rows, columns, settings, cells, &log);
+  std::ifstream profile(profile_path);
+  const bool is_profile_written = profile.good();
+  std::remove(profile_path.c_str());
+
+  // Expected only the autotune game is tuned, the choice is logged and
+  // cached
+  EXPECT_TRUE(is_profile_written);
+  EXPECT_NE(log.str().find("Autotuner chose"), std::string::npos);
+  EXPECT_NE(log.str().find("Autotuner profile"), std::string::npos);
+  EXPECT_FALSE(cached.autotune);
+  EXPECT_EQ(cached.rule, "B36/S23");
+  plain_game->ExecuteNextGeneration();
+  tuned_game->ExecuteNextGeneration();
+  EXPECT_EQ(tuned_game->GetPackedCells(), plain_game->GetPackedCells());
+}
@@ -0,0 +1,121 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "c_api/game_of_life_c.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+namespace {
+bool IsAlive(const uint64_t *cells, const gol_grid_layout &layout,
+             const uint32_t row, const uint32_t column) {
+  return (cells[row * layout.words_per_row + column / 64] >> (column % 64)) &
+         1;
+}
+} // namespace
+
+struct TestCase_CApi {
+  std::string name;
+  // set up inputs
+  uint32_t rows;
+  uint32_t columns;
+  uint32_t engine;
+  uint32_t generations;
+  // expected
+  bool is_vertical;
+};
+
+class CApiTestFixture : public ::testing::Test,
+                        public ::testing::WithParamInterface<TestCase_CApi> {};
+
+INSTANTIATE_TEST_CASE_P(
+    CApiTest, CApiTestFixture,
+    ::testing::Values(
+        TestCase_CApi{"PerCellOneStepTest", 10, 70, GOL_ENGINE_PER_CELL, 1,
+                      true},
+        TestCase_CApi{"PerCellTwoStepsTest", 10, 70, GOL_ENGINE_PER_CELL, 2,
+                      false},
+        TestCase_CApi{"TemporalBlockingTest", 10, 70,
+                      GOL_ENGINE_TEMPORAL_BLOCKING, 5, true},
+        TestCase_CApi{"LookupTableTest", 9, 130, GOL_ENGINE_LOOKUP_TABLE, 4,
+                      false}));
+
+TEST_P(CApiTestFixture, CApiTest) {
+  // Given
+  auto param{GetParam()};
+  gol_settings settings = {};
+  settings.engine = param.engine;
+  gol_world *world = gol_world_create(param.rows, param.columns, &settings);
+  ASSERT_NE(world, nullptr);
+  // horizontal blinker at row 5, columns 64 .. 66 of the wide world
+  const uint32_t column = param.columns > 66 ? 64 : 3;
+  ASSERT_EQ(gol_world_load_pattern(world, "ooo", 5, column), GOL_OK);
+
+  gol_grid_layout layout;
+  const uint64_t *cells = gol_world_get_cells(world, &layout);
+  ASSERT_EQ(gol_world_step(world, param.generations), GOL_OK);
+
+  // Expected
+  // the pointer is not changed by steps, cells are read without copying
+  EXPECT_EQ(gol_world_get_cells(world, nullptr), cells);
+  EXPECT_EQ(layout.rows, param.rows);
+  EXPECT_EQ(layout.columns, param.columns);
+  EXPECT_EQ(layout.words_per_row, (param.columns + 63) / 64);
+  EXPECT_EQ(gol_world_get_generation(world), param.generations);
+  EXPECT_EQ(gol_world_get_alive_cells_count(world), 3);
+  EXPECT_EQ(IsAlive(cells, layout, 4, column + 1), param.is_vertical);
+  EXPECT_EQ(IsAlive(cells, layout, 5, column), !param.is_vertical);
+  EXPECT_TRUE(IsAlive(cells, layout, 5, column + 1));
+
+  gol_world_destroy(world);
+}
+
+TEST(CApiTest, InvalidArgumentsTest) {
+  // Given
+  gol_world *world = gol_world_create(5, 5, nullptr);
+  const uint32_t outside_cells[] = {1, 1, 5, 0};
+
+  // Expected
+  EXPECT_EQ(gol_api_version(), GOL_API_VERSION);
+  EXPECT_EQ(gol_world_create(0, 5, nullptr), nullptr);
+  ASSERT_NE(world, nullptr);
+  EXPECT_EQ(gol_world_load_cells(world, outside_cells, 2),
+            GOL_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(gol_world_load_cells(world, outside_cells, 1), GOL_OK);
+  EXPECT_EQ(gol_world_load_pattern(world, nullptr, 0, 0),
+            GOL_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(gol_world_step(nullptr, 1), GOL_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(gol_world_get_cells(nullptr, nullptr), nullptr);
+  // single cell dies, the game is over
+  EXPECT_EQ(gol_world_step(world, 1), GOL_OK);
+  EXPECT_EQ(gol_world_is_game_over(world), 1);
+
+  gol_world_destroy(world);
+  gol_world_destroy(nullptr);
+}
+
+TEST(CApiTest, AutotuneTest) {
+  // Given
+  const std::string profile_path =
+      ::testing::TempDir() + "c_api_autotune.profile";
+  std::remove(profile_path.c_str());
+  gol_settings settings = {};
+  settings.autotune = 1;
+  settings.autotune_profile_path = profile_path.c_str();
+  gol_world *world = gol_world_create(10, 70, &settings);
+  ASSERT_NE(world, nullptr);
+
+  // Expected the world is tuned on load and keeps the loaded cells
+  ASSERT_EQ(gol_world_load_pattern(world, "ooo", 5, 3), GOL_OK);
+  EXPECT_EQ(gol_world_step(world, 1), GOL_OK);
+  gol_grid_layout layout;
+  const uint64_t *cells = gol_world_get_cells(world, &layout);
+  EXPECT_EQ(gol_world_get_alive_cells_count(world), 3);
+  EXPECT_TRUE(IsAlive(cells, layout, 4, 4));
+  EXPECT_TRUE(IsAlive(cells, layout, 6, 4));
+  EXPECT_EQ(std::remove(profile_path.c_str()), 0);
+  gol_world_destroy(world);
+}
@@ -35,15 +35,15 @@ TEST(CellTest, Add8NighboursTest) {
   }
 }
 
-TEST(CellTest, AddMoreThan8NighboursTest) {
+TEST(CellTest, AddMoreThan12NighboursTest) {
   Cell test_cell;
   EXPECT_EQ(test_cell.GetAliveNeighboursCount(), 0);
-  for (std::uint8_t neighbour = 0; neighbour < 8; neighbour++) {
+  for (std::uint8_t neighbour = 0; neighbour < 12; neighbour++) {
     test_cell.AddNeighbour();
     EXPECT_EQ(test_cell.GetAliveNeighboursCount(), neighbour + 1);
   }
   test_cell.AddNeighbour();
-  EXPECT_EQ(test_cell.GetAliveNeighboursCount(), 8);
+  EXPECT_EQ(test_cell.GetAliveNeighboursCount(), 12);
 }
 
 TEST(CellTest, MakeDiedTest) {
@@ -51,39 +51,3 @@ TEST_P(ConwayTestAliveFixture, CellStateTest) {
   // Expected
   EXPECT_EQ(game_rules.GetNewCellState(cell), param.stay_alive);
 }
-
-struct TestCase_Conway_GameOver {
-  std::string name;
-  // set up inputs
-  std::uint32_t alive_cells_count;
-  std::uint32_t equal_worlds_count;
-  std::uint32_t generations_count;
-  // expected
-  bool is_game_over;
-};
-
-class ConwayGameOverTestFixture
-    : public ::testing::Test,
-      public ::testing::WithParamInterface<TestCase_Conway_GameOver> {
-protected:
-  ConwayRules game_rules;
-};
-
-INSTANTIATE_TEST_CASE_P(
-    ConwayTestFixture_GameOverTest, ConwayGameOverTestFixture,
-    ::testing::Values(
-        TestCase_Conway_GameOver{"GameOverIfCellsDead", 0, 0, 10, true},
-        TestCase_Conway_GameOver{"GameNotOverIfCellsAlive", 10, 0, 5, false},
-        TestCase_Conway_GameOver{"GameOverWorldIsRepeated", 100, 1, 20, true}));
-
-TEST_P(ConwayGameOverTestFixture, GameOverTest) {
-  // Given
-  auto param{GetParam()};
-
-  bool is_game_over =
-      game_rules.IsGameOver(param.alive_cells_count, param.equal_worlds_count,
-                            param.generations_count);
-
-  // Expected
-  EXPECT_EQ(is_game_over, param.is_game_over);
-}
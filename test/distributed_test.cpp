@@ -0,0 +1,91 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020, Bayerische Motoren Werke Aktiengesellschaft
+/// (BMW AG)
+///
+#include "distributed/distributed_game_of_life.h"
+#include "distributed/shared_memory_ring.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+struct TestCase_Distributed {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  std::uint32_t bands_count;
+  std::vector<Point> initial_cells;
+  // expected
+  std::uint32_t generations_count;
+  std::uint64_t alive_cells_count;
+};
+
+class DistributedTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_Distributed> {};
+
+INSTANTIATE_TEST_CASE_P(
+    DistributedTest, DistributedTestFixture,
+    ::testing::Values(
+        TestCase_Distributed{"LineThreeBands", 12, 10, 3,
+                             {{6, 4}, {6, 5}, {6, 6}}, 2, 3},
+        TestCase_Distributed{"LineAcrossBandsBorder", 12, 10, 3,
+                             {{3, 4}, {4, 4}, {5, 4}}, 2, 3},
+        TestCase_Distributed{"LineAcrossRingBorderOneBand", 12, 10, 1,
+                             {{11, 4}, {0, 4}, {1, 4}}, 2, 3},
+        TestCase_Distributed{"GliderFourBands", 12, 12, 4,
+                             {{0, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}}, 21, 5},
+        TestCase_Distributed{"GliderBandPerRow", 6, 7, 6,
+                             {{0, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}}, 21, 5}));
+
+TEST_P(DistributedTestFixture, DistributedGameTest) {
+  // Given
+  auto param{GetParam()};
+  DistributedSettings settings;
+  settings.rows = param.rows;
+  settings.columns = param.columns;
+  settings.bands_count = param.bands_count;
+  settings.session = "gol_test_" + std::to_string(getpid()) + "_" + param.name;
+
+  // When
+  DistributedGameOfLife game(settings);
+  const DistributedResult result = game.Run(param.initial_cells);
+
+  // Expected
+  EXPECT_TRUE(result.completed);
+  EXPECT_EQ(result.generations_count, param.generations_count);
+  EXPECT_EQ(result.alive_cells_count, param.alive_cells_count);
+}
+
+TEST(DistributedTest, TooManyBandsTest) {
+  DistributedSettings settings;
+  settings.rows = 2;
+  settings.columns = 5;
+  settings.bands_count = 3;
+
+  DistributedGameOfLife game(settings);
+  EXPECT_FALSE(game.Run({{0, 0}}).completed);
+}
+
+TEST(SharedMemoryRingTest, PushPopTest) {
+  const std::string name = "/gol_ring_test_" + std::to_string(getpid());
+  SharedMemoryRing producer(name, 2, 2, true);
+  SharedMemoryRing consumer(name, 0, 0, false);
+  ASSERT_TRUE(producer.IsValid());
+  ASSERT_TRUE(consumer.IsValid());
+
+  const std::chrono::milliseconds timeout(10);
+  EXPECT_TRUE(producer.Push({1, 2}, timeout));
+  EXPECT_TRUE(producer.Push({3}, timeout));
+  EXPECT_FALSE(producer.Push({4}, timeout));
+  EXPECT_FALSE(producer.Push({1, 2, 3}, timeout));
+
+  std::vector<std::uint64_t> message;
+  EXPECT_TRUE(consumer.Pop(message, timeout));
+  EXPECT_EQ(message, std::vector<std::uint64_t>({1, 2}));
+  EXPECT_TRUE(consumer.Pop(message, timeout));
+  EXPECT_EQ(message, std::vector<std::uint64_t>({3}));
+  EXPECT_FALSE(consumer.Pop(message, timeout));
+}
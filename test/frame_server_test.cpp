@@ -0,0 +1,180 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "streaming/frame_subscriber.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <map>
+#include <thread>
+
+namespace {
+/// @brief return socket path which is unique for the test process
+std::string MakeSocketPath(const std::string &name) {
+  return "/tmp/game_of_life_" + name + "_" + std::to_string(getpid()) +
+         ".sock";
+}
+
+/// @brief wait until the server accepted count subscribers
+bool WaitForSubscribers(const FrameServer &server, const std::size_t count) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (server.GetSubscribersCount() != count) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+} // namespace
+
+struct TestCase_FrameServer {
+  std::string name;
+  // set up inputs
+  SubscribeRequest viewport;
+};
+
+class FrameServerTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_FrameServer> {};
+
+INSTANTIATE_TEST_CASE_P(
+    FrameServerTest, FrameServerTestFixture,
+    ::testing::Values(
+        TestCase_FrameServer{"WholeWorldTest", {0, 0, 0, 0, 0, 0}},
+        TestCase_FrameServer{"ViewportTest", {0, 40, 70, 50, 100, 0}},
+        TestCase_FrameServer{"CornerViewportTest", {0, 90, 150, 0, 0, 0}}));
+
+TEST_P(FrameServerTestFixture, FrameServerTest) {
+  // Given
+  auto param{GetParam()};
+  const std::string path = MakeSocketPath("viewport");
+  FrameServer server(path);
+  ASSERT_TRUE(server.Start());
+  FrameSubscriber subscriber;
+  ASSERT_TRUE(subscriber.Connect(path, param.viewport));
+  ASSERT_TRUE(WaitForSubscribers(server, 1));
+
+  std::map<std::uint32_t, PackedGrid> grids;
+  for (std::uint32_t generation = 0; generation < 20; generation++) {
+    grids[generation] = MakeRandomGrid(120, 200, 0.3, generation);
+    server.Publish(generation, grids[generation]);
+  }
+
+  // Expected
+  const SubscribeRequest &viewport = param.viewport;
+  const Region region{viewport.top_row, viewport.left_column,
+                      viewport.rows ? viewport.rows : 120 - viewport.top_row,
+                      viewport.columns ? viewport.columns
+                                       : 200 - viewport.left_column};
+  StreamFrame frame;
+  std::uint32_t frames_count = 0;
+  do {
+    ASSERT_TRUE(subscriber.ReceiveFrame(std::chrono::seconds(5), frame));
+    frames_count++;
+    ASSERT_EQ(grids.count(frame.generation), 1);
+    EXPECT_EQ(frame.cells,
+              RegionQuery::ReadCells(grids[frame.generation], region,
+                                     CellBordersRule::LimitedBorders));
+  } while (frame.generation != 19);
+  EXPECT_LE(frames_count, 20);
+}
+
+TEST(FrameServerTest, GameStreamingTest) {
+  // Given
+  const std::string path = MakeSocketPath("game");
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(64, 64, settings);
+  ASSERT_TRUE(game.EnableStreaming(path));
+  FrameSubscriber subscriber;
+  ASSERT_TRUE(subscriber.Connect(path, {0, 0, 0, 0, 0, 0}));
+  game.FillInitialPicture(
+      std::vector<Point>{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}});
+
+  // generations are published only after the server accepted the
+  // subscriber
+  StreamFrame frame{};
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  do {
+    ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+    game.ExecuteNextGeneration();
+  } while (!subscriber.ReceiveFrame(std::chrono::milliseconds(100), frame));
+  std::uint32_t deltas_count = 0;
+  for (std::uint32_t step = 0; step < 4; step++) {
+    game.ExecuteNextGeneration();
+    do {
+      ASSERT_TRUE(subscriber.ReceiveFrame(std::chrono::seconds(5), frame));
+      deltas_count += frame.is_keyframe ? 0 : 1;
+    } while (frame.generation < game.GetGenerationsCount());
+  }
+
+  // Expected
+  EXPECT_EQ(frame.generation, game.GetGenerationsCount());
+  EXPECT_EQ(frame.cells, game.GetPackedCells());
+  EXPECT_GT(deltas_count, 0);
+}
+
+TEST(FrameServerTest, FrameRateCapTest) {
+  // Given
+  const std::string path = MakeSocketPath("rate");
+  FrameServer server(path);
+  ASSERT_TRUE(server.Start());
+  FrameSubscriber subscriber;
+  ASSERT_TRUE(subscriber.Connect(path, {0, 0, 0, 0, 0, 10}));
+  ASSERT_TRUE(WaitForSubscribers(server, 1));
+
+  const auto start = std::chrono::steady_clock::now();
+  PackedGrid last;
+  for (std::uint32_t generation = 0; generation < 30; generation++) {
+    last = MakeRandomGrid(40, 100, 0.3, generation);
+    server.Publish(generation, last);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  // Expected
+  StreamFrame frame;
+  std::uint32_t frames_count = 0;
+  do {
+    ASSERT_TRUE(subscriber.ReceiveFrame(std::chrono::seconds(5), frame));
+    frames_count++;
+  } while (frame.generation != 29);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  // at most one frame per 100 ms, the first one is sent at once
+  EXPECT_LE(frames_count,
+            1 + std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                        .count() /
+                    100);
+  EXPECT_EQ(frame.cells, last);
+}
+
+TEST(FrameServerTest, SlowSubscriberTest) {
+  // Given
+  const std::string path = MakeSocketPath("slow");
+  FrameServerSettings settings;
+  settings.slow_subscriber_timeout = std::chrono::milliseconds(50);
+  FrameServer server(path, settings);
+  ASSERT_TRUE(server.Start());
+  // the subscriber never reads, keyframes are bigger than socket buffers
+  FrameSubscriber subscriber;
+  ASSERT_TRUE(subscriber.Connect(path, {0, 0, 0, 0, 0, 0}));
+  ASSERT_TRUE(WaitForSubscribers(server, 1));
+  const PackedGrid grid = MakeRandomGrid(2048, 2048, 0.3, 1);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::uint32_t generation = 0; generation < 50; generation++) {
+    server.Publish(generation, grid);
+  }
+  const auto publish_time = std::chrono::steady_clock::now() - start;
+
+  // Expected
+  EXPECT_LT(publish_time, std::chrono::seconds(1));
+  EXPECT_TRUE(WaitForSubscribers(server, 0));
+}
@@ -13,6 +13,7 @@ struct TestCase_GameOfLife {
   std::uint32_t rows;
   std::uint32_t columns;
   GameOfLifeInitialState initial_figure;
+  std::uint32_t threads_count;
   // expected
   std::uint32_t generations_count;
 };
@@ -28,19 +29,27 @@ INSTANTIATE_TEST_CASE_P(
     GameOfLifeTest, GameOfLifeTestFixture,
     ::testing::Values(
         TestCase_GameOfLife{"LineBigSceneTest", 100, 100,
-                            GameOfLifeInitialState::CenterLine, 2},
+                            GameOfLifeInitialState::CenterLine, 0, 2},
         TestCase_GameOfLife{"LineLittleSceneTest", 5, 5,
-                            GameOfLifeInitialState::CenterLine, 2},
+                            GameOfLifeInitialState::CenterLine, 0, 2},
         TestCase_GameOfLife{"PointBigSceneTest", 100, 100,
-                            GameOfLifeInitialState::CenterPoint, 1},
+                            GameOfLifeInitialState::CenterPoint, 0, 1},
         TestCase_GameOfLife{"PointLittleSceneTest", 5, 5,
-                            GameOfLifeInitialState::CenterPoint, 1}));
+                            GameOfLifeInitialState::CenterPoint, 0, 1},
+        TestCase_GameOfLife{"LineFourThreadsTest", 100, 100,
+                            GameOfLifeInitialState::CenterLine, 4, 2},
+        TestCase_GameOfLife{"LineSevenThreadsOddSizeTest", 13, 11,
+                            GameOfLifeInitialState::CenterLine, 7, 2},
+        TestCase_GameOfLife{"LineMoreThreadsThanRowsTest", 7, 9,
+                            GameOfLifeInitialState::CenterLine, 16, 2}));
 
 TEST_P(GameOfLifeTestFixture, GameOfLifeTest) {
   // Given
   auto param{GetParam()};
 
-  GameOfLife game(param.rows, param.columns);
+  GameOfLifeSettings settings;
+  settings.threads_count = param.threads_count;
+  GameOfLife game(param.rows, param.columns, settings);
   game.FillInitialPicture(param.initial_figure);
 
   while (!game.IsGameOver()) {
@@ -50,3 +59,21 @@ TEST_P(GameOfLifeTestFixture, GameOfLifeTest) {
 
   EXPECT_EQ(generations_count, param.generations_count);
 }
+
+TEST(GameOfLifeTest, NumaPlacementTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 3;
+  settings.numa_placement = true;
+  GameOfLife game(50, 40, settings);
+  game.FillInitialPicture(GameOfLifeInitialState::CenterLine);
+
+  std::uint32_t generations_count = 0;
+  while (!game.IsGameOver()) {
+    game.ExecuteNextGeneration();
+    generations_count++;
+  }
+
+  // Expected
+  EXPECT_EQ(generations_count, 2);
+}
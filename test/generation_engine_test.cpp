@@ -0,0 +1,209 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/lookup_table_engine.h"
+#include "engine/temporal_blocking_engine.h"
+#include "game_of_life.h"
+#include "rules/conway_rules.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+/// Conway rules: birth on 3, survival on 2 and 3
+constexpr std::uint32_t cConwayBirthMask = 1 << 3;
+constexpr std::uint32_t cConwaySurvivalMask = (1 << 2) | (1 << 3);
+} // namespace
+
+struct TestCase_GenerationEngine {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::uint32_t tile_rows;
+  std::uint32_t depth;
+  std::uint32_t generations;
+};
+
+class GenerationEngineTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_GenerationEngine> {};
+
+INSTANTIATE_TEST_CASE_P(
+    GenerationEngineTest, GenerationEngineTestFixture,
+    ::testing::Values(
+        TestCase_GenerationEngine{"RingSmallTest", 5, 7,
+                                  CellBordersRule::RingBorders, 2, 3, 10},
+        TestCase_GenerationEngine{"RingWordBorderTest", 20, 64,
+                                  CellBordersRule::RingBorders, 8, 4, 9},
+        TestCase_GenerationEngine{"RingSeveralWordsTest", 37, 130,
+                                  CellBordersRule::RingBorders, 10, 8, 25},
+        TestCase_GenerationEngine{"RingDepthBiggerThanWorldTest", 6, 70,
+                                  CellBordersRule::RingBorders, 4, 16, 17},
+        TestCase_GenerationEngine{"LimitedSmallTest", 5, 7,
+                                  CellBordersRule::LimitedBorders, 2, 3, 10},
+        TestCase_GenerationEngine{"LimitedSeveralWordsTest", 37, 130,
+                                  CellBordersRule::LimitedBorders, 10, 8, 25},
+        TestCase_GenerationEngine{"LimitedOneTileTest", 16, 100,
+                                  CellBordersRule::LimitedBorders, 64, 5, 12}));
+
+TEST_P(GenerationEngineTestFixture, GenerationEngineTest) {
+  // Given
+  auto param{GetParam()};
+  const TotalisticRuleTable rule_table(cConwayBirthMask, cConwaySurvivalMask,
+                                       param.borders_rule);
+  TemporalBlockingEngine engine(rule_table, param.columns, param.tile_rows,
+                                param.depth);
+  BitSlicedKernel kernel(rule_table, param.columns);
+
+  PackedGrid blocked = MakeRandomGrid(param.rows, param.columns, 0.35);
+  PackedGrid by_kernel = blocked;
+  PackedGrid by_cell = blocked;
+  PackedGrid kernel_next(param.rows, param.columns);
+
+  engine.Step(blocked, param.generations);
+  for (std::uint32_t generation = 0; generation < param.generations;
+       generation++) {
+    kernel.StepGrid(by_kernel, kernel_next);
+    std::swap(by_kernel, kernel_next);
+    by_cell = StepCellByCell(by_cell, rule_table);
+  }
+
+  // Expected
+  EXPECT_TRUE(by_kernel == by_cell);
+  EXPECT_TRUE(blocked == by_cell);
+}
+
+TEST(GenerationEngineTest, StepGenerationsTest) {
+  // Given
+  constexpr std::uint32_t rows = 30;
+  constexpr std::uint32_t columns = 70;
+  const PackedGrid initial_grid = MakeRandomGrid(rows, columns, 0.35);
+  std::vector<Point> alive_cells;
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      if (initial_grid.Get(row, column)) {
+        alive_cells.push_back({row, column});
+      }
+    }
+  }
+
+  GameOfLifeSettings settings;
+  settings.threads_count = 2;
+  settings.temporal_tile_rows = 7;
+  settings.temporal_depth = 3;
+  GameOfLife stepped_game(rows, columns, settings);
+  GameOfLife blocked_game(rows, columns, settings);
+  stepped_game.FillInitialPicture(alive_cells);
+  blocked_game.FillInitialPicture(alive_cells);
+
+  for (std::uint32_t generation = 0; generation < 11; generation++) {
+    stepped_game.ExecuteNextGeneration();
+  }
+  blocked_game.StepGenerations(4);
+  blocked_game.StepGenerations(7);
+
+  // Expected
+  EXPECT_TRUE(stepped_game.GetPackedCells() == blocked_game.GetPackedCells());
+}
+
+struct TestCase_LookupTableEngine {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::uint32_t generations;
+};
+
+class LookupTableEngineTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_LookupTableEngine> {};
+
+INSTANTIATE_TEST_CASE_P(
+    LookupTableEngineTest, LookupTableEngineTestFixture,
+    ::testing::Values(
+        TestCase_LookupTableEngine{"RingEvenTest", 8, 10,
+                                   CellBordersRule::RingBorders, 10},
+        TestCase_LookupTableEngine{"RingOddTest", 7, 9,
+                                   CellBordersRule::RingBorders, 10},
+        TestCase_LookupTableEngine{"RingSeveralWordsOddTest", 33, 129,
+                                   CellBordersRule::RingBorders, 15},
+        TestCase_LookupTableEngine{"RingWordBorderTest", 12, 62,
+                                   CellBordersRule::RingBorders, 9},
+        TestCase_LookupTableEngine{"LimitedOddTest", 7, 9,
+                                   CellBordersRule::LimitedBorders, 10},
+        TestCase_LookupTableEngine{"LimitedSeveralWordsTest", 34, 130,
+                                   CellBordersRule::LimitedBorders, 15}));
+
+TEST_P(LookupTableEngineTestFixture, LookupTableEngineTest) {
+  // Given
+  auto param{GetParam()};
+  const TotalisticRuleTable rule_table(cConwayBirthMask, cConwaySurvivalMask,
+                                       param.borders_rule);
+  LookupTableEngine engine(rule_table);
+  PackedGrid by_table = MakeRandomGrid(param.rows, param.columns, 0.35);
+  PackedGrid by_cell = by_table;
+
+  engine.Step(by_table, param.generations);
+  for (std::uint32_t generation = 0; generation < param.generations;
+       generation++) {
+    by_cell = StepCellByCell(by_cell, rule_table);
+  }
+
+  // Expected
+  EXPECT_TRUE(by_table == by_cell);
+}
+
+TEST(LookupTableEngineTest, TableFromConwayRulesTest) {
+  // Given
+  const ConwayRules rules;
+  LookupTableEngine engine{TotalisticRuleTable(rules)};
+
+  // Expected
+  // empty neighbourhood stays empty
+  EXPECT_EQ(engine.GetBlockState(0), 0);
+  // block (cells 5, 6, 9, 10) survives
+  EXPECT_EQ(engine.GetBlockState((1 << 5) | (1 << 6) | (1 << 9) | (1 << 10)),
+            0xF);
+  // horizontal blinker in row 1 gives vertical blinker in column 1
+  EXPECT_EQ(engine.GetBlockState((1 << 4) | (1 << 5) | (1 << 6)),
+            (1 << 0) | (1 << 2));
+}
+
+TEST(LookupTableEngineTest, GameOfLifeEngineTest) {
+  // Given
+  constexpr std::uint32_t rows = 25;
+  constexpr std::uint32_t columns = 67;
+  const PackedGrid initial_grid = MakeRandomGrid(rows, columns, 0.35);
+  std::vector<Point> alive_cells;
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      if (initial_grid.Get(row, column)) {
+        alive_cells.push_back({row, column});
+      }
+    }
+  }
+
+  GameOfLife per_cell_game(rows, columns);
+  GameOfLifeSettings settings;
+  settings.engine = GenerationEngineType::LookupTable;
+  GameOfLife table_game(rows, columns, settings);
+  per_cell_game.FillInitialPicture(alive_cells);
+  table_game.FillInitialPicture(alive_cells);
+
+  for (std::uint32_t generation = 0; generation < 12; generation++) {
+    per_cell_game.ExecuteNextGeneration();
+    table_game.ExecuteNextGeneration();
+  }
+  table_game.StepGenerations(5);
+  for (std::uint32_t generation = 0; generation < 5; generation++) {
+    per_cell_game.ExecuteNextGeneration();
+  }
+
+  // Expected
+  EXPECT_TRUE(per_cell_game.GetPackedCells() == table_game.GetPackedCells());
+  EXPECT_EQ(per_cell_game.IsGameOver(), table_game.IsGameOver());
+}
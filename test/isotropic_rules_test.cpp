@@ -0,0 +1,169 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/lookup_table_engine.h"
+#include "game_of_life.h"
+#include "rules/conway_rules.h"
+#include "rules/isotropic_rules.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+struct TestCase_IsotropicParse {
+  std::string name;
+  // set up inputs
+  std::string rule;
+  // expected outputs
+  bool is_parsed;
+  std::uint32_t states_count;
+};
+
+class IsotropicParseTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_IsotropicParse> {};
+
+INSTANTIATE_TEST_CASE_P(
+    IsotropicParseTest, IsotropicParseTestFixture,
+    ::testing::Values(
+        // 2 of 28 pairs of neighbours are opposite corners
+        TestCase_IsotropicParse{"OppositeCornersTest", "B2n/S", true, 2},
+        TestCase_IsotropicParse{"EdgeTest", "B1e/S", true, 4},
+        TestCase_IsotropicParse{"ExcludedTest", "B/S3-c", true, 52},
+        TestCase_IsotropicParse{"AllCountsTest", "B012345678/S", true, 256},
+        TestCase_IsotropicParse{"InverseTest", "B/S7c", true, 4},
+        TestCase_IsotropicParse{"UpperCaseTest", "b2N/s", true, 2},
+        TestCase_IsotropicParse{"WrongLetterTest", "B1k/S", false, 0},
+        TestCase_IsotropicParse{"WrongCountTest", "B9/S", false, 0},
+        TestCase_IsotropicParse{"EmptyExclusionTest", "B3-/S", false, 0},
+        TestCase_IsotropicParse{"NoSeparatorTest", "B3S23", false, 0}));
+
+TEST_P(IsotropicParseTestFixture, IsotropicParseTest) {
+  // Given
+  auto param{GetParam()};
+  std::bitset<512> states;
+
+  // Expected
+  ASSERT_EQ(IsotropicRules::ParseRule(param.rule, states), param.is_parsed);
+  if (param.is_parsed) {
+    EXPECT_EQ(states.count(), param.states_count);
+  }
+}
+
+TEST(IsotropicRulesTest, LettersPartitionCountsTest) {
+  const std::string letters[9] = {"",           "ce",        "ceaikn",
+                                  "ceaiknjqry", "ceaiknjqrytwz",
+                                  "ceaiknjqry", "ceaikn",    "ce",
+                                  ""};
+  for (std::uint32_t count = 1; count < 8; count++) {
+    // Given
+    std::bitset<512> all_states;
+    std::bitset<512> count_states;
+    ASSERT_TRUE(IsotropicRules::ParseRule(
+        "B" + std::to_string(count) + "/S", count_states));
+    for (const char letter : letters[count]) {
+      std::bitset<512> states;
+      ASSERT_TRUE(IsotropicRules::ParseRule(
+          "B" + std::to_string(count) + letter + "/S", states));
+
+      // Expected
+      EXPECT_TRUE((all_states & states).none()) << count << letter;
+      all_states |= states;
+    }
+    EXPECT_EQ(all_states, count_states) << count;
+  }
+}
+
+TEST(IsotropicRulesTest, ConwayTableTest) {
+  // Given
+  std::bitset<512> states;
+  ASSERT_TRUE(IsotropicRules::ParseRule("B3/S23", states));
+  const NeighbourhoodRuleTable parsed(states, CellBordersRule::RingBorders);
+  const NeighbourhoodRuleTable conway{ConwayRules()};
+
+  // Expected
+  EXPECT_TRUE(parsed.IsTotalistic());
+  for (std::uint32_t neighbourhood = 0;
+       neighbourhood < NeighbourhoodRuleTable::cTableSize; neighbourhood++) {
+    EXPECT_EQ(parsed.GetNewCellState(neighbourhood),
+              conway.GetNewCellState(neighbourhood));
+  }
+}
+
+struct TestCase_IsotropicEngine {
+  std::string name;
+  // set up inputs
+  std::string rule;
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::uint32_t generations;
+};
+
+class IsotropicEngineTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_IsotropicEngine> {};
+
+INSTANTIATE_TEST_CASE_P(
+    IsotropicEngineTest, IsotropicEngineTestFixture,
+    ::testing::Values(
+        TestCase_IsotropicEngine{"RingTest", "B2n3/S23-q", 20, 70,
+                                 CellBordersRule::RingBorders, 12},
+        TestCase_IsotropicEngine{"RingOddTest", "B2ci3ai/S1c2-a3", 13, 65,
+                                 CellBordersRule::RingBorders, 10},
+        TestCase_IsotropicEngine{"LimitedTest", "B2e3/S2-i34t", 17, 130,
+                                 CellBordersRule::LimitedBorders, 12}));
+
+TEST_P(IsotropicEngineTestFixture, IsotropicEngineTest) {
+  // Given
+  auto param{GetParam()};
+  std::bitset<512> states;
+  ASSERT_TRUE(IsotropicRules::ParseRule(param.rule, states));
+  const NeighbourhoodRuleTable rule_table(states, param.borders_rule);
+  LookupTableEngine engine(rule_table);
+  PackedGrid by_engine = MakeRandomGrid(param.rows, param.columns, 0.35);
+  PackedGrid by_cell = by_engine;
+
+  engine.Step(by_engine, param.generations);
+  for (std::uint32_t generation = 0; generation < param.generations;
+       generation++) {
+    by_cell = StepCellByCell(by_cell, rule_table);
+  }
+
+  // Expected
+  EXPECT_FALSE(rule_table.IsTotalistic());
+  EXPECT_TRUE(by_engine == by_cell);
+}
+
+TEST(IsotropicRulesTest, GameTest) {
+  // Given
+  constexpr std::uint32_t rows = 24;
+  constexpr std::uint32_t columns = 40;
+  const PackedGrid grid = MakeRandomGrid(rows, columns, 0.35);
+  std::vector<Point> alive_cells;
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      if (grid.Get(row, column)) {
+        alive_cells.push_back({row, column});
+      }
+    }
+  }
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.rule = "B2n3/S23-q";
+  GameOfLife game(rows, columns, settings);
+  game.FillInitialPicture(alive_cells);
+
+  std::bitset<512> states;
+  ASSERT_TRUE(IsotropicRules::ParseRule(settings.rule, states));
+  const NeighbourhoodRuleTable rule_table(states,
+                                          CellBordersRule::RingBorders);
+  PackedGrid by_cell = grid;
+  for (std::uint32_t generation = 0; generation < 5; generation++) {
+    game.ExecuteNextGeneration();
+    by_cell = StepCellByCell(by_cell, rule_table);
+  }
+
+  // Expected
+  EXPECT_TRUE(game.GetPackedCells() == by_cell);
+}
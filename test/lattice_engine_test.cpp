@@ -0,0 +1,181 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/lattice_engine.h"
+#include "game_of_life.h"
+#include "rules/lattice_rules.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+struct TestCase_LatticeEngine {
+  std::string name;
+  // set up inputs
+  GridTopology topology;
+  std::string rule;
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::uint32_t generations;
+};
+
+class LatticeEngineTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_LatticeEngine> {};
+
+INSTANTIATE_TEST_CASE_P(
+    LatticeEngineTest, LatticeEngineTestFixture,
+    ::testing::Values(
+        TestCase_LatticeEngine{"HexagonalRingSmallTest",
+                               GridTopology::Hexagonal, "B2/S34", 6, 7,
+                               CellBordersRule::RingBorders, 10},
+        TestCase_LatticeEngine{"HexagonalRingSeveralWordsTest",
+                               GridTopology::Hexagonal, "B2/S34", 20, 130,
+                               CellBordersRule::RingBorders, 15},
+        TestCase_LatticeEngine{"HexagonalLimitedTest", GridTopology::Hexagonal,
+                               "B24/S3", 17, 64,
+                               CellBordersRule::LimitedBorders, 12},
+        TestCase_LatticeEngine{"TriangularRingSmallTest",
+                               GridTopology::Triangular, "B4/S345", 6, 8,
+                               CellBordersRule::RingBorders, 10},
+        TestCase_LatticeEngine{"TriangularRingSeveralWordsTest",
+                               GridTopology::Triangular, "B46/S3456", 22, 130,
+                               CellBordersRule::RingBorders, 15},
+        TestCase_LatticeEngine{"TriangularLimitedTest",
+                               GridTopology::Triangular, "B4a/S2c", 15, 63,
+                               CellBordersRule::LimitedBorders, 12}));
+
+TEST_P(LatticeEngineTestFixture, LatticeEngineTest) {
+  // Given
+  auto param{GetParam()};
+  std::uint32_t birth_mask = 0;
+  std::uint32_t survival_mask = 0;
+  ASSERT_TRUE(LatticeRules::ParseRule(param.rule, birth_mask, survival_mask));
+  const TotalisticRuleTable rule_table(birth_mask, survival_mask,
+                                       param.borders_rule, param.topology);
+  LatticeEngine engine(rule_table, param.columns);
+  PackedGrid by_engine = MakeRandomGrid(param.rows, param.columns);
+  PackedGrid by_cell = by_engine;
+
+  engine.Step(by_engine, param.generations);
+  for (std::uint32_t generation = 0; generation < param.generations;
+       generation++) {
+    by_cell = StepCellByCell(by_cell, rule_table);
+  }
+
+  // Expected
+  EXPECT_TRUE(by_engine == by_cell);
+}
+
+TEST_P(LatticeEngineTestFixture, WorldNeighboursTest) {
+  // Given
+  auto param{GetParam()};
+  std::uint32_t birth_mask = 0;
+  std::uint32_t survival_mask = 0;
+  ASSERT_TRUE(LatticeRules::ParseRule(param.rule, birth_mask, survival_mask));
+  const LatticeRules rules(param.topology, birth_mask, survival_mask,
+                           param.borders_rule);
+  const PackedGrid grid = MakeRandomGrid(param.rows, param.columns);
+  World world(param.rows, param.columns);
+  world.SetInitialCells(GetAliveCells(grid), rules);
+  const PackedGrid next = StepCellByCell(grid, TotalisticRuleTable(rules));
+
+  // Expected
+  for (std::uint32_t row = 0; row < param.rows; row++) {
+    for (std::uint32_t column = 0; column < param.columns; column++) {
+      EXPECT_EQ(rules.GetNewCellState(world.GetCellAt(row, column)),
+                next.Get(row, column));
+    }
+  }
+}
+
+TEST(LatticeEngineTest, GameEnginesAgreeTest) {
+  for (const GridTopology topology :
+       {GridTopology::Hexagonal, GridTopology::Triangular}) {
+    // Given
+    constexpr std::uint32_t rows = 24;
+    constexpr std::uint32_t columns = 70;
+    const std::vector<Point> alive_cells = MakeRandomCells(rows, columns);
+    GameOfLifeSettings settings;
+    settings.threads_count = 1;
+    settings.topology = topology;
+    GameOfLife per_cell_game(rows, columns, settings);
+    settings.engine = GenerationEngineType::LookupTable;
+    GameOfLife lattice_game(rows, columns, settings);
+    per_cell_game.FillInitialPicture(alive_cells);
+    lattice_game.FillInitialPicture(alive_cells);
+
+    for (std::uint32_t generation = 0; generation < 9; generation++) {
+      per_cell_game.ExecuteNextGeneration();
+    }
+    lattice_game.StepGenerations(9);
+
+    // Expected
+    EXPECT_TRUE(per_cell_game.GetPackedCells() ==
+                lattice_game.GetPackedCells());
+  }
+}
+
+struct TestCase_ParseRule {
+  std::string name;
+  // set up inputs
+  std::string rule;
+  // expected outputs
+  bool is_parsed;
+  std::uint32_t birth_mask;
+  std::uint32_t survival_mask;
+};
+
+class ParseRuleTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_ParseRule> {};
+
+INSTANTIATE_TEST_CASE_P(
+    ParseRuleTest, ParseRuleTestFixture,
+    ::testing::Values(
+        TestCase_ParseRule{"ConwayTest", "B3/S23", true, 1 << 3,
+                           (1 << 2) | (1 << 3)},
+        TestCase_ParseRule{"SurvivalFirstTest", "s34/b2", true, 1 << 2,
+                           (1 << 3) | (1 << 4)},
+        TestCase_ParseRule{"LettersTest", "B4a/Sc", true, (1 << 4) | (1 << 10),
+                           1 << 12},
+        TestCase_ParseRule{"EmptyCountsTest", "B/S", true, 0, 0},
+        TestCase_ParseRule{"NoSeparatorTest", "B3S23", false, 0, 0},
+        TestCase_ParseRule{"WrongDigitTest", "B3/S2x", false, 0, 0},
+        TestCase_ParseRule{"TwiceBirthTest", "B3/B2", false, 0, 0}));
+
+TEST_P(ParseRuleTestFixture, ParseRuleTest) {
+  // Given
+  auto param{GetParam()};
+  std::uint32_t birth_mask = 0;
+  std::uint32_t survival_mask = 0;
+
+  // Expected
+  ASSERT_EQ(LatticeRules::ParseRule(param.rule, birth_mask, survival_mask),
+            param.is_parsed);
+  if (param.is_parsed) {
+    EXPECT_EQ(birth_mask, param.birth_mask);
+    EXPECT_EQ(survival_mask, param.survival_mask);
+  }
+}
+
+TEST(LatticeRulesTest, FactoryTopologyTest) {
+  // Given
+  const auto square = GameRulesFactory::MakeGameRules(GridTopology::Square);
+  const auto hexagonal =
+      GameRulesFactory::MakeGameRules(GridTopology::Hexagonal);
+  const auto triangular =
+      GameRulesFactory::MakeGameRules(GridTopology::Triangular, "B45/S34");
+
+  // Expected
+  EXPECT_EQ(square->GetTopology(), GridTopology::Square);
+  EXPECT_TRUE(square->GetNewCellState(false, 3));
+  EXPECT_EQ(hexagonal->GetTopology(), GridTopology::Hexagonal);
+  EXPECT_TRUE(hexagonal->GetNewCellState(false, 2));
+  EXPECT_FALSE(hexagonal->GetNewCellState(true, 2));
+  EXPECT_EQ(triangular->GetTopology(), GridTopology::Triangular);
+  EXPECT_TRUE(triangular->GetNewCellState(false, 5));
+  EXPECT_EQ(GridNeighbourhood::GetNeighboursCount(GridTopology::Triangular),
+            12);
+}
@@ -0,0 +1,237 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "continuous/lenia_engine.h"
+#include "game_of_life.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace {
+std::vector<double> MakeRandomValues(const std::uint32_t count) {
+  std::mt19937 generator(count);
+  std::uniform_real_distribution<double> value(0, 1);
+  std::vector<double> values(count);
+  for (auto &item : values) {
+    item = value(generator);
+  }
+  return values;
+}
+
+/// circular convolution of the values with the kernel by definition
+std::vector<double> Convolve(const std::vector<double> &values,
+                             const std::vector<double> &kernel,
+                             const std::uint32_t rows,
+                             const std::uint32_t columns) {
+  std::vector<double> result(values.size(), 0);
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      for (std::uint32_t k_row = 0; k_row < rows; k_row++) {
+        for (std::uint32_t k_column = 0; k_column < columns; k_column++) {
+          const std::uint32_t source_row = (row + rows - k_row) % rows;
+          const std::uint32_t source_column =
+              (column + columns - k_column) % columns;
+          result[row * columns + column] +=
+              values[source_row * columns + source_column] *
+              kernel[k_row * columns + k_column];
+        }
+      }
+    }
+  }
+  return result;
+}
+} // namespace
+
+struct TestCase_Fft {
+  std::string name;
+  // set up inputs
+  std::uint32_t length;
+};
+
+class FftTestFixture : public ::testing::Test,
+                       public ::testing::WithParamInterface<TestCase_Fft> {};
+
+INSTANTIATE_TEST_CASE_P(FftTest, FftTestFixture,
+                        ::testing::Values(TestCase_Fft{"OneTest", 1},
+                                          TestCase_Fft{"PowerOfTwoTest", 16},
+                                          TestCase_Fft{"EvenTest", 12},
+                                          TestCase_Fft{"PrimeTest", 17}));
+
+TEST_P(FftTestFixture, FftTest) {
+  // Given
+  auto param{GetParam()};
+  const std::vector<double> real = MakeRandomValues(param.length);
+  const std::vector<double> imaginary = MakeRandomValues(param.length + 1);
+  std::vector<Complex> values(param.length);
+  for (std::uint32_t index = 0; index < param.length; index++) {
+    values[index] = Complex(real[index], imaginary[index]);
+  }
+  const Fft fft(param.length);
+  std::vector<Complex> scratch;
+  std::vector<Complex> spectrum = values;
+  fft.Transform(spectrum.data(), false, scratch);
+  std::vector<Complex> restored = spectrum;
+  fft.Transform(restored.data(), true, scratch);
+
+  // Expected
+  const double pi = std::acos(-1.0);
+  for (std::uint32_t frequency = 0; frequency < param.length; frequency++) {
+    Complex expected(0, 0);
+    for (std::uint32_t index = 0; index < param.length; index++) {
+      expected += values[index] *
+                  std::polar(1.0, -2 * pi * frequency * index / param.length);
+    }
+    EXPECT_NEAR(std::abs(spectrum[frequency] - expected), 0, 1e-9);
+    EXPECT_NEAR(std::abs(restored[frequency] / double(param.length) -
+                         values[frequency]),
+                0, 1e-9);
+  }
+}
+
+struct TestCase_RealFft2d {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  std::uint32_t threads_count;
+};
+
+class RealFft2dTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_RealFft2d> {};
+
+INSTANTIATE_TEST_CASE_P(
+    RealFft2dTest, RealFft2dTestFixture,
+    ::testing::Values(TestCase_RealFft2d{"EvenTest", 8, 16, 1},
+                      TestCase_RealFft2d{"OddTest", 7, 9, 1},
+                      TestCase_RealFft2d{"ThreadsTest", 6, 10, 3},
+                      TestCase_RealFft2d{"OneRowTest", 1, 5, 2}));
+
+TEST_P(RealFft2dTestFixture, ConvolutionTest) {
+  // Given
+  auto param{GetParam()};
+  const std::uint32_t size = param.rows * param.columns;
+  const std::vector<double> values = MakeRandomValues(size);
+  const std::vector<double> kernel = MakeRandomValues(size + 1);
+  RealFft2d fft(param.rows, param.columns, param.threads_count);
+  std::vector<Complex> spectrum, kernel_spectrum;
+  fft.Forward(values.data(), spectrum);
+  fft.Forward(kernel.data(), kernel_spectrum);
+  for (std::size_t index = 0; index < spectrum.size(); index++) {
+    spectrum[index] *= kernel_spectrum[index];
+  }
+  std::vector<double> result(size);
+  fft.Inverse(spectrum, result.data());
+
+  // Expected
+  const std::vector<double> expected =
+      Convolve(values, kernel, param.rows, param.columns);
+  for (std::uint32_t index = 0; index < size; index++) {
+    EXPECT_NEAR(result[index], expected[index], 1e-9);
+  }
+}
+
+TEST(LeniaEngineTest, PotentialTest) {
+  // Given
+  constexpr std::uint32_t rows = 20;
+  constexpr std::uint32_t columns = 24;
+  LeniaSettings settings;
+  settings.radius = 4;
+  settings.peaks = {0.5, 1};
+  LeniaEngine engine(rows, columns, settings);
+  const std::vector<double> values = MakeRandomValues(rows * columns);
+  engine.GetWorld().GetCells() = values;
+  engine.StepWorld();
+
+  // Expected the potential is the weighted mean of cells around
+  std::vector<double> kernel(rows * columns, 0);
+  double sum = 0;
+  for (std::int32_t d_row = -4; d_row <= 4; d_row++) {
+    for (std::int32_t d_column = -4; d_column <= 4; d_column++) {
+      const double weight = LeniaEngine::GetKernelWeight(
+          std::sqrt(d_row * d_row + d_column * d_column) / 4, settings.peaks);
+      const std::uint32_t k_row = (d_row + rows) % rows;
+      const std::uint32_t k_column = (d_column + columns) % columns;
+      kernel[k_row * columns + k_column] = weight;
+      sum += weight;
+    }
+  }
+  for (auto &weight : kernel) {
+    weight /= sum;
+  }
+  const std::vector<double> expected = Convolve(values, kernel, rows, columns);
+  for (std::uint32_t index = 0; index < rows * columns; index++) {
+    EXPECT_NEAR(engine.GetPotentials()[index], expected[index], 1e-9);
+    const double offset = expected[index] - settings.growth_center;
+    const double growth =
+        2 * std::exp(-offset * offset / (2 * settings.growth_width *
+                                         settings.growth_width)) -
+        1;
+    EXPECT_NEAR(engine.GetWorld().GetCells()[index],
+                std::min(1.0, std::max(0.0, values[index] +
+                                                settings.time_step * growth)),
+                1e-9);
+  }
+}
+
+TEST(LeniaEngineTest, ThreadsGiveSameWorldTest) {
+  // Given
+  constexpr std::uint32_t rows = 48;
+  constexpr std::uint32_t columns = 40;
+  const std::vector<double> values = MakeRandomValues(rows * columns);
+  LeniaEngine single(rows, columns, LeniaSettings(), 1);
+  LeniaEngine threaded(rows, columns, LeniaSettings(), 4);
+  single.GetWorld().GetCells() = values;
+  threaded.GetWorld().GetCells() = values;
+  for (std::uint32_t generation = 0; generation < 3; generation++) {
+    single.StepWorld();
+    threaded.StepWorld();
+  }
+
+  // Expected
+  EXPECT_EQ(single.GetWorld().GetCells(), threaded.GetWorld().GetCells());
+}
+
+TEST(LeniaEngineTest, GameTest) {
+  // Given
+  constexpr std::uint32_t rows = 64;
+  constexpr std::uint32_t columns = 64;
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.engine = GenerationEngineType::Continuous;
+  GameOfLife game(rows, columns, settings);
+  std::vector<Point> alive_cells;
+  for (std::uint32_t row = 24; row < 40; row++) {
+    for (std::uint32_t column = 26; column < 38; column++) {
+      alive_cells.push_back({row, column});
+    }
+  }
+  game.FillInitialPicture(alive_cells);
+  ASSERT_NE(game.GetContinuousWorld(), nullptr);
+
+  game.StepGenerations(3);
+  game.ExecuteNextGeneration();
+
+  // Expected packed cells are the alive projection of continuous cells
+  const ContinuousWorld &world = *game.GetContinuousWorld();
+  EXPECT_EQ(game.GetGenerationsCount(), 4);
+  EXPECT_GT(world.GetMass(), 0);
+  EXPECT_LT(world.GetMass(), alive_cells.size());
+  const PackedGrid region = game.QueryRegion({0, 0, rows, columns});
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      EXPECT_EQ(region.Get(row, column),
+                world.Get(row, column) >= settings.lenia.alive_level);
+    }
+  }
+}
+
+TEST(LeniaEngineTest, NotContinuousGameTest) {
+  // Given
+  GameOfLife game(8, 8);
+
+  // Expected
+  EXPECT_EQ(game.GetContinuousWorld(), nullptr);
+}
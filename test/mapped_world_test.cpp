@@ -0,0 +1,167 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/bit_sliced_kernel.h"
+#include "memory/mapped_world.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+namespace {
+std::string GetWorldPath(const std::string &name) {
+  return ::testing::TempDir() + "mapped_world_" + name + ".bin";
+}
+
+void ExpectCells(const MappedWorld &world, const PackedGrid &cells) {
+  for (std::uint32_t row = 0; row < cells.GetRowCount(); row++) {
+    for (std::uint32_t column = 0; column < cells.GetColumnCount();
+         column++) {
+      ASSERT_EQ(world.Get(row, column), cells.Get(row, column))
+          << "row " << row << " column " << column;
+    }
+  }
+}
+} // namespace
+
+struct TestCase_MappedWorld {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::uint32_t readahead_rows;
+};
+
+class MappedWorldTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_MappedWorld> {};
+
+INSTANTIATE_TEST_CASE_P(
+    MappedWorldTest, MappedWorldTestFixture,
+    ::testing::Values(
+        TestCase_MappedWorld{"RingTest", 40, 100, CellBordersRule::RingBorders,
+                             0},
+        TestCase_MappedWorld{"LimitedTest", 40, 100,
+                             CellBordersRule::LimitedBorders, 0},
+        TestCase_MappedWorld{"SmallWindowRingTest", 700, 130,
+                             CellBordersRule::RingBorders, 3},
+        TestCase_MappedWorld{"SmallWindowLimitedTest", 700, 130,
+                             CellBordersRule::LimitedBorders, 5},
+        TestCase_MappedWorld{"ReleasedPagesTest", 300, 2000,
+                             CellBordersRule::RingBorders, 20},
+        TestCase_MappedWorld{"OneRowTest", 1, 64, CellBordersRule::RingBorders,
+                             0}));
+
+TEST_P(MappedWorldTestFixture, StepTest) {
+  // Given
+  auto param{GetParam()};
+  const TotalisticRuleTable rule_table(1 << 3, (1 << 2) | (1 << 3),
+                                       param.borders_rule);
+  const std::string path = GetWorldPath(param.name);
+  std::unique_ptr<MappedWorld> world = MappedWorld::Create(
+      path, param.rows, param.columns, param.readahead_rows);
+  ASSERT_NE(world, nullptr);
+  PackedGrid cells(param.rows, param.columns);
+  std::mt19937 generator(param.rows + param.columns);
+  std::bernoulli_distribution is_alive(0.35);
+  for (std::uint32_t row = 0; row < param.rows; row++) {
+    for (std::uint32_t column = 0; column < param.columns; column++) {
+      const bool alive = is_alive(generator);
+      cells.Set(row, column, alive);
+      world->Set(row, column, alive);
+    }
+  }
+  const BitSlicedKernel kernel(rule_table, param.columns);
+  PackedGrid next(param.rows, param.columns);
+
+  // Expected
+  for (std::uint32_t generation = 0; generation < 6; generation++) {
+    ASSERT_TRUE(world->Step(rule_table, 1));
+    kernel.StepGrid(cells, next);
+    std::swap(cells, next);
+    ExpectCells(*world, cells);
+  }
+  EXPECT_EQ(world->CountAlive(), cells.CountAlive());
+  EXPECT_EQ(world->GetGenerationsCount(), 6);
+  world.reset();
+  std::remove(path.c_str());
+}
+
+TEST(MappedWorldTest, ReopenTest) {
+  // Given
+  const std::string path = GetWorldPath("reopen");
+  const TotalisticRuleTable rule_table(1 << 3, (1 << 2) | (1 << 3),
+                                       CellBordersRule::RingBorders);
+  {
+    std::unique_ptr<MappedWorld> world = MappedWorld::Create(path, 10, 10);
+    ASSERT_NE(world, nullptr);
+    // blinker
+    world->Set(5, 4, true);
+    world->Set(5, 5, true);
+    world->Set(5, 6, true);
+    ASSERT_TRUE(world->Step(rule_table, 3));
+  }
+  std::unique_ptr<MappedWorld> world = MappedWorld::Open(path);
+
+  // Expected the vertical blinker and generations are kept in the file
+  ASSERT_NE(world, nullptr);
+  EXPECT_EQ(world->GetRowCount(), 10);
+  EXPECT_EQ(world->GetColumnCount(), 10);
+  EXPECT_EQ(world->GetGenerationsCount(), 3);
+  EXPECT_EQ(world->CountAlive(), 3);
+  EXPECT_TRUE(world->Get(4, 5));
+  EXPECT_TRUE(world->Get(5, 5));
+  EXPECT_TRUE(world->Get(6, 5));
+  world.reset();
+  std::remove(path.c_str());
+}
+
+TEST(MappedWorldTest, InvalidFileTest) {
+  // Given
+  const std::string path = GetWorldPath("invalid");
+  {
+    std::ofstream file(path);
+    file << "not a world";
+  }
+  const TotalisticRuleTable hexagonal_table(1 << 2, (1 << 3) | (1 << 4),
+                                            CellBordersRule::RingBorders,
+                                            GridTopology::Hexagonal);
+
+  // Expected
+  EXPECT_EQ(MappedWorld::Open(path), nullptr);
+  EXPECT_EQ(MappedWorld::Open(GetWorldPath("missing")), nullptr);
+  std::unique_ptr<MappedWorld> world = MappedWorld::Create(path, 4, 4);
+  ASSERT_NE(world, nullptr);
+  EXPECT_FALSE(world->Step(hexagonal_table, 1));
+  world.reset();
+  std::remove(path.c_str());
+}
+
+TEST(MappedWorldTest, UnfinishedStepTest) {
+  // Given
+  const std::string path = GetWorldPath("unfinished");
+  const TotalisticRuleTable rule_table(1 << 3, (1 << 2) | (1 << 3),
+                                       CellBordersRule::RingBorders);
+  {
+    std::unique_ptr<MappedWorld> world = MappedWorld::Create(path, 10, 10);
+    ASSERT_NE(world, nullptr);
+    ASSERT_TRUE(world->Step(rule_table, 2));
+  }
+  ASSERT_NE(MappedWorld::Open(path), nullptr);
+  // mark of a sweep follows magic, rows, columns and generations count
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    const std::uint32_t is_stepping = 1;
+    file.seekp(24);
+    file.write(reinterpret_cast<const char *>(&is_stepping),
+               sizeof(is_stepping));
+  }
+
+  // Expected the file with rows of two generations is not opened
+  EXPECT_EQ(MappedWorld::Open(path), nullptr);
+  std::remove(path.c_str());
+}
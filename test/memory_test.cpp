@@ -0,0 +1,53 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020, Bayerische Motoren Werke Aktiengesellschaft
+/// (BMW AG)
+///
+#include "memory/cache_aligned_allocator.h"
+#include "memory/huge_page_buffer.h"
+#include "world_cells.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+TEST(HugePageBufferTest, SmallBufferUsesRegularPages) {
+  HugePageBuffer buffer(100);
+  ASSERT_NE(buffer.GetData(), nullptr);
+  EXPECT_EQ(buffer.GetSize(), 100);
+  EXPECT_EQ(buffer.GetMode(), HugePageMode::Disabled);
+  std::memset(buffer.GetData(), 1, buffer.GetSize());
+}
+
+TEST(HugePageBufferTest, LargeBufferIsRoundedToHugePage) {
+  constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+  HugePageBuffer buffer(huge_page_size + 1);
+  ASSERT_NE(buffer.GetData(), nullptr);
+  EXPECT_EQ(buffer.GetSize(), 2 * huge_page_size);
+  std::memset(buffer.GetData(), 1, buffer.GetSize());
+}
+
+TEST(CacheAlignedAllocatorTest, ElementsAreAligned) {
+  struct alignas(cCacheLineSize) Slot {
+    std::uint32_t value;
+  };
+  std::vector<Slot, CacheAlignedAllocator<Slot>> slots(5);
+  for (const auto &slot : slots) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&slot) % cCacheLineSize, 0);
+  }
+}
+
+TEST(WorldCellsTest, RowsAreAllocatedOnce) {
+  WorldCells cells(3, 7);
+  EXPECT_EQ(cells.size(), 3);
+  EXPECT_TRUE(cells[1].empty());
+
+  cells.AllocateRows(1, 2);
+  cells[1][6].MakeAlive();
+  cells.AllocateRows(0, 3);
+
+  EXPECT_EQ(cells[0].size(), 7);
+  EXPECT_TRUE(cells[1][6].IsAlive());
+  EXPECT_FALSE(cells[2][6].IsAlive());
+}
@@ -0,0 +1,83 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020, Bayerische Motoren Werke Aktiengesellschaft
+/// (BMW AG)
+///
+#include "metrics/metrics_exporter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+TEST(MetricsTest, PhaseTimeIsSummedOverThreads) {
+  GameMetrics metrics(2);
+  metrics.AddPhaseTime(GenerationPhase::Evaluation, 0,
+                       std::chrono::nanoseconds(100));
+  metrics.AddPhaseTime(GenerationPhase::Evaluation, 1,
+                       std::chrono::nanoseconds(50));
+  metrics.AddPhaseTime(GenerationPhase::UpdateHash,
+                       metrics.GetControlThreadNum(),
+                       std::chrono::nanoseconds(7));
+
+  EXPECT_EQ(metrics.GetControlThreadNum(), 2);
+  EXPECT_EQ(metrics.GetPhaseTime(GenerationPhase::Evaluation).count(), 150);
+  EXPECT_EQ(metrics.GetPhaseTime(GenerationPhase::UpdateHash).count(), 7);
+  EXPECT_EQ(metrics.GetPhaseTime(GenerationPhase::BarrierWait).count(), 0);
+}
+
+TEST(MetricsTest, JsonContainsCounters) {
+  GameMetrics metrics(1);
+  metrics.AddChangedCells(3);
+  metrics.AddChangedCells(4);
+  metrics.AddBusyTime(0, std::chrono::nanoseconds(10));
+  metrics.AddIdleTime(0, std::chrono::nanoseconds(20));
+  metrics.FinishGeneration(1, 5);
+
+  std::ostringstream stream;
+  metrics.WriteJson(stream);
+  const std::string json = stream.str();
+
+  EXPECT_NE(json.find("\"generations\":1"), std::string::npos);
+  EXPECT_NE(json.find("\"changed_cells_last\":7"), std::string::npos);
+  EXPECT_NE(json.find("\"hash_table_size\":5"), std::string::npos);
+  EXPECT_NE(json.find("\"busy_ns\":10,\"idle_ns\":20"), std::string::npos);
+}
+
+TEST(MetricsTest, PrometheusContainsCounters) {
+  GameMetrics metrics(1);
+  metrics.AddChangedCells(2);
+  metrics.FinishGeneration(3, 4);
+
+  std::ostringstream stream;
+  metrics.WritePrometheus(stream);
+  const std::string text = stream.str();
+
+  EXPECT_NE(text.find("game_of_life_generations_total 3"), std::string::npos);
+  EXPECT_NE(text.find("game_of_life_changed_cells_total 2"),
+            std::string::npos);
+  EXPECT_NE(text.find("game_of_life_hash_table_size 4"), std::string::npos);
+  EXPECT_NE(text.find("phase=\"barrier_wait\""), std::string::npos);
+}
+
+TEST(MetricsTest, ExporterRespectsPeriod) {
+  const std::string file_path = "metrics_test_output.json";
+  std::remove(file_path.c_str());
+
+  GameMetrics metrics(0);
+  MetricsExporter exporter(file_path, MetricsFormat::Json, 2);
+
+  metrics.FinishGeneration(1, 1);
+  EXPECT_FALSE(exporter.OnGeneration(metrics));
+  metrics.FinishGeneration(2, 2);
+  EXPECT_TRUE(exporter.OnGeneration(metrics));
+  metrics.FinishGeneration(3, 3);
+  EXPECT_FALSE(exporter.OnGeneration(metrics));
+
+  std::ifstream stream(file_path);
+  std::string json((std::istreambuf_iterator<char>(stream)),
+                   std::istreambuf_iterator<char>());
+  EXPECT_NE(json.find("\"generations\":2"), std::string::npos);
+  std::remove(file_path.c_str());
+}
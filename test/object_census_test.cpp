@@ -0,0 +1,210 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "census/object_census.h"
+#include "game_of_life.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+/// Conway rules: birth on 3, survival on 2 and 3
+constexpr std::uint32_t cConwayBirthMask = 1 << 3;
+constexpr std::uint32_t cConwaySurvivalMask = (1 << 2) | (1 << 3);
+
+///
+/// @brief The PlacedPattern is a pattern ('o' alive, '/' next row) with
+/// position of its top left corner, which could be outside of the world to
+/// wrap around ring borders
+///
+struct PlacedPattern {
+  std::int32_t row;
+  std::int32_t column;
+  std::string cells;
+};
+
+void PlacePattern(PackedGrid &grid, const PlacedPattern &pattern) {
+  const std::int32_t rows = grid.GetRowCount();
+  const std::int32_t columns = grid.GetColumnCount();
+  std::int32_t row = pattern.row, column = pattern.column;
+  for (const char symbol : pattern.cells) {
+    if (symbol == '/') {
+      row++;
+      column = pattern.column;
+      continue;
+    }
+    if (symbol == 'o') {
+      grid.Set((row + rows) % rows, (column + columns) % columns, true);
+    }
+    column++;
+  }
+}
+} // namespace
+
+struct TestCase_ObjectCensus {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  std::vector<PlacedPattern> patterns;
+  // expected
+  std::vector<std::pair<std::string, std::uint64_t>> census;
+};
+
+class ObjectCensusTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_ObjectCensus> {};
+
+INSTANTIATE_TEST_CASE_P(
+    ObjectCensusTest, ObjectCensusTestFixture,
+    ::testing::Values(
+        TestCase_ObjectCensus{"EmptyTest", 10, 10, CellBordersRule::RingBorders,
+                              {}, {}},
+        TestCase_ObjectCensus{
+            "CommonObjectsTest",
+            30,
+            100,
+            CellBordersRule::LimitedBorders,
+            {{1, 1, "oo/oo"},
+             {1, 10, "oo/oo"},
+             {1, 70, "oo/oo"},
+             {10, 5, "ooo"},
+             {10, 20, "o/o/o"},
+             {10, 62, ".o./..o/ooo"},
+             {20, 30, ".oo./o..o/.oo."},
+             {20, 60, ".o/o.o/o.o/.o"}},
+            {{"block", 3}, {"beehive", 2}, {"blinker", 2}, {"glider", 1}}},
+        TestCase_ObjectCensus{
+            "RotatedGliderTest",
+            20,
+            20,
+            CellBordersRule::LimitedBorders,
+            {{2, 2, "ooo/o../.o."}, {10, 10, "o.o/.oo/.o."}},
+            {{"glider", 2}}},
+        TestCase_ObjectCensus{"RingCornerBlockTest",
+                              10,
+                              70,
+                              CellBordersRule::RingBorders,
+                              {{-1, -1, "oo/oo"}, {4, 30, "ooo"}},
+                              {{"blinker", 1}, {"block", 1}}},
+        TestCase_ObjectCensus{"BiBlockTest",
+                              12,
+                              20,
+                              CellBordersRule::LimitedBorders,
+                              {{2, 2, "oo.oo/oo.oo"}, {7, 12, "oo/oo"}},
+                              {{"block", 3}}},
+        TestCase_ObjectCensus{"BlockBeehiveTest",
+                              12,
+                              12,
+                              CellBordersRule::RingBorders,
+                              {{1, 1, "oo/oo"}, {3, 4, ".o/o.o/o.o/.o"}},
+                              {{"beehive", 1}, {"block", 1}}},
+        TestCase_ObjectCensus{"WideRingWorldTest",
+                              20,
+                              500,
+                              CellBordersRule::RingBorders,
+                              {{-1, -1, "oo/oo"},
+                               {2, 63, "oo/oo"},
+                               {8, 190, "oo/oo"},
+                               {14, 319, "oo/oo"},
+                               {5, 255, "ooo"},
+                               {10, 444, ".o./..o/ooo"}},
+                              {{"block", 4}, {"blinker", 1}, {"glider", 1}}}));
+
+TEST_P(ObjectCensusTestFixture, ObjectCensusTest) {
+  // Given
+  auto param{GetParam()};
+  PackedGrid grid(param.rows, param.columns);
+  for (const auto &pattern : param.patterns) {
+    PlacePattern(grid, pattern);
+  }
+  ObjectCensus census(TotalisticRuleTable(
+      cConwayBirthMask, cConwaySurvivalMask, param.borders_rule));
+
+  const std::vector<CensusEntry> result = census.Take(grid);
+
+  // Expected
+  ASSERT_EQ(result.size(), param.census.size());
+  for (std::size_t index = 0; index < result.size(); index++) {
+    EXPECT_EQ(result[index].object.name, param.census[index].first);
+    EXPECT_EQ(result[index].count, param.census[index].second);
+  }
+}
+
+TEST(ObjectCensusTest, UnknownOscillatorTest) {
+  // Given
+  PackedGrid grid(40, 40);
+  // pentadecathlon is not in the table of common objects
+  PlacePattern(grid, {15, 15, "..o....o../oo.oooo.oo/..o....o.."});
+  ObjectCensus census(TotalisticRuleTable(cConwayBirthMask,
+                                          cConwaySurvivalMask,
+                                          CellBordersRule::RingBorders));
+  const std::size_t known_shapes_count = census.GetKnownShapesCount();
+
+  const std::vector<CensusEntry> result = census.Take(grid);
+
+  // Expected
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result[0].object.kind, ObjectKind::Oscillator);
+  EXPECT_EQ(result[0].object.period, 15);
+  EXPECT_EQ(result[0].object.name.substr(0, 5), "xp15_");
+  // all phases are added to the table, so the same object in another phase
+  // is found without simulation
+  EXPECT_GT(census.GetKnownShapesCount(), known_shapes_count + 1);
+}
+
+TEST(ObjectCensusTest, SpaceshipTest) {
+  // Given
+  PackedGrid grid(30, 30);
+  PlacePattern(grid, {10, 10, ".o..o/o..../o...o/oooo."});
+  ObjectCensus census(TotalisticRuleTable(cConwayBirthMask,
+                                          cConwaySurvivalMask,
+                                          CellBordersRule::RingBorders));
+
+  const std::vector<CensusEntry> result = census.Take(grid);
+
+  // Expected
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result[0].object.name, "lwss");
+  EXPECT_EQ(result[0].object.kind, ObjectKind::Spaceship);
+  EXPECT_EQ(result[0].object.period, 4);
+}
+
+TEST(ObjectCensusTest, GameOverCensusTest) {
+  // Given
+  GameOfLife game(20, 20);
+  // blinker and block, the game is over after 2 generations
+  game.FillInitialPicture(
+      std::vector<Point>{{5, 4}, {5, 5}, {5, 6}, {14, 14}, {14, 15}, {15, 14},
+                         {15, 15}});
+  while (!game.IsGameOver()) {
+    game.ExecuteNextGeneration();
+  }
+
+  const std::vector<CensusEntry> result = game.TakeCensus();
+
+  // Expected
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_EQ(result[0].object.name, "blinker");
+  EXPECT_EQ(result[0].object.kind, ObjectKind::Oscillator);
+  EXPECT_EQ(result[1].object.name, "block");
+  EXPECT_EQ(result[1].object.kind, ObjectKind::StillLife);
+}
+
+TEST(ObjectCensusTest, UnsupportedGameCensusTest) {
+  // Given
+  GameOfLifeSettings hexagonal_settings;
+  hexagonal_settings.topology = GridTopology::Hexagonal;
+  GameOfLife hexagonal_game(20, 20, hexagonal_settings);
+  GameOfLifeSettings isotropic_settings;
+  isotropic_settings.rule = "B2n3/S23-q";
+  GameOfLife isotropic_game(20, 20, isotropic_settings);
+  const std::vector<Point> block{{14, 14}, {14, 15}, {15, 14}, {15, 15}};
+  hexagonal_game.FillInitialPicture(block);
+  isotropic_game.FillInitialPicture(block);
+
+  // Expected objects are not classified with Conway rules
+  EXPECT_TRUE(hexagonal_game.TakeCensus().empty());
+  EXPECT_TRUE(isotropic_game.TakeCensus().empty());
+}
@@ -0,0 +1,194 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "initial_figures/pattern_library.h"
+
+#include <gtest/gtest.h>
+
+static_assert(PatternLibrary::cGosperGliderGun.rows == 9 &&
+                  PatternLibrary::cGosperGliderGun.columns == 36,
+              "Bounding box of a pattern is known at compile time");
+static_assert(PatternLibrary::cGlider.cells[2] == 7,
+              "Rows of a pattern are known at compile time");
+
+namespace {
+GameOfLifeSettings MakeSettings() {
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.engine = GenerationEngineType::LookupTable;
+  return settings;
+}
+
+/// cells of the transform by definition
+bool GetTransformedCell(const Pattern &pattern,
+                        const PatternTransform transform,
+                        const std::uint32_t row, const std::uint32_t column) {
+  const std::uint32_t last_row = pattern.rows - 1;
+  const std::uint32_t last_column = pattern.columns - 1;
+  std::uint32_t source_row = row, source_column = column;
+  switch (transform) {
+  case PatternTransform::Rotate90:
+    source_row = last_row - column;
+    source_column = row;
+    break;
+  case PatternTransform::Rotate180:
+    source_row = last_row - row;
+    source_column = last_column - column;
+    break;
+  case PatternTransform::Rotate270:
+    source_row = column;
+    source_column = last_column - row;
+    break;
+  case PatternTransform::FlipHorizontal:
+    source_column = last_column - column;
+    break;
+  case PatternTransform::FlipVertical:
+    source_row = last_row - row;
+    break;
+  case PatternTransform::Transpose:
+    source_row = column;
+    source_column = row;
+    break;
+  case PatternTransform::AntiTranspose:
+    source_row = last_row - column;
+    source_column = last_column - row;
+    break;
+  case PatternTransform::Identity:
+  default:
+    break;
+  }
+  return (pattern.cells[source_row] >> source_column) & 1;
+}
+} // namespace
+
+struct TestCase_PatternPeriod {
+  std::string name;
+  // set up inputs
+  Pattern pattern;
+  std::uint32_t period;
+  // expected shift of the pattern after the period
+  std::int32_t row_shift;
+  std::int32_t column_shift;
+};
+
+class PatternPeriodTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_PatternPeriod> {};
+
+INSTANTIATE_TEST_CASE_P(
+    PatternPeriodTest, PatternPeriodTestFixture,
+    ::testing::Values(
+        TestCase_PatternPeriod{"BlockTest", PatternLibrary::cBlock, 1, 0, 0},
+        TestCase_PatternPeriod{"LoafTest", PatternLibrary::cLoaf, 1, 0, 0},
+        TestCase_PatternPeriod{"ToadTest", PatternLibrary::cToad, 2, 0, 0},
+        TestCase_PatternPeriod{"PulsarTest", PatternLibrary::cPulsar, 3, 0, 0},
+        TestCase_PatternPeriod{"PentadecathlonTest",
+                               PatternLibrary::cPentadecathlon, 15, 0, 0},
+        TestCase_PatternPeriod{"GliderTest", PatternLibrary::cGlider, 4, 1, 1},
+        TestCase_PatternPeriod{"LightweightSpaceshipTest",
+                               PatternLibrary::cLightweightSpaceship, 4, 0,
+                               -2}));
+
+TEST_P(PatternPeriodTestFixture, PatternPeriodTest) {
+  // Given
+  auto param{GetParam()};
+  constexpr std::uint32_t rows = 40;
+  constexpr std::uint32_t columns = 80;
+  GameOfLife game(rows, columns, MakeSettings());
+  game.StampPattern(param.pattern, 20, 60);
+  game.StepGenerations(param.period);
+
+  // Expected
+  PackedGrid expected(rows, columns);
+  PatternLibrary::Stamp(expected, param.pattern, PatternTransform::Identity,
+                        20 + param.row_shift, 60 + param.column_shift);
+  EXPECT_EQ(game.GetPackedCells(), expected);
+}
+
+struct TestCase_PatternTransform {
+  std::string name;
+  // set up inputs
+  PatternTransform transform;
+};
+
+class PatternTransformTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_PatternTransform> {};
+
+INSTANTIATE_TEST_CASE_P(
+    PatternTransformTest, PatternTransformTestFixture,
+    ::testing::Values(
+        TestCase_PatternTransform{"IdentityTest", PatternTransform::Identity},
+        TestCase_PatternTransform{"Rotate90Test", PatternTransform::Rotate90},
+        TestCase_PatternTransform{"Rotate180Test",
+                                  PatternTransform::Rotate180},
+        TestCase_PatternTransform{"Rotate270Test",
+                                  PatternTransform::Rotate270},
+        TestCase_PatternTransform{"FlipHorizontalTest",
+                                  PatternTransform::FlipHorizontal},
+        TestCase_PatternTransform{"FlipVerticalTest",
+                                  PatternTransform::FlipVertical},
+        TestCase_PatternTransform{"TransposeTest",
+                                  PatternTransform::Transpose},
+        TestCase_PatternTransform{"AntiTransposeTest",
+                                  PatternTransform::AntiTranspose}));
+
+TEST_P(PatternTransformTestFixture, StampTest) {
+  // Given the pattern crosses words and wraps around the corner
+  auto param{GetParam()};
+  constexpr std::uint32_t rows = 20;
+  constexpr std::uint32_t columns = 100;
+  const Pattern &pattern = PatternLibrary::cGosperGliderGun;
+  PackedGrid grid(rows, columns);
+  grid.Set(0, 0, true);
+  PatternLibrary::Stamp(grid, pattern, param.transform, 15, 80);
+
+  // Expected
+  std::uint32_t transformed_rows = 0, transformed_columns = 0;
+  PatternLibrary::GetTransformedCells(pattern, param.transform,
+                                      transformed_rows, transformed_columns);
+  PackedGrid expected(rows, columns);
+  expected.Set(0, 0, true);
+  for (std::uint32_t row = 0; row < transformed_rows; row++) {
+    for (std::uint32_t column = 0; column < transformed_columns; column++) {
+      if (GetTransformedCell(pattern, param.transform, row, column)) {
+        expected.Set((15 + row) % rows, (80 + column) % columns, true);
+      }
+    }
+  }
+  EXPECT_EQ(grid, expected);
+}
+
+TEST(PatternLibraryTest, FindPatternTest) {
+  // Expected
+  for (const auto &pattern : PatternLibrary::GetPatterns()) {
+    EXPECT_EQ(PatternLibrary::FindPattern(pattern.name)->cells, pattern.cells);
+  }
+  EXPECT_EQ(PatternLibrary::FindPattern("unknown"), nullptr);
+}
+
+TEST(PatternLibraryTest, GunTest) {
+  // Given
+  GameOfLife game(64, 64, MakeSettings());
+  game.StampPattern(PatternLibrary::cGosperGliderGun, 10, 10);
+  game.StepGenerations(30);
+
+  // Expected the gun and one glider
+  EXPECT_EQ(game.GetPackedCells().CountAlive(), 36 + 5);
+}
+
+TEST(PatternLibraryTest, DiehardTest) {
+  // Given
+  GameOfLife game(64, 64, MakeSettings());
+  game.StampPattern(PatternLibrary::cDiehard, 30, 30,
+                    PatternTransform::Rotate90);
+  game.StepGenerations(129);
+  const std::uint64_t last_alive = game.GetPackedCells().CountAlive();
+  game.StepGenerations(1);
+
+  // Expected
+  EXPECT_GT(last_alive, 0);
+  EXPECT_EQ(game.GetPackedCells().CountAlive(), 0);
+}
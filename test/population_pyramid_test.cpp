@@ -0,0 +1,121 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "statistics/population_pyramid.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+/// @brief count alive cells of the block cell by cell
+std::uint64_t CountBlock(const PackedGrid &cells, const std::uint32_t size,
+                         const std::uint32_t block_row,
+                         const std::uint32_t block_column) {
+  std::uint64_t population = 0;
+  for (std::uint32_t row = block_row * size;
+       row < std::min(cells.GetRowCount(), (block_row + 1) * size); row++) {
+    for (std::uint32_t column = block_column * size;
+         column < std::min(cells.GetColumnCount(), (block_column + 1) * size);
+         column++) {
+      population += cells.Get(row, column);
+    }
+  }
+  return population;
+}
+
+void ExpectPyramid(const PopulationPyramid &pyramid, const PackedGrid &cells) {
+  for (std::uint32_t level = 0; level < pyramid.GetLevelsCount(); level++) {
+    const std::uint32_t size = pyramid.GetBlockSize(level);
+    for (std::uint32_t row = 0; row < pyramid.GetRowCount(level); row++) {
+      for (std::uint32_t column = 0; column < pyramid.GetColumnCount(level);
+           column++) {
+        EXPECT_EQ(pyramid.Get(level, row, column),
+                  CountBlock(cells, size, row, column));
+      }
+    }
+  }
+}
+} // namespace
+
+struct TestCase_PopulationPyramid {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  // expected
+  std::uint32_t levels_count;
+};
+
+class PopulationPyramidTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_PopulationPyramid> {};
+
+INSTANTIATE_TEST_CASE_P(
+    PopulationPyramidTest, PopulationPyramidTestFixture,
+    ::testing::Values(
+        TestCase_PopulationPyramid{"OneTileTest", 20, 30, 1},
+        TestCase_PopulationPyramid{"SquareTest", 128, 128, 3},
+        TestCase_PopulationPyramid{"OddTilesTest", 100, 300, 5}));
+
+TEST_P(PopulationPyramidTestFixture, GenerationsTest) {
+  // Given
+  auto param{GetParam()};
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.engine = GenerationEngineType::LookupTable;
+  GameOfLife game(param.rows, param.columns, settings);
+  game.FillInitialPicture(MakeRandomCells(param.rows, param.columns));
+  const PopulationPyramid &pyramid = game.GetPopulationPyramid();
+
+  // Expected
+  EXPECT_EQ(pyramid.GetLevelsCount(), param.levels_count);
+  EXPECT_EQ(pyramid.GetRowCount(param.levels_count - 1), 1);
+  EXPECT_EQ(pyramid.GetColumnCount(param.levels_count - 1), 1);
+  ExpectPyramid(pyramid, game.GetPackedCells());
+  for (std::uint32_t generation = 0; generation < 5; generation++) {
+    game.StepGenerations(generation + 1);
+    ExpectPyramid(game.GetPopulationPyramid(), game.GetPackedCells());
+  }
+  game.ClearRegion({0, 0, param.rows, param.columns / 2});
+  ExpectPyramid(game.GetPopulationPyramid(), game.GetPackedCells());
+}
+
+TEST(PopulationPyramidTest, ChangedTilesTest) {
+  // Given
+  WorldStatistics statistics(64, 100, 16);
+  statistics.AddBirth(40, 40);
+  const std::uint32_t first_reader = statistics.AddChangedTilesReader();
+  statistics.AddBirth(0, 0);
+  statistics.AddBirth(17, 99);
+  const std::uint32_t second_reader = statistics.AddChangedTilesReader();
+  statistics.AddDeath(17, 98);
+  const std::vector<std::uint32_t> changed =
+      statistics.TakeChangedTiles(first_reader);
+
+  // Expected tiles 0 and 1 * 7 + 6 changed once, nothing after that. Every
+  // reader sees changes after it was added
+  EXPECT_EQ(changed, std::vector<std::uint32_t>({0, 13}));
+  EXPECT_TRUE(statistics.TakeChangedTiles(first_reader).empty());
+  EXPECT_EQ(statistics.TakeChangedTiles(second_reader),
+            std::vector<std::uint32_t>({13}));
+}
+
+TEST(PopulationPyramidTest, ReadBlocksTest) {
+  // Given
+  WorldStatistics statistics(64, 64, 16);
+  statistics.AddBirth(0, 0);
+  statistics.AddBirth(20, 40);
+  statistics.AddBirth(63, 63);
+  PopulationPyramid pyramid(statistics);
+  statistics.AddBirth(63, 62);
+  pyramid.Update(statistics);
+
+  // Expected blocks outside of the level are empty
+  EXPECT_EQ(pyramid.ReadBlocks(1, 0, 1, 2, 2),
+            std::vector<std::uint64_t>({1, 0, 2, 0}));
+  EXPECT_EQ(pyramid.ReadBlocks(2, 0, 0, 1, 2),
+            std::vector<std::uint64_t>({4, 0}));
+  EXPECT_EQ(pyramid.GetBlockSize(2), 64);
+}
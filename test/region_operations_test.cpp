@@ -0,0 +1,304 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "region/region_operations.h"
+#include "rules/lattice_rules.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+/// @brief write cells cell by cell
+void WriteCellByCell(PackedGrid &grid, const PackedGrid &cells,
+                     const std::int64_t top_row, const std::int64_t left_column,
+                     const RegionOperation operation,
+                     const CellBordersRule borders_rule) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::int64_t columns = grid.GetColumnCount();
+  for (std::uint32_t row = 0; row < cells.GetRowCount(); row++) {
+    for (std::uint32_t column = 0; column < cells.GetColumnCount(); column++) {
+      std::int64_t grid_row = top_row + row;
+      std::int64_t grid_column = left_column + column;
+      if (borders_rule == CellBordersRule::RingBorders) {
+        grid_row = (grid_row % rows + rows) % rows;
+        grid_column = (grid_column % columns + columns) % columns;
+      } else if (grid_row < 0 || grid_row >= rows || grid_column < 0 ||
+                 grid_column >= columns) {
+        continue;
+      }
+      const bool current = grid.Get(grid_row, grid_column);
+      const bool value = cells.Get(row, column);
+      switch (operation) {
+      case RegionOperation::Or:
+        grid.Set(grid_row, grid_column, current || value);
+        break;
+      case RegionOperation::And:
+        grid.Set(grid_row, grid_column, current && value);
+        break;
+      case RegionOperation::Xor:
+        grid.Set(grid_row, grid_column, current != value);
+        break;
+      case RegionOperation::Replace:
+      default:
+        grid.Set(grid_row, grid_column, value);
+      }
+    }
+  }
+}
+
+/// @brief return cell of the transformed cells by definition
+bool GetTransformedCell(const PackedGrid &cells,
+                        const PatternTransform transform,
+                        const std::uint32_t row, const std::uint32_t column) {
+  const std::uint32_t last_row = cells.GetRowCount() - 1;
+  const std::uint32_t last_column = cells.GetColumnCount() - 1;
+  switch (transform) {
+  case PatternTransform::Rotate90:
+    return cells.Get(last_row - column, row);
+  case PatternTransform::Rotate180:
+    return cells.Get(last_row - row, last_column - column);
+  case PatternTransform::Rotate270:
+    return cells.Get(column, last_column - row);
+  case PatternTransform::FlipHorizontal:
+    return cells.Get(row, last_column - column);
+  case PatternTransform::FlipVertical:
+    return cells.Get(last_row - row, column);
+  case PatternTransform::Transpose:
+    return cells.Get(column, row);
+  case PatternTransform::AntiTranspose:
+    return cells.Get(last_row - column, last_column - row);
+  case PatternTransform::Identity:
+  default:
+    return cells.Get(row, column);
+  }
+}
+} // namespace
+
+struct TestCase_RegionWrite {
+  std::string name;
+  // set up inputs
+  RegionOperation operation;
+  std::int64_t top_row;
+  std::int64_t left_column;
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+};
+
+class RegionWriteTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_RegionWrite> {};
+
+INSTANTIATE_TEST_CASE_P(
+    RegionWriteTest, RegionWriteTestFixture,
+    ::testing::Values(
+        TestCase_RegionWrite{"ReplaceAlignedTest", RegionOperation::Replace, 3,
+                             64, 10, 64, CellBordersRule::RingBorders},
+        TestCase_RegionWrite{"ReplaceUnalignedTest", RegionOperation::Replace,
+                             5, 37, 12, 90, CellBordersRule::RingBorders},
+        TestCase_RegionWrite{"OrWrappedTest", RegionOperation::Or, -4, 150,
+                             20, 100, CellBordersRule::RingBorders},
+        TestCase_RegionWrite{"AndTest", RegionOperation::And, 10, 1, 30, 170,
+                             CellBordersRule::RingBorders},
+        TestCase_RegionWrite{"XorBiggerThanWorldTest", RegionOperation::Xor,
+                             7, 13, 50, 300, CellBordersRule::RingBorders},
+        TestCase_RegionWrite{"XorLimitedTest", RegionOperation::Xor, -3, 170,
+                             20, 50, CellBordersRule::LimitedBorders},
+        TestCase_RegionWrite{"ReplaceLimitedTest", RegionOperation::Replace,
+                             30, -20, 20, 100,
+                             CellBordersRule::LimitedBorders}));
+
+TEST_P(RegionWriteTestFixture, WriteTest) {
+  // Given
+  auto param{GetParam()};
+  PackedGrid grid = MakeRandomGrid(40, 200, 0.4);
+  PackedGrid expected = grid;
+  const PackedGrid cells = MakeRandomGrid(param.rows, param.columns, 0.4, 1);
+  RegionOperations::Write(grid, cells, param.top_row, param.left_column,
+                          param.operation, param.borders_rule);
+
+  // Expected
+  WriteCellByCell(expected, cells, param.top_row, param.left_column,
+                  param.operation, param.borders_rule);
+  EXPECT_EQ(grid, expected);
+}
+
+struct TestCase_RegionTransform {
+  std::string name;
+  // set up inputs
+  PatternTransform transform;
+};
+
+class RegionTransformTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_RegionTransform> {};
+
+INSTANTIATE_TEST_CASE_P(
+    RegionTransformTest, RegionTransformTestFixture,
+    ::testing::Values(
+        TestCase_RegionTransform{"IdentityTest", PatternTransform::Identity},
+        TestCase_RegionTransform{"Rotate90Test", PatternTransform::Rotate90},
+        TestCase_RegionTransform{"Rotate180Test", PatternTransform::Rotate180},
+        TestCase_RegionTransform{"Rotate270Test", PatternTransform::Rotate270},
+        TestCase_RegionTransform{"FlipHorizontalTest",
+                                 PatternTransform::FlipHorizontal},
+        TestCase_RegionTransform{"FlipVerticalTest",
+                                 PatternTransform::FlipVertical},
+        TestCase_RegionTransform{"TransposeTest", PatternTransform::Transpose},
+        TestCase_RegionTransform{"AntiTransposeTest",
+                                 PatternTransform::AntiTranspose}));
+
+TEST_P(RegionTransformTestFixture, TransformTest) {
+  // Given cells of several blocks of 64x64 cells
+  auto param{GetParam()};
+  const PackedGrid cells = MakeRandomGrid(70, 135, 0.4);
+  const PackedGrid transformed =
+      RegionOperations::Transform(cells, param.transform);
+
+  // Expected
+  const bool is_transposed = param.transform == PatternTransform::Rotate90 ||
+                             param.transform == PatternTransform::Rotate270 ||
+                             param.transform == PatternTransform::Transpose ||
+                             param.transform == PatternTransform::AntiTranspose;
+  PackedGrid expected(is_transposed ? 135 : 70, is_transposed ? 70 : 135);
+  for (std::uint32_t row = 0; row < expected.GetRowCount(); row++) {
+    for (std::uint32_t column = 0; column < expected.GetColumnCount();
+         column++) {
+      expected.Set(row, column,
+                   GetTransformedCell(cells, param.transform, row, column));
+    }
+  }
+  EXPECT_EQ(transformed, expected);
+}
+
+TEST(RegionOperationsTest, MoveTest) {
+  // Given regions overlap
+  PackedGrid grid = MakeRandomGrid(30, 100, 0.4);
+  PackedGrid expected = grid;
+  const Region region{2, 10, 15, 70};
+  RegionOperations::Move(grid, region, 5, 50, CellBordersRule::RingBorders);
+
+  // Expected
+  const PackedGrid cells =
+      RegionQuery::ReadCells(expected, region, CellBordersRule::RingBorders);
+  WriteCellByCell(expected, PackedGrid(region.rows, region.columns),
+                  region.top_row, region.left_column, RegionOperation::Replace,
+                  CellBordersRule::RingBorders);
+  WriteCellByCell(expected, cells, 5, 50, RegionOperation::Replace,
+                  CellBordersRule::RingBorders);
+  EXPECT_EQ(grid, expected);
+}
+
+struct TestCase_WorldRows {
+  std::string name;
+  // set up inputs
+  GridTopology topology;
+  CellBordersRule borders_rule;
+  std::uint32_t first_row;
+  std::uint32_t rows_count;
+};
+
+class WorldRowsTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_WorldRows> {};
+
+INSTANTIATE_TEST_CASE_P(
+    WorldRowsTest, WorldRowsTestFixture,
+    ::testing::Values(
+        TestCase_WorldRows{"SquareRingTest", GridTopology::Square,
+                           CellBordersRule::RingBorders, 25, 10},
+        TestCase_WorldRows{"SquareLimitedTest", GridTopology::Square,
+                           CellBordersRule::LimitedBorders, 0, 7},
+        TestCase_WorldRows{"HexagonalRingTest", GridTopology::Hexagonal,
+                           CellBordersRule::RingBorders, 3, 12},
+        TestCase_WorldRows{"TriangularLimitedTest", GridTopology::Triangular,
+                           CellBordersRule::LimitedBorders, 10, 30}));
+
+TEST_P(WorldRowsTestFixture, NeighboursTest) {
+  // Given rows of the world are replaced, rows wrap at the end of the world
+  auto param{GetParam()};
+  constexpr std::uint32_t rows = 30;
+  constexpr std::uint32_t columns = 130;
+  const LatticeRules rules(param.topology, 1 << 3, (1 << 2) | (1 << 3),
+                           param.borders_rule);
+  const PackedGrid cells = MakeRandomGrid(rows, columns, 0.4);
+  PackedGrid new_cells = cells;
+  PackedGrid new_rows(param.rows_count, columns);
+  const PackedGrid changed_cells = MakeRandomGrid(rows, columns, 0.4, 3);
+  for (std::uint32_t index = 0; index < param.rows_count; index++) {
+    const std::uint32_t row = (param.first_row + index) % rows;
+    for (std::uint32_t column = 0; column < columns; column++) {
+      new_cells.Set(row, column, changed_cells.Get(row, column));
+      new_rows.Set(index, column, changed_cells.Get(row, column));
+    }
+  }
+  World world(rows, columns);
+  world.SetInitialCells(GetAliveCells(cells), rules);
+  world.ReplaceRows(new_rows, param.first_row, rules);
+  World expected(rows, columns);
+  expected.SetInitialCells(GetAliveCells(new_cells), rules);
+
+  // Expected
+  EXPECT_EQ(world.GetPackedCells(), new_cells);
+  EXPECT_EQ(world.GetAliveCellsCount(), expected.GetAliveCellsCount());
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      EXPECT_EQ(world.GetCellAt(row, column).IsAlive(),
+                expected.GetCellAt(row, column).IsAlive());
+      EXPECT_EQ(world.GetCellAt(row, column).GetAliveNeighboursCount(),
+                expected.GetCellAt(row, column).GetAliveNeighboursCount());
+    }
+  }
+}
+
+TEST(RegionOperationsTest, GameTest) {
+  // Given region operations of one game and a game which has the same cells
+  // from the start
+  constexpr std::uint32_t rows = 40;
+  constexpr std::uint32_t columns = 100;
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(rows, columns, settings);
+  game.FillInitialPicture(MakeRandomCells(rows, columns, 0.4));
+  GameOfLife other(rows, columns, settings);
+  other.FillInitialPicture(MakeRandomCells(rows, columns, 0.4, 2));
+
+  PackedGrid edited = game.GetPackedCells();
+  game.ClearRegion({30, 90, 20, 30});
+  game.PasteRegion(other.QueryRegion({0, 0, 10, 50}), 35, -10,
+                   RegionOperation::Xor);
+  game.CopyRegion({5, 5, 8, 80}, 12, 17);
+  game.MoveRegion({0, 60, 10, 10}, -2, 98);
+  game.TransformRegion({20, 20, 10, 30}, PatternTransform::Rotate90);
+  game.StampPattern(PatternLibrary::cGlider, 39, 99);
+  game.PasteRegion(other.QueryRegion({0, 0, 50, 7}), 3, 3);
+  const CellBordersRule ring = CellBordersRule::RingBorders;
+  RegionOperations::Clear(edited, {30, 90, 20, 30}, ring);
+  RegionOperations::Write(edited, other.QueryRegion({0, 0, 10, 50}), 35, -10,
+                          RegionOperation::Xor, ring);
+  RegionOperations::Copy(PackedGrid(edited), {5, 5, 8, 80}, edited, 12, 17,
+                         ring);
+  RegionOperations::Move(edited, {0, 60, 10, 10}, -2, 98, ring);
+  RegionOperations::TransformRegion(edited, {20, 20, 10, 30},
+                                    PatternTransform::Rotate90, ring);
+  PatternLibrary::Stamp(edited, PatternLibrary::cGlider,
+                        PatternTransform::Identity, 39, 99);
+  RegionOperations::Write(edited, other.QueryRegion({0, 0, 50, 7}), 3, 3,
+                          RegionOperation::Replace, ring);
+  // rows of the world are edited as on a copy of the whole grid
+  EXPECT_EQ(game.GetPackedCells(), edited);
+
+  GameOfLife expected(rows, columns, settings);
+  expected.FillInitialPicture(GetAliveCells(game.GetPackedCells()));
+  for (std::uint32_t generation = 0; generation < 5; generation++) {
+    game.ExecuteNextGeneration();
+    expected.ExecuteNextGeneration();
+  }
+
+  // Expected neighbours are the same, so the generations are the same
+  EXPECT_EQ(game.GetPackedCells(), expected.GetPackedCells());
+  EXPECT_EQ(game.GetStatistics().GetSummary().population,
+            expected.GetStatistics().GetSummary().population);
+}
@@ -0,0 +1,177 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "region/region_query.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace {
+/// @brief read region cell by cell
+PackedGrid ReadCellByCell(const PackedGrid &grid, const Region &region,
+                          const CellBordersRule borders_rule) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::int64_t columns = grid.GetColumnCount();
+  PackedGrid cells(region.rows, region.columns);
+  for (std::uint32_t row = 0; row < region.rows; row++) {
+    for (std::uint32_t column = 0; column < region.columns; column++) {
+      std::int64_t grid_row = region.top_row + row;
+      std::int64_t grid_column = region.left_column + column;
+      if (borders_rule == CellBordersRule::RingBorders) {
+        grid_row = (grid_row % rows + rows) % rows;
+        grid_column = (grid_column % columns + columns) % columns;
+      } else if (grid_row < 0 || grid_row >= rows || grid_column < 0 ||
+                 grid_column >= columns) {
+        continue;
+      }
+      cells.Set(row, column, grid.Get(grid_row, grid_column));
+    }
+  }
+  return cells;
+}
+} // namespace
+
+struct TestCase_RegionQuery {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  CellBordersRule borders_rule;
+  Region region;
+};
+
+class RegionQueryTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_RegionQuery> {};
+
+INSTANTIATE_TEST_CASE_P(
+    RegionQueryTest, RegionQueryTestFixture,
+    ::testing::Values(
+        TestCase_RegionQuery{"InsideTest", 50, 200,
+                             CellBordersRule::RingBorders, {3, 5, 20, 130}},
+        TestCase_RegionQuery{"WholeWorldTest", 30, 130,
+                             CellBordersRule::LimitedBorders, {0, 0, 30, 130}},
+        TestCase_RegionQuery{"RingCornerTest", 40, 100,
+                             CellBordersRule::RingBorders, {-5, -70, 10, 90}},
+        TestCase_RegionQuery{"RingBiggerThanWorldTest", 7, 70,
+                             CellBordersRule::RingBorders, {3, 65, 20, 300}},
+        TestCase_RegionQuery{"LimitedCornerTest", 40, 100,
+                             CellBordersRule::LimitedBorders,
+                             {-5, -70, 10, 90}},
+        TestCase_RegionQuery{"LimitedOutsideTest", 40, 100,
+                             CellBordersRule::LimitedBorders,
+                             {35, 90, 10, 80}},
+        TestCase_RegionQuery{"EmptyRegionTest", 10, 10,
+                             CellBordersRule::RingBorders, {2, 2, 0, 0}}));
+
+TEST_P(RegionQueryTestFixture, RegionQueryTest) {
+  // Given
+  auto param{GetParam()};
+  const PackedGrid grid = MakeRandomGrid(param.rows, param.columns, 0.4);
+
+  const PackedGrid cells =
+      RegionQuery::ReadCells(grid, param.region, param.borders_rule);
+  const std::vector<CellSpan> spans =
+      RegionQuery::ReadSpans(grid, param.region, param.borders_rule);
+
+  // Expected
+  const PackedGrid expected =
+      ReadCellByCell(grid, param.region, param.borders_rule);
+  EXPECT_EQ(cells, expected);
+  PackedGrid from_spans(param.region.rows, param.region.columns);
+  std::uint32_t previous_row = 0, previous_end = 0;
+  for (const auto &span : spans) {
+    ASSERT_GT(span.length, 0);
+    // spans are ordered and separated by dead cells
+    if (span.row == previous_row && &span != &spans.front()) {
+      EXPECT_GT(span.column, previous_end);
+    }
+    for (std::uint32_t column = span.column;
+         column < span.column + span.length; column++) {
+      from_spans.Set(span.row, column, true);
+    }
+    previous_row = span.row;
+    previous_end = span.column + span.length;
+  }
+  EXPECT_EQ(from_spans, expected);
+}
+
+TEST(RegionQueryTest, SpansAcrossWordsTest) {
+  // Given
+  PackedGrid cells(2, 200);
+  for (std::uint32_t column = 60; column < 140; column++) {
+    cells.Set(1, column, true);
+  }
+  cells.Set(0, 0, true);
+  cells.Set(0, 199, true);
+
+  const std::vector<CellSpan> spans = RegionQuery::GetSpans(cells);
+
+  // Expected
+  ASSERT_EQ(spans.size(), 3);
+  EXPECT_EQ(spans[0].row, 0);
+  EXPECT_EQ(spans[0].column, 0);
+  EXPECT_EQ(spans[0].length, 1);
+  EXPECT_EQ(spans[1].column, 199);
+  EXPECT_EQ(spans[2].row, 1);
+  EXPECT_EQ(spans[2].column, 60);
+  EXPECT_EQ(spans[2].length, 80);
+}
+
+TEST(RegionQueryTest, QueryWhileSteppingTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(64, 64, settings);
+  // glider has 5 cells in every generation, a partially updated world has
+  // a different count of cells
+  game.FillInitialPicture(
+      std::vector<Point>{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}});
+  game.EnableSnapshots();
+  std::atomic<bool> is_stepping(true);
+  std::thread stepper([&game, &is_stepping] {
+    for (std::uint32_t generation = 0; generation < 2000; generation++) {
+      game.ExecuteNextGeneration();
+    }
+    is_stepping = false;
+  });
+
+  // Expected
+  std::uint32_t queries = 0;
+  while (is_stepping || queries == 0) {
+    const PackedGrid cells = game.QueryRegion(Region{-32, -32, 64, 64});
+    ASSERT_EQ(cells.CountAlive(), 5);
+    queries++;
+  }
+  stepper.join();
+}
+
+TEST(RegionQueryTest, QueryWithoutSnapshotsWhileSteppingTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.engine = GenerationEngineType::LookupTable;
+  GameOfLife game(64, 64, settings);
+  game.FillInitialPicture(
+      std::vector<Point>{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}});
+  std::future<StepResult> result = game.StepAsync(2000);
+
+  // Expected the world is read under the lock, never in the middle of an
+  // update
+  std::uint32_t queries = 0;
+  while (result.wait_for(std::chrono::seconds(0)) !=
+             std::future_status::ready ||
+         queries == 0) {
+    const PackedGrid cells = game.QueryRegion(Region{-32, -32, 64, 64});
+    ASSERT_EQ(cells.CountAlive(), 5);
+    queries++;
+  }
+  EXPECT_EQ(result.get().status, StepStatus::Completed);
+}
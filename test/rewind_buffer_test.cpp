@@ -0,0 +1,235 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "history/rewind_buffer.h"
+#include "history/zero_run_codec.h"
+#include "termination/termination_policies.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace {
+/// @brief return grid of a random world after generations of Conway rules
+std::vector<PackedGrid> MakeGenerations(const std::uint32_t rows,
+                                        const std::uint32_t columns,
+                                        const std::uint32_t generations) {
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.engine = GenerationEngineType::LookupTable;
+  GameOfLife game(rows, columns, settings);
+  std::mt19937 generator(rows + columns);
+  std::bernoulli_distribution is_alive(0.3);
+  std::vector<Point> cells;
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      if (is_alive(generator)) {
+        cells.push_back({row, column});
+      }
+    }
+  }
+  game.FillInitialPicture(cells);
+
+  std::vector<PackedGrid> grids{game.GetPackedCells()};
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    game.ExecuteNextGeneration();
+    grids.push_back(game.GetPackedCells());
+  }
+  return grids;
+}
+} // namespace
+
+struct TestCase_ZeroRunCodec {
+  std::string name;
+  // set up inputs
+  std::vector<std::uint64_t> words;
+};
+
+class ZeroRunCodecTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_ZeroRunCodec> {};
+
+INSTANTIATE_TEST_CASE_P(
+    ZeroRunCodecTest, ZeroRunCodecTestFixture,
+    ::testing::Values(
+        TestCase_ZeroRunCodec{"EmptyTest", {}},
+        TestCase_ZeroRunCodec{"ZerosTest", std::vector<std::uint64_t>(300)},
+        TestCase_ZeroRunCodec{"DenseTest", {1, ~0ULL, 3, 1ULL << 63}},
+        TestCase_ZeroRunCodec{"SparseTest", {0, 0, 5, 0, 0, 0, 7, 8, 0}}));
+
+TEST_P(ZeroRunCodecTestFixture, ZeroRunCodecTest) {
+  // Given
+  auto param{GetParam()};
+  std::vector<std::uint8_t> data;
+
+  ZeroRunCodec::Encode(param.words.data(), param.words.size(), data);
+  std::vector<std::uint64_t> decoded(param.words.size());
+  const bool is_decoded =
+      ZeroRunCodec::DecodeXor(data, decoded.data(), decoded.size());
+
+  // Expected
+  EXPECT_TRUE(is_decoded);
+  EXPECT_EQ(decoded, param.words);
+  EXPECT_LE(data.size(), param.words.size() * sizeof(std::uint64_t) + 4);
+  std::vector<std::uint64_t> too_short(param.words.size() + 1);
+  EXPECT_FALSE(
+      ZeroRunCodec::DecodeXor(data, too_short.data(), too_short.size()));
+}
+
+TEST(RewindBufferTest, RandomAccessTest) {
+  // Given
+  const std::vector<PackedGrid> grids = MakeGenerations(50, 130, 100);
+  RewindBuffer buffer(1 << 24, 8);
+
+  for (std::uint32_t generation = 0; generation < grids.size();
+       generation++) {
+    buffer.Push(generation, grids[generation]);
+  }
+
+  // Expected
+  EXPECT_EQ(buffer.GetFramesCount(), grids.size());
+  for (std::uint32_t generation : {0U, 7U, 8U, 9U, 55U, 100U, 63U}) {
+    PackedGrid grid;
+    ASSERT_TRUE(buffer.Get(generation, grid));
+    EXPECT_EQ(grid, grids[generation]);
+  }
+  PackedGrid grid;
+  EXPECT_FALSE(buffer.Get(101, grid));
+}
+
+TEST(RewindBufferTest, MemoryBudgetTest) {
+  // Given
+  const std::vector<PackedGrid> grids = MakeGenerations(64, 256, 200);
+  const std::size_t budget = 32 * 1024;
+  RewindBuffer buffer(budget, 16);
+
+  for (std::uint32_t generation = 0; generation < grids.size();
+       generation++) {
+    buffer.Push(generation, grids[generation]);
+  }
+
+  // Expected
+  EXPECT_LE(buffer.GetMemoryUsage(), budget);
+  EXPECT_GT(buffer.GetOldestGeneration(), 0);
+  EXPECT_EQ(buffer.GetNewestGeneration(), 200);
+  EXPECT_EQ(buffer.GetOldestGeneration() % 16, 0);
+  PackedGrid grid;
+  EXPECT_FALSE(buffer.Get(buffer.GetOldestGeneration() - 1, grid));
+  ASSERT_TRUE(buffer.Get(buffer.GetOldestGeneration(), grid));
+  EXPECT_EQ(grid, grids[buffer.GetOldestGeneration()]);
+}
+
+TEST(RewindBufferTest, TruncateTest) {
+  // Given
+  const std::vector<PackedGrid> grids = MakeGenerations(20, 70, 40);
+  RewindBuffer buffer(1 << 24, 8);
+  for (std::uint32_t generation = 0; generation <= 30; generation++) {
+    buffer.Push(generation, grids[generation]);
+  }
+
+  buffer.Truncate(13);
+  // deltas after truncation are taken to generation 13
+  for (std::uint32_t generation = 14; generation <= 40; generation++) {
+    buffer.Push(generation, grids[generation]);
+  }
+
+  // Expected
+  for (std::uint32_t generation = 0; generation <= 40; generation++) {
+    PackedGrid grid;
+    ASSERT_TRUE(buffer.Get(generation, grid));
+    EXPECT_EQ(grid, grids[generation]);
+  }
+}
+
+TEST(RewindBufferTest, ReplaceNewestTest) {
+  // Given the newest keyframe and the newest delta are replaced
+  const std::vector<PackedGrid> grids = MakeGenerations(20, 70, 12);
+  RewindBuffer buffer(1 << 24, 4);
+  for (std::uint32_t generation = 0; generation <= 4; generation++) {
+    buffer.Push(generation, grids[generation]);
+  }
+  buffer.Push(4, grids[10]);
+  buffer.Push(5, grids[5]);
+  buffer.Push(5, grids[11]);
+  buffer.Push(6, grids[6]);
+
+  // Expected replaced generations are restored as replaced, others as pushed
+  for (std::uint32_t generation = 0; generation <= 6; generation++) {
+    PackedGrid grid;
+    ASSERT_TRUE(buffer.Get(generation, grid));
+    EXPECT_EQ(grid, generation == 4   ? grids[10]
+                    : generation == 5 ? grids[11]
+                                      : grids[generation]);
+  }
+  EXPECT_EQ(buffer.GetFramesCount(), 7);
+}
+
+TEST(RewindBufferTest, GameEditTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(30, 30, settings);
+  game.EnableHistory(1 << 20, 4);
+  game.FillInitialPicture(
+      std::vector<Point>{{10, 11}, {10, 12}, {11, 10}, {11, 11}, {12, 11}});
+  std::vector<PackedGrid> grids{game.GetPackedCells()};
+  for (std::uint32_t generation = 0; generation < 6; generation++) {
+    game.ExecuteNextGeneration();
+    grids.push_back(game.GetPackedCells());
+  }
+  game.StampPattern(PatternLibrary::cGlider, 0, 0);
+  const PackedGrid edited = game.GetPackedCells();
+  game.ExecuteNextGeneration();
+
+  // Expected the edit replaces generation 6 and older generations are kept
+  PackedGrid grid;
+  ASSERT_TRUE(game.GetHistoryCells(3, grid));
+  EXPECT_EQ(grid, grids[3]);
+  ASSERT_TRUE(game.GetHistoryCells(6, grid));
+  EXPECT_EQ(grid, edited);
+  EXPECT_NE(edited, grids[6]);
+  ASSERT_TRUE(game.Rewind(1));
+  EXPECT_EQ(game.GetPackedCells(), edited);
+  EXPECT_EQ(game.GetGenerationsCount(), 6);
+}
+
+TEST(RewindBufferTest, GameRewindTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(30, 30, settings);
+  game.SetTerminationPolicy(
+      std::unique_ptr<TerminationPolicy>(new RepetitionPolicy()));
+  game.EnableHistory(1 << 20, 4);
+  // r-pentomino
+  game.FillInitialPicture(
+      std::vector<Point>{{10, 11}, {10, 12}, {11, 10}, {11, 11}, {12, 11}});
+  std::vector<PackedGrid> grids{game.GetPackedCells()};
+  for (std::uint32_t generation = 0; generation < 30; generation++) {
+    game.ExecuteNextGeneration();
+    grids.push_back(game.GetPackedCells());
+  }
+
+  const bool is_rewound = game.Rewind(20);
+  const PackedGrid rewound = game.GetPackedCells();
+  const std::uint64_t alive_cells_count = game.GetStatistics()
+                                              .GetSummary()
+                                              .population;
+  for (std::uint32_t generation = 0; generation < 20; generation++) {
+    game.ExecuteNextGeneration();
+  }
+
+  // Expected
+  ASSERT_TRUE(is_rewound);
+  EXPECT_EQ(rewound, grids[10]);
+  EXPECT_EQ(alive_cells_count, grids[10].CountAlive());
+  EXPECT_EQ(game.GetPackedCells(), grids[30]);
+  EXPECT_EQ(game.GetGenerationsCount(), 30);
+  EXPECT_FALSE(game.IsGameOver());
+  EXPECT_FALSE(game.Rewind(31));
+  PackedGrid grid;
+  ASSERT_TRUE(game.GetHistoryCells(5, grid));
+  EXPECT_EQ(grid, grids[5]);
+}
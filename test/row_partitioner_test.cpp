@@ -0,0 +1,89 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020, Bayerische Motoren Werke Aktiengesellschaft
+/// (BMW AG)
+///
+#include "partition/row_partitioner.h"
+#include "partition/thread_placement.h"
+
+#include <gtest/gtest.h>
+
+struct TestCase_RowPartitioner {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t parts_count;
+};
+
+class RowPartitionerTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_RowPartitioner> {
+protected:
+  void ExpectAllRowsCoveredOnce(const RowPartitioner &partitioner,
+                                const std::uint32_t rows) {
+    std::uint32_t next_row = 0;
+    for (std::uint32_t part = 0; part < partitioner.GetPartsCount(); part++) {
+      const RowRange range = partitioner.GetRange(part);
+      EXPECT_EQ(range.begin_row, next_row);
+      EXPECT_LE(range.begin_row, range.end_row);
+      next_row = range.end_row;
+    }
+    EXPECT_EQ(next_row, rows);
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(
+    RowPartitionerTest, RowPartitionerTestFixture,
+    ::testing::Values(TestCase_RowPartitioner{"EvenSplit", 100, 4},
+                      TestCase_RowPartitioner{"UnevenSplit", 101, 7},
+                      TestCase_RowPartitioner{"MorePartsThanRows", 5, 8},
+                      TestCase_RowPartitioner{"SinglePart", 13, 1}));
+
+TEST_P(RowPartitionerTestFixture, EqualSplitTest) {
+  // Given
+  auto param{GetParam()};
+  RowPartitioner partitioner(param.rows, param.parts_count);
+
+  // Expected
+  ExpectAllRowsCoveredOnce(partitioner, param.rows);
+  for (std::uint32_t part = 0; part < partitioner.GetPartsCount(); part++) {
+    const RowRange range = partitioner.GetRange(part);
+    EXPECT_LE(range.end_row - range.begin_row,
+              param.rows / param.parts_count + 1);
+  }
+}
+
+TEST_P(RowPartitionerTestFixture, RebalanceKeepsCoverageTest) {
+  // Given
+  auto param{GetParam()};
+  RowPartitioner partitioner(param.rows, param.parts_count);
+
+  for (std::uint32_t generation = 0; generation < 5; generation++) {
+    for (std::uint32_t part = 0; part < partitioner.GetPartsCount(); part++) {
+      partitioner.SetMeasuredCost(part, (part + 1) * (generation + 1));
+    }
+    partitioner.Rebalance();
+
+    // Expected
+    ExpectAllRowsCoveredOnce(partitioner, param.rows);
+  }
+}
+
+TEST(RowPartitionerTest, RebalanceMovesRowsFromExpensivePart) {
+  // Given
+  RowPartitioner partitioner(100, 2);
+  partitioner.SetMeasuredCost(0, 300);
+  partitioner.SetMeasuredCost(1, 100);
+
+  // When
+  partitioner.Rebalance();
+
+  // Expected: row in first half costs 6, in second half 2
+  EXPECT_EQ(partitioner.GetRange(0).begin_row, 0);
+  EXPECT_EQ(partitioner.GetRange(0).end_row, 33);
+  EXPECT_EQ(partitioner.GetRange(1).end_row, 100);
+}
+
+TEST(ThreadPlacementTest, CoresAreAvailable) {
+  EXPECT_FALSE(ThreadPlacement::GetCoresOrderedByNode().empty());
+}
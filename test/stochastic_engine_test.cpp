@@ -0,0 +1,166 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "engine/stochastic_engine.h"
+#include "engine/temporal_blocking_engine.h"
+#include "game_of_life.h"
+#include "random/counter_random.h"
+#include "test_utils.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+/// Conway rules: birth on 3, survival on 2 and 3
+const TotalisticRuleTable cConwayRuleTable(1 << 3, (1 << 2) | (1 << 3),
+                                           CellBordersRule::RingBorders);
+
+PackedGrid RunGame(const GameOfLifeSettings &settings,
+                   const std::uint32_t generations) {
+  constexpr std::uint32_t rows = 40;
+  constexpr std::uint32_t columns = 100;
+  GameOfLife game(rows, columns, settings);
+  game.FillInitialPicture(MakeRandomCells(rows, columns, 0.35));
+  for (std::uint32_t generation = 0; generation < generations; generation++) {
+    game.ExecuteNextGeneration();
+  }
+  return game.GetPackedCells();
+}
+} // namespace
+
+struct TestCase_BernoulliWord {
+  std::string name;
+  // set up inputs
+  double probability;
+  std::uint64_t lanes;
+};
+
+class BernoulliWordTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_BernoulliWord> {};
+
+INSTANTIATE_TEST_CASE_P(
+    BernoulliWordTest, BernoulliWordTestFixture,
+    ::testing::Values(
+        TestCase_BernoulliWord{"QuarterTest", 0.25, ~0ULL},
+        TestCase_BernoulliWord{"HalfTest", 0.5, ~0ULL},
+        TestCase_BernoulliWord{"SmallTest", 0.01, ~0ULL},
+        TestCase_BernoulliWord{"HalfLanesTest", 0.9, 0xFFFFFFFFULL},
+        TestCase_BernoulliWord{"NeverTest", 0, ~0ULL},
+        TestCase_BernoulliWord{"AlwaysTest", 1, 0xF0F0ULL}));
+
+TEST_P(BernoulliWordTestFixture, BernoulliWordTest) {
+  // Given
+  auto param{GetParam()};
+  constexpr std::uint64_t words_count = 4096;
+  const std::uint64_t threshold =
+      CounterRandom::GetThreshold(param.probability);
+  std::uint64_t alive_count = 0;
+  bool is_outside_of_lanes = false;
+  for (std::uint64_t counter = 0; counter < words_count; counter++) {
+    const std::uint64_t word =
+        CounterRandom::GetBernoulliWord(7, 3, counter, threshold, param.lanes);
+    alive_count += __builtin_popcountll(word);
+    is_outside_of_lanes |= (word & ~param.lanes) != 0;
+  }
+  const double trials =
+      static_cast<double>(words_count) * __builtin_popcountll(param.lanes);
+  const double deviation =
+      std::sqrt(trials * param.probability * (1 - param.probability));
+
+  // Expected
+  EXPECT_FALSE(is_outside_of_lanes);
+  EXPECT_NEAR(alive_count, trials * param.probability, 5 * deviation + 0.5);
+}
+
+TEST(CounterRandomTest, KeyedWordsTest) {
+  // Expected
+  EXPECT_EQ(CounterRandom::GetWord(1, 2, 3), CounterRandom::GetWord(1, 2, 3));
+  EXPECT_NE(CounterRandom::GetWord(1, 2, 3), CounterRandom::GetWord(2, 2, 3));
+  EXPECT_NE(CounterRandom::GetWord(1, 2, 3), CounterRandom::GetWord(1, 3, 3));
+  EXPECT_NE(CounterRandom::GetWord(1, 2, 3), CounterRandom::GetWord(1, 2, 4));
+}
+
+TEST(StochasticEngineTest, AlwaysIsDeterministicTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  const PackedGrid deterministic = RunGame(settings, 10);
+  settings.birth_probability = 1;
+  settings.survival_probability = 1 - 1e-12;
+
+  // Expected
+  EXPECT_TRUE(RunGame(settings, 10) == deterministic);
+}
+
+TEST(StochasticEngineTest, NoBirthsTest) {
+  // Given
+  PackedGrid grid(16, 16);
+  grid.Set(5, 5, true);
+  grid.Set(5, 6, true);
+  grid.Set(5, 7, true);
+  StochasticEngine engine(
+      std::unique_ptr<GenerationEngine>(
+          new TemporalBlockingEngine(cConwayRuleTable, 16, 8, 2)),
+      0, 1, 42);
+
+  engine.Step(grid, 1);
+
+  // Expected the blinker can't turn, only the middle cell survives
+  PackedGrid expected(16, 16);
+  expected.Set(5, 6, true);
+  EXPECT_TRUE(grid == expected);
+}
+
+TEST(StochasticEngineTest, ReproducibleTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.birth_probability = 0.7;
+  settings.survival_probability = 0.9;
+  settings.random_seed = 11;
+  const PackedGrid first = RunGame(settings, 12);
+
+  GameOfLifeSettings other_settings = settings;
+  other_settings.threads_count = 4;
+  other_settings.engine = GenerationEngineType::LookupTable;
+  GameOfLifeSettings blocked_settings = settings;
+  blocked_settings.engine = GenerationEngineType::TemporalBlocking;
+  blocked_settings.temporal_tile_rows = 5;
+  GameOfLife blocked_game(40, 100, blocked_settings);
+  blocked_game.FillInitialPicture(MakeRandomCells(40, 100, 0.35));
+  blocked_game.StepGenerations(5);
+  blocked_game.StepGenerations(7);
+  GameOfLifeSettings seed_settings = settings;
+  seed_settings.random_seed = 12;
+
+  // Expected
+  EXPECT_TRUE(RunGame(settings, 12) == first);
+  EXPECT_TRUE(RunGame(other_settings, 12) == first);
+  EXPECT_TRUE(blocked_game.GetPackedCells() == first);
+  EXPECT_FALSE(RunGame(seed_settings, 12) == first);
+}
+
+TEST(StochasticEngineTest, RewindReplaysTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.birth_probability = 0.5;
+  settings.random_seed = 3;
+  GameOfLife game(40, 100, settings);
+  game.FillInitialPicture(MakeRandomCells(40, 100, 0.35));
+  game.EnableHistory(1 << 20);
+  for (std::uint32_t generation = 0; generation < 8; generation++) {
+    game.ExecuteNextGeneration();
+  }
+  const PackedGrid cells = game.GetPackedCells();
+
+  game.Rewind(3);
+  for (std::uint32_t generation = 0; generation < 3; generation++) {
+    game.ExecuteNextGeneration();
+  }
+
+  // Expected
+  EXPECT_TRUE(game.GetPackedCells() == cells);
+}
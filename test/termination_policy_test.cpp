@@ -0,0 +1,307 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "termination/termination_policies.h"
+#include "termination/termination_policy_factory.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace {
+/// @brief return counters of a generation with population and a box of one
+/// row
+TerminationCounters MakeCounters(const std::uint32_t generation,
+                                 const std::uint64_t population,
+                                 const std::uint32_t box_column = 0) {
+  TerminationCounters counters{};
+  counters.generations_count = generation;
+  counters.summary.population = population;
+  counters.summary.bounding_box = BoundingBox{0, box_column, 0, box_column};
+  return counters;
+}
+} // namespace
+
+struct TestCase_TerminationPolicy {
+  std::string name;
+  // set up inputs
+  std::function<std::unique_ptr<TerminationPolicy>()> make_policy;
+  std::vector<std::uint64_t> populations;
+  // expected
+  TerminationReason reason;
+  std::uint32_t generation;
+};
+
+class TerminationPolicyTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_TerminationPolicy> {};
+
+INSTANTIATE_TEST_CASE_P(
+    TerminationPolicyTest, TerminationPolicyTestFixture,
+    ::testing::Values(
+        TestCase_TerminationPolicy{
+            "ExtinctionTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(new ExtinctionPolicy());
+            },
+            {5, 3, 1, 0, 0},
+            TerminationReason::Extinct,
+            3},
+        TestCase_TerminationPolicy{
+            "GenerationLimitTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new GenerationLimitPolicy(4));
+            },
+            {5, 5, 5, 5, 5, 5, 5},
+            TerminationReason::GenerationLimit,
+            5},
+        TestCase_TerminationPolicy{
+            "PlateauTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new PopulationPlateauPolicy(3, 1));
+            },
+            {10, 20, 30, 31, 30, 31, 40},
+            TerminationReason::PopulationPlateau,
+            5},
+        TestCase_TerminationPolicy{
+            "NoPlateauTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new PopulationPlateauPolicy(3, 1));
+            },
+            {10, 12, 10, 12, 10, 12, 10},
+            TerminationReason::None,
+            0},
+        TestCase_TerminationPolicy{
+            "GrowthTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new UnboundedGrowthPolicy(2, 3));
+            },
+            {10, 15, 12, 14, 13, 20, 18, 25, 20},
+            TerminationReason::UnboundedGrowth,
+            6},
+        TestCase_TerminationPolicy{
+            "NoGrowthTest",
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new UnboundedGrowthPolicy(2, 3));
+            },
+            {10, 15, 12, 14, 11, 20, 18, 25, 20},
+            TerminationReason::None,
+            0},
+        TestCase_TerminationPolicy{
+            "FirstReasonTest",
+            [] {
+              std::unique_ptr<AnyTerminationPolicy> policy(
+                  new AnyTerminationPolicy());
+              policy->Add(std::unique_ptr<TerminationPolicy>(
+                  new ExtinctionPolicy()));
+              policy->Add(std::unique_ptr<TerminationPolicy>(
+                  new GenerationLimitPolicy(1)));
+              return std::unique_ptr<TerminationPolicy>(std::move(policy));
+            },
+            {5, 5, 0},
+            TerminationReason::Extinct,
+            2}));
+
+TEST_P(TerminationPolicyTestFixture, TerminationPolicyTest) {
+  // Given
+  auto param{GetParam()};
+  std::unique_ptr<TerminationPolicy> policy = param.make_policy();
+
+  TerminationReason reason = TerminationReason::None;
+  std::uint32_t generation = 0;
+  for (; generation < param.populations.size(); generation++) {
+    reason =
+        policy->Update(MakeCounters(generation, param.populations[generation]));
+    if (reason != TerminationReason::None) {
+      break;
+    }
+  }
+
+  // Expected
+  EXPECT_EQ(reason, param.reason);
+  if (param.reason != TerminationReason::None) {
+    EXPECT_EQ(generation, param.generation);
+  }
+}
+
+struct TestCase_DefaultPolicy {
+  std::string name;
+  // set up inputs
+  std::uint64_t alive_cells_count;
+  std::uint32_t equal_worlds_count;
+  std::uint32_t generations_count;
+  // expected
+  TerminationReason reason;
+};
+
+class DefaultPolicyTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_DefaultPolicy> {};
+
+INSTANTIATE_TEST_CASE_P(
+    DefaultPolicyTest, DefaultPolicyTestFixture,
+    ::testing::Values(
+        TestCase_DefaultPolicy{"GameOverIfCellsDead", 0, 0, 10,
+                               TerminationReason::Extinct},
+        TestCase_DefaultPolicy{"GameNotOverIfCellsAlive", 10, 0, 5,
+                               TerminationReason::None},
+        TestCase_DefaultPolicy{"GameOverWorldIsRepeated", 100, 1, 20,
+                               TerminationReason::Repeated},
+        TestCase_DefaultPolicy{"GameOverAfterLimit", 100, 0, 21,
+                               TerminationReason::GenerationLimit}));
+
+TEST_P(DefaultPolicyTestFixture, CountersTest) {
+  // Given
+  auto param{GetParam()};
+  std::unique_ptr<TerminationPolicy> policy =
+      TerminationPolicyFactory::MakeDefaultPolicy();
+  TerminationCounters counters =
+      MakeCounters(param.generations_count, param.alive_cells_count);
+  counters.equal_worlds_count = param.equal_worlds_count;
+
+  // Expected
+  EXPECT_EQ(policy->Update(counters), param.reason);
+}
+
+TEST(TerminationPolicyTest, BoundingBoxStableTest) {
+  // Given
+  BoundingBoxStablePolicy policy(2);
+
+  // Expected
+  EXPECT_EQ(policy.Update(MakeCounters(0, 5, 1)), TerminationReason::None);
+  EXPECT_EQ(policy.Update(MakeCounters(1, 5, 2)), TerminationReason::None);
+  EXPECT_EQ(policy.Update(MakeCounters(2, 5, 2)), TerminationReason::None);
+  EXPECT_EQ(policy.Update(MakeCounters(3, 5, 2)),
+            TerminationReason::BoundingBoxStable);
+  policy.Reset();
+  EXPECT_EQ(policy.Update(MakeCounters(4, 5, 2)), TerminationReason::None);
+}
+
+TEST(TerminationPolicyTest, TimeBudgetTest) {
+  // Given
+  TimeBudgetPolicy policy(std::chrono::milliseconds(10));
+
+  // Expected
+  EXPECT_EQ(policy.Update(MakeCounters(0, 5)), TerminationReason::None);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(policy.Update(MakeCounters(1, 5)), TerminationReason::TimeBudget);
+}
+
+TEST(TerminationPolicyTest, BatchRunStopsEarlyTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(64, 64, settings);
+  game.SetTerminationPolicy(TerminationPolicyFactory::MakeBatchPolicy(
+      100000, std::chrono::milliseconds(0)));
+  // glider on the ring repeats its world only after 256 generations, its
+  // population is always 5
+  game.FillInitialPicture(
+      std::vector<Point>{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}});
+  ASSERT_FALSE(game.IsGameOver());
+
+  while (!game.IsGameOver()) {
+    game.ExecuteNextGeneration();
+  }
+
+  // Expected
+  EXPECT_EQ(game.GetTerminationReason(),
+            TerminationReason::PopulationPlateau);
+  EXPECT_EQ(game.GetGenerationsCount(), 120);
+}
+
+TEST(TerminationPolicyTest, DefaultPolicyTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  GameOfLife game(20, 20, settings);
+
+  // Expected
+  EXPECT_EQ(game.GetTerminationReason(), TerminationReason::Extinct);
+  game.FillInitialPicture(
+      std::vector<Point>{{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}});
+  EXPECT_FALSE(game.IsGameOver());
+  while (!game.IsGameOver()) {
+    game.ExecuteNextGeneration();
+  }
+  EXPECT_EQ(game.GetTerminationReason(), TerminationReason::GenerationLimit);
+  EXPECT_EQ(game.GetGenerationsCount(), 21);
+}
+
+struct TestCase_StepGenerationsTermination {
+  std::string name;
+  // set up inputs
+  std::vector<Point> alive_cells;
+  std::function<std::unique_ptr<TerminationPolicy>()> make_policy;
+  std::uint32_t generations;
+  // expected
+  TerminationReason reason;
+};
+
+class StepGenerationsTerminationTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<
+          TestCase_StepGenerationsTermination> {};
+
+INSTANTIATE_TEST_CASE_P(
+    StepGenerationsTerminationTest, StepGenerationsTerminationTestFixture,
+    ::testing::Values(
+        TestCase_StepGenerationsTermination{
+            "ExtinctMidCallTest",
+            {{5, 5}, {5, 6}, {9, 9}},
+            TerminationPolicyFactory::MakeDefaultPolicy,
+            8,
+            TerminationReason::Extinct},
+        TestCase_StepGenerationsTermination{
+            "BlinkerRepeatedMidCallTest",
+            {{5, 4}, {5, 5}, {5, 6}},
+            TerminationPolicyFactory::MakeDefaultPolicy,
+            7,
+            TerminationReason::Repeated},
+        TestCase_StepGenerationsTermination{
+            "GenerationLimitTest",
+            {{1, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}},
+            [] {
+              return std::unique_ptr<TerminationPolicy>(
+                  new GenerationLimitPolicy(6));
+            },
+            15,
+            TerminationReason::GenerationLimit}));
+
+TEST_P(StepGenerationsTerminationTestFixture, StepGenerationsTerminationTest) {
+  // Given
+  auto param{GetParam()};
+  GameOfLifeSettings settings;
+  settings.threads_count = 1;
+  settings.temporal_depth = 4;
+  GameOfLife stepped_game(16, 16, settings);
+  GameOfLife blocked_game(16, 16, settings);
+  stepped_game.SetTerminationPolicy(param.make_policy());
+  blocked_game.SetTerminationPolicy(param.make_policy());
+  stepped_game.FillInitialPicture(param.alive_cells);
+  blocked_game.FillInitialPicture(param.alive_cells);
+
+  while (!blocked_game.IsGameOver()) {
+    blocked_game.StepGenerations(param.generations);
+    for (std::uint32_t generation = 0; generation < param.generations;
+         generation++) {
+      stepped_game.ExecuteNextGeneration();
+    }
+    ASSERT_EQ(blocked_game.GetTerminationReason(),
+              stepped_game.GetTerminationReason());
+  }
+
+  // Expected
+  EXPECT_EQ(blocked_game.GetGenerationsCount(),
+            stepped_game.GetGenerationsCount());
+  EXPECT_TRUE(blocked_game.GetPackedCells() == stepped_game.GetPackedCells());
+  EXPECT_EQ(blocked_game.GetTerminationReason(), param.reason);
+  EXPECT_EQ(stepped_game.GetTerminationReason(), param.reason);
+}
@@ -0,0 +1,115 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#ifndef TEST_TEST_UTILS_H_
+#define TEST_TEST_UTILS_H_
+#include "initial_figures/initial_figure.h"
+#include "packed_grid.h"
+#include "rules/grid_topology.h"
+#include "rules/neighbourhood_table.h"
+#include "rules/rule_table.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/// @brief return random cells of size, the same for the same size,
+/// probability and seed
+inline PackedGrid MakeRandomGrid(const std::uint32_t rows,
+                                 const std::uint32_t columns,
+                                 const double probability = 0.3,
+                                 const std::uint32_t seed = 0) {
+  std::mt19937 generator(rows * 1000 + columns + seed);
+  std::bernoulli_distribution is_alive(probability);
+  PackedGrid grid(rows, columns);
+  for (std::uint32_t row = 0; row < rows; row++) {
+    for (std::uint32_t column = 0; column < columns; column++) {
+      grid.Set(row, column, is_alive(generator));
+    }
+  }
+  return grid;
+}
+
+/// @brief return alive cells of the grid by rows
+inline std::vector<Point> GetAliveCells(const PackedGrid &grid) {
+  std::vector<Point> alive_cells;
+  for (std::uint32_t row = 0; row < grid.GetRowCount(); row++) {
+    for (std::uint32_t column = 0; column < grid.GetColumnCount(); column++) {
+      if (grid.Get(row, column)) {
+        alive_cells.push_back({row, column});
+      }
+    }
+  }
+  return alive_cells;
+}
+
+/// @brief return alive cells of MakeRandomGrid
+inline std::vector<Point> MakeRandomCells(const std::uint32_t rows,
+                                          const std::uint32_t columns,
+                                          const double probability = 0.3,
+                                          const std::uint32_t seed = 0) {
+  return GetAliveCells(MakeRandomGrid(rows, columns, probability, seed));
+}
+
+/// @brief return neighbour of the cell or false if it is outside of
+/// limited borders
+inline bool GetNeighbour(const PackedGrid &grid, std::int64_t row,
+                         std::int64_t column,
+                         const CellBordersRule borders_rule) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::int64_t columns = grid.GetColumnCount();
+  if (borders_rule == CellBordersRule::RingBorders) {
+    row = (row + rows) % rows;
+    column = (column + columns) % columns;
+  } else if (row < 0 || row >= rows || column < 0 || column >= columns) {
+    return false;
+  }
+  return grid.Get(row, column);
+}
+
+/// @brief one generation calculated cell by cell with neighbour offsets
+inline PackedGrid StepCellByCell(const PackedGrid &grid,
+                                 const TotalisticRuleTable &rule_table) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::int64_t columns = grid.GetColumnCount();
+  PackedGrid next(rows, columns);
+  for (std::int64_t row = 0; row < rows; row++) {
+    for (std::int64_t column = 0; column < columns; column++) {
+      std::uint32_t neighbours = 0;
+      for (const auto &offset : GridNeighbourhood::GetOffsets(
+               rule_table.GetTopology(), row, column)) {
+        neighbours += GetNeighbour(grid, row + offset.row,
+                                   column + offset.column,
+                                   rule_table.GetBordersRule());
+      }
+      next.Set(row, column,
+               rule_table.GetNewCellState(grid.Get(row, column), neighbours));
+    }
+  }
+  return next;
+}
+
+/// @brief one generation calculated cell by cell with the 3x3 block index
+inline PackedGrid StepCellByCell(const PackedGrid &grid,
+                                 const NeighbourhoodRuleTable &rule_table) {
+  const std::int64_t rows = grid.GetRowCount();
+  const std::int64_t columns = grid.GetColumnCount();
+  PackedGrid next(rows, columns);
+  for (std::int64_t row = 0; row < rows; row++) {
+    for (std::int64_t column = 0; column < columns; column++) {
+      std::uint32_t neighbourhood = 0;
+      for (std::int64_t d_row = -1; d_row <= 1; d_row++) {
+        for (std::int64_t d_column = -1; d_column <= 1; d_column++) {
+          neighbourhood |= GetNeighbour(grid, row + d_row, column + d_column,
+                                        rule_table.GetBordersRule())
+                           << ((d_row + 1) * 3 + d_column + 1);
+        }
+      }
+      next.Set(row, column, rule_table.GetNewCellState(neighbourhood));
+    }
+  }
+  return next;
+}
+
+#endif // TEST_TEST_UTILS_H_
@@ -0,0 +1,147 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "region/region_query.h"
+#include "snapshot/world_snapshot.h"
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+struct TestCase_WorldSnapshot {
+  std::string name;
+  // set up inputs
+  GenerationEngineType engine;
+  std::uint32_t threads_count;
+};
+
+class WorldSnapshotTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_WorldSnapshot> {};
+
+INSTANTIATE_TEST_CASE_P(
+    WorldSnapshotTest, WorldSnapshotTestFixture,
+    ::testing::Values(
+        TestCase_WorldSnapshot{"PerCellTest", GenerationEngineType::PerCell,
+                               1},
+        TestCase_WorldSnapshot{"PerCellThreadsTest",
+                               GenerationEngineType::PerCell, 3},
+        TestCase_WorldSnapshot{"LookupTableTest",
+                               GenerationEngineType::LookupTable, 1}));
+
+TEST_P(WorldSnapshotTestFixture, ReadWhileSteppingTest) {
+  // Given
+  auto param{GetParam()};
+  GameOfLifeSettings settings;
+  settings.threads_count = param.threads_count;
+  settings.engine = param.engine;
+  GameOfLife game(100, 300, settings);
+  game.FillInitialPicture(MakeRandomCells(100, 300));
+  game.EnableSnapshots();
+  std::atomic<bool> is_stepping(true);
+  std::thread stepper([&game, &is_stepping] {
+    for (std::uint32_t generation = 0; generation < 200; generation++) {
+      game.ExecuteNextGeneration();
+    }
+    is_stepping = false;
+  });
+
+  // Expected cells and statistics of every snapshot are of one generation
+  std::uint32_t last_generation = 0;
+  std::uint32_t reads = 0;
+  while (is_stepping || reads == 0) {
+    const SnapshotGuard snapshot = game.ReadSnapshot();
+    ASSERT_NE(snapshot.Get(), nullptr);
+    ASSERT_GE(snapshot->GetGeneration(), last_generation);
+    ASSERT_EQ(snapshot->ToPackedGrid().CountAlive(),
+              snapshot->GetSummary().population);
+    last_generation = snapshot->GetGeneration();
+    reads++;
+  }
+  stepper.join();
+
+  const SnapshotGuard snapshot = game.ReadSnapshot();
+  EXPECT_EQ(snapshot->GetGeneration(), 200);
+  EXPECT_EQ(snapshot->ToPackedGrid(), game.GetPackedCells());
+}
+
+TEST(WorldSnapshotTest, SharedTilesTest) {
+  // Given
+  WorldStatistics statistics(100, 300, 16);
+  SnapshotPublisher publisher(statistics);
+  PackedGrid cells(100, 300);
+  const auto set_alive = [&cells, &statistics](const std::uint32_t row,
+                                               const std::uint32_t column) {
+    cells.Set(row, column, true);
+    statistics.AddBirth(row, column);
+  };
+  set_alive(5, 5);
+  set_alive(70, 299);
+  publisher.Publish(1, cells, statistics);
+  const SnapshotGuard first = publisher.Read();
+  set_alive(40, 260);
+  publisher.Publish(2, cells, statistics);
+  const SnapshotGuard second = publisher.Read();
+
+  // Expected only the tile of the changed cell is copied
+  ASSERT_EQ(second->GetTileRowsCount(), 4);
+  ASSERT_EQ(second->GetTileColumnsCount(), 2);
+  for (std::uint32_t tile_row = 0; tile_row < 4; tile_row++) {
+    for (std::uint32_t tile_column = 0; tile_column < 2; tile_column++) {
+      EXPECT_EQ(first->GetTile(tile_row, tile_column) ==
+                    second->GetTile(tile_row, tile_column),
+                tile_row != 1 || tile_column != 1)
+          << "tile " << tile_row << " " << tile_column;
+    }
+  }
+  EXPECT_FALSE(first->Get(40, 260));
+  EXPECT_TRUE(second->Get(40, 260));
+  EXPECT_TRUE(second->Get(70, 299));
+  EXPECT_EQ(second->GetSummary().population, 3);
+  EXPECT_EQ(second->ToPackedGrid(), cells);
+  EXPECT_EQ(RegionQuery::ReadCells(*second, Region{-10, 250, 60, 60},
+                                   CellBordersRule::RingBorders),
+            RegionQuery::ReadCells(cells, Region{-10, 250, 60, 60},
+                                   CellBordersRule::RingBorders));
+}
+
+TEST(WorldSnapshotTest, RetiredSnapshotsTest) {
+  // Given
+  WorldStatistics statistics(10, 10);
+  SnapshotPublisher publisher(statistics);
+  PackedGrid cells(10, 10);
+  publisher.Publish(0, cells, statistics);
+  {
+    const SnapshotGuard guard = publisher.Read();
+    for (std::uint32_t generation = 1; generation <= 3; generation++) {
+      cells.Set(generation, generation, true);
+      statistics.AddBirth(generation, generation);
+      publisher.Publish(generation, cells, statistics);
+    }
+
+    // Expected the read snapshot and newer ones are kept while it is read
+    EXPECT_EQ(guard->GetGeneration(), 0);
+    EXPECT_EQ(guard->ToPackedGrid().CountAlive(), 0);
+    EXPECT_EQ(publisher.GetRetiredCount(), 3);
+  }
+  publisher.Publish(4, cells, statistics);
+  EXPECT_EQ(publisher.GetRetiredCount(), 0);
+  EXPECT_EQ(publisher.Read()->GetGeneration(), 4);
+  EXPECT_EQ(publisher.Read()->ToPackedGrid(), cells);
+}
+
+TEST(WorldSnapshotTest, DisabledSnapshotsTest) {
+  // Given
+  GameOfLife game(10, 10);
+  game.FillInitialPicture(std::vector<Point>{{2, 3}});
+
+  // Expected nothing is published, regions are read from the world
+  EXPECT_EQ(game.ReadSnapshot().Get(), nullptr);
+  EXPECT_TRUE(game.QueryRegion(Region{2, 3, 1, 1}).Get(0, 0));
+  game.EnableSnapshots();
+  EXPECT_TRUE(game.ReadSnapshot()->Get(2, 3));
+}
@@ -0,0 +1,136 @@
+///
+/// @file
+/// @copyright Copyright (C) 2020
+///
+#include "game_of_life.h"
+#include "statistics/world_statistics.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+struct TestCase_WorldStatistics {
+  std::string name;
+  // set up inputs
+  std::uint32_t rows;
+  std::uint32_t columns;
+  std::uint32_t tile_size;
+  std::vector<Point> alive_cells;
+  // expected
+  std::uint64_t population;
+  BoundingBox bounding_box;
+  double centroid_row;
+  double centroid_column;
+};
+
+class WorldStatisticsTestFixture
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<TestCase_WorldStatistics> {};
+
+INSTANTIATE_TEST_CASE_P(
+    WorldStatisticsTest, WorldStatisticsTestFixture,
+    ::testing::Values(
+        TestCase_WorldStatistics{
+            "OnePointTest", 10, 10, 4, {{5, 6}}, 1, {5, 6, 5, 6}, 5.0, 6.0},
+        TestCase_WorldStatistics{"CornersTest",
+                                 10,
+                                 13,
+                                 4,
+                                 {{0, 0}, {9, 12}},
+                                 2,
+                                 {0, 0, 9, 12},
+                                 4.5,
+                                 6.0},
+        TestCase_WorldStatistics{"InsideTilesTest",
+                                 40,
+                                 40,
+                                 8,
+                                 {{10, 30}, {11, 31}, {25, 17}, {25, 18}},
+                                 4,
+                                 {10, 17, 25, 31},
+                                 17.75,
+                                 24.0},
+        TestCase_WorldStatistics{"OneTileTest",
+                                 5,
+                                 5,
+                                 32,
+                                 {{1, 2}, {3, 2}},
+                                 2,
+                                 {1, 2, 3, 2},
+                                 2.0,
+                                 2.0}));
+
+TEST_P(WorldStatisticsTestFixture, WorldStatisticsTest) {
+  // Given
+  auto param{GetParam()};
+  WorldStatistics statistics(param.rows, param.columns, param.tile_size);
+  // a cell which is born and dies again does not change the result
+  statistics.AddBirth(param.rows - 1, 0);
+  statistics.AddDeath(param.rows - 1, 0);
+  for (const auto &cell : param.alive_cells) {
+    statistics.AddBirth(cell.x, cell.y);
+  }
+
+  const StatisticsSummary summary = statistics.GetSummary();
+
+  // Expected
+  EXPECT_EQ(summary.population, param.population);
+  EXPECT_EQ(summary.births, param.population + 1);
+  EXPECT_EQ(summary.deaths, 1);
+  EXPECT_EQ(summary.bounding_box.top_row, param.bounding_box.top_row);
+  EXPECT_EQ(summary.bounding_box.left_column, param.bounding_box.left_column);
+  EXPECT_EQ(summary.bounding_box.bottom_row, param.bounding_box.bottom_row);
+  EXPECT_EQ(summary.bounding_box.right_column,
+            param.bounding_box.right_column);
+  EXPECT_DOUBLE_EQ(summary.centroid_row, param.centroid_row);
+  EXPECT_DOUBLE_EQ(summary.centroid_column, param.centroid_column);
+
+  std::uint64_t tiles_population = 0;
+  for (std::uint32_t tile_row = 0; tile_row < statistics.GetTileRowsCount();
+       tile_row++) {
+    for (std::uint32_t tile_column = 0;
+         tile_column < statistics.GetTileColumnsCount(); tile_column++) {
+      tiles_population += statistics.GetTile(tile_row, tile_column).population;
+    }
+  }
+  EXPECT_EQ(tiles_population, param.population);
+}
+
+TEST(WorldStatisticsTest, GenerationBirthsAndDeathsTest) {
+  // Given
+  GameOfLifeSettings settings;
+  settings.threads_count = 2;
+  GameOfLife game(20, 20, settings);
+  // horizontal blinker
+  game.FillInitialPicture(std::vector<Point>{{10, 9}, {10, 10}, {10, 11}});
+
+  game.ExecuteNextGeneration();
+  const StatisticsSummary summary = game.GetStatistics().GetSummary();
+
+  // Expected
+  EXPECT_EQ(summary.population, 3);
+  EXPECT_EQ(summary.births, 2);
+  EXPECT_EQ(summary.deaths, 2);
+  EXPECT_EQ(summary.bounding_box.top_row, 9);
+  EXPECT_EQ(summary.bounding_box.left_column, 10);
+  EXPECT_EQ(summary.bounding_box.bottom_row, 11);
+  EXPECT_EQ(summary.bounding_box.right_column, 10);
+  EXPECT_DOUBLE_EQ(summary.centroid_row, 10.0);
+  EXPECT_DOUBLE_EQ(summary.centroid_column, 10.0);
+
+  const TileStatistics tile = game.GetStatistics().GetTile(0, 0);
+  EXPECT_EQ(tile.population, 3);
+  EXPECT_EQ(tile.births, 2);
+  EXPECT_EQ(tile.deaths, 2);
+}
+
+TEST(WorldStatisticsTest, EmptyWorldJsonTest) {
+  // Given
+  WorldStatistics statistics(3, 70, 32);
+  std::ostringstream stream;
+  statistics.WriteJson(stream);
+
+  // Expected
+  EXPECT_EQ(stream.str(), "{\"population\":0,\"births\":0,\"deaths\":0,"
+                          "\"tile_size\":32,\"tiles\":[[0,0,0]]}");
+}
@@ -149,3 +149,22 @@ TEST_P(WorldTestFixture, WorldHashTest) {
   world.UpdateHash();
   EXPECT_EQ(world.GetEqualWorldsCount(), 1);
 }
+
+TEST(WorldTest, DeferredAllocationTest) {
+  // Given
+  ConwayRules game_rules;
+  World world(6, 4, false);
+  EXPECT_TRUE(world.GetCells()[0].empty());
+
+  // When
+  world.AllocateRows(0, 3);
+  world.AllocateRows(3, 6);
+  world.MakeCellAlive(5, 3, game_rules);
+
+  // Expected
+  for (std::uint32_t row = 0; row < world.GetCells().size(); row++) {
+    EXPECT_EQ(world.GetCells()[row].size(), 4);
+  }
+  EXPECT_TRUE(world.GetCellAt(5, 3).IsAlive());
+  EXPECT_EQ(world.GetCellAt(0, 0).GetAliveNeighboursCount(), 1);
+}